@@ -0,0 +1,128 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include <unistd.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include "mcis/graph.h"
+#include "mcis/node.h"
+
+namespace {
+
+// Bytes a small allocation occupies with glibc malloc: an 8-byte header, rounded up to 16
+size_t chunk(size_t bytes) {
+    return std::max<size_t>(32, (bytes + 8 + 15) / 16 * 16);
+}
+
+size_t string_heap(const std::string& s) {
+    return s.capacity() > std::string().capacity() ? chunk(s.capacity() + 1) : 0;
+}
+
+// Resident set size, from /proc (0 where it is not available)
+long rss_bytes() {
+    std::ifstream statm("/proc/self/statm");
+    long pages = 0;
+    long resident = 0;
+    statm >> pages >> resident;
+    return resident * sysconf(_SC_PAGESIZE);
+}
+
+// Heap bytes in use, including allocator headers (0 outside glibc)
+long heap_bytes() {
+#if defined(__GLIBC__)
+    return static_cast<long>(mallinfo2().uordblks);
+#else
+    return 0;
+#endif
+}
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void measure(const char* name, const std::function<Graph()>& build) {
+    const long rss_before = rss_bytes();
+    const long heap_before = heap_bytes();
+    const Graph graph = build();
+    const double n = graph.get_num_nodes();
+    const double rss = (rss_bytes() - rss_before) / n;
+    const double heap = (heap_bytes() - heap_before) / n;
+
+    auto start = std::chrono::steady_clock::now();
+    const Graph copy(graph);
+    const double copy_time = seconds_since(start);
+    start = std::chrono::steady_clock::now();
+    const bool dag = copy.is_dag();
+    const double dag_time = seconds_since(start);
+    std::ostringstream out;
+    start = std::chrono::steady_clock::now();
+    out << graph;
+    const double print_time = seconds_since(start);
+
+    // Estimated share of each part of a node, from the allocations it owns
+    size_t node_bytes = 0;
+    size_t id_bytes = 0;
+    for (const auto& [id, node] : graph.get_nodes()) {
+        node_bytes += chunk(sizeof(Node));
+        id_bytes += string_heap(id) + string_heap(node->get_id());
+    }
+    // A hash node holds the next pointer and the cached hash next to the key/value pair
+    using MapNode = std::pair<const std::string, Node*>;
+    const auto& nodes = graph.get_nodes();
+    const size_t entry_bytes = nodes.size() * chunk(sizeof(MapNode) + 2 * sizeof(void*))
+                               + nodes.bucket_count() * sizeof(void*);
+
+    std::printf("| %-5s | %5.0f B | %5.0f B | %4.0f B | %3.0f B | %4.0f B ", name, rss, heap,
+                node_bytes / n, id_bytes / n, entry_bytes / n);
+    std::printf("| %5.3f s |  %5.3f s |      %5.3f s |%s\n", copy_time, dag_time, print_time,
+                dag ? "" : " (cyclic)");
+}
+
+}  // namespace
+
+// Node storage on large FFT and MVM graphs: resident set and heap growth per node while building,
+// with an estimate of how the heap bytes of a node split between the Node object (with inline
+// children), its two ID strings (the Node's and the ID map's key; short IDs live inline) and the
+// ID map entry; the rest is spilled child arrays and the graph's own tables. Then a graph copy,
+// is_dag on the copy and operator<<. Each graph is measured in its own child process so the
+// allocator starts empty.
+// Usage: adjacency_benchmark [fft|mvm]
+int main(int argc, char** argv) {
+    const std::string which = argc > 1 ? argv[1] : "";
+    if (which == "fft") {
+        measure("FFT", [] { return Graph::create_fft_graph(1 << 14); });
+        return 0;
+    }
+    if (which == "mvm") {
+        measure("MVM", [] { return Graph::create_mvm_graph_from_dimensions(300, 300); });
+        return 0;
+    }
+    std::printf("| Graph | RSS     | Heap    | Node   | IDs | Map    | Copy    | `is_dag` "
+                "| `operator<<` |\n");
+    std::printf("| ----- | ------: | ------: | -----: | --: | -----: | ------: | -------: "
+                "| -----------: |\n");
+    std::fflush(stdout);
+    for (const char* graph : {"fft", "mvm"}) {
+        const std::string command = std::string(argv[0]) + " " + graph;
+        if (std::system(command.c_str()) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
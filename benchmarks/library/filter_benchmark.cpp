@@ -0,0 +1,122 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include <omp.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mcis/graph.h"
+#include "mcis/indexed_graph.h"
+
+namespace {
+
+constexpr int RUNS = 3;
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool keep(const Node& node) {
+    return node.get_label() != OpLabel::TWIDDLE && node.get_label() != OpLabel::MUL;
+}
+
+// Best of RUNS timings of run, each after an untimed prepare
+template <typename Prepare, typename Run>
+double best_time(Prepare prepare, Run run) {
+    double best = 0.0;
+    for (int i = 0; i < RUNS; ++i) {
+        auto state = prepare();
+        const auto start = std::chrono::steady_clock::now();
+        run(state);
+        const double time = seconds_since(start);
+        best = i == 0 ? time : std::min(best, time);
+    }
+    return best;
+}
+
+}  // namespace
+
+// Node filtering on a large FFT CDAG, keeping everything except TWIDDLE and MUL nodes, with each
+// thread count given on the command line (1, 2 and 4 by default): the snapshot build, the induced
+// subgraph of the kept IDs, filter_nodes, hash-set removal without a snapshot and remove_nodes_if
+// with a cached snapshot. Times are the best of RUNS.
+// Usage: filter_benchmark [threads...]
+int main(int argc, char** argv) {
+    std::vector<int> threads;
+    for (int i = 1; i < argc; ++i) {
+        threads.push_back(std::atoi(argv[i]));
+    }
+    if (threads.empty()) {
+        threads = {1, 2, 4};
+    }
+
+    const Graph fft = Graph::create_fft_graph(1 << 14);
+    std::vector<std::string> kept;
+    std::vector<std::string> dropped;
+    for (const auto& [id, node] : fft.get_nodes()) {
+        (keep(*node) ? kept : dropped).push_back(id);
+    }
+    std::printf("FFT: %d nodes, %zu kept, %d hardware threads\n\n", fft.get_num_nodes(),
+                kept.size(), omp_get_num_procs());
+
+    std::printf("| Operation                              |");
+    for (int t : threads) {
+        const std::string label = std::to_string(t) + (t == 1 ? " thread" : " threads");
+        std::printf(" %9s |", label.c_str());
+    }
+    std::printf("\n| -------------------------------------- |");
+    for (size_t i = 0; i < threads.size(); ++i) {
+        std::printf(" --------: |");
+    }
+    std::printf("\n");
+
+    struct Row {
+        const char* name;
+        std::vector<double> times;
+    };
+    std::vector<Row> rows = {{"`IndexedGraph` snapshot build", {}},
+                             {"`induced_subgraph` on the kept IDs", {}},
+                             {"`filter_nodes`", {}},
+                             {"`remove_nodes_bulk`, hash set per edge", {}},
+                             {"`remove_nodes_if`, cached snapshot", {}}};
+    for (int t : threads) {
+        omp_set_num_threads(t);
+        rows[0].times.push_back(best_time([] { return 0; },
+                                          [&](int) { const IndexedGraph indexed(fft); }));
+        rows[1].times.push_back(best_time([] { return 0; },
+                                          [&](int) { (void)fft.induced_subgraph(kept); }));
+        rows[2].times.push_back(best_time([] { return 0; },
+                                          [&](int) { (void)fft.filter_nodes(keep); }));
+        rows[3].times.push_back(
+            best_time([&] { return std::make_unique<Graph>(fft); },
+                      [&](std::unique_ptr<Graph>& copy) { copy->remove_nodes_bulk(dropped); }));
+        // Moving a graph drops its caches, so the snapshot is built in place
+        rows[4].times.push_back(best_time(
+            [&] {
+                auto copy = std::make_unique<Graph>(fft);
+                (void)copy->get_indexed();
+                return copy;
+            },
+            [&](std::unique_ptr<Graph>& copy) {
+                copy->remove_nodes_if([](const Node& node) { return !keep(node); });
+            }));
+    }
+    for (const Row& row : rows) {
+        std::printf("| %-38s |", row.name);
+        for (double time : row.times) {
+            std::printf(" %7.3f s |", time);
+        }
+        std::printf("\n");
+    }
+    return 0;
+}
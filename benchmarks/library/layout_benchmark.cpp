@@ -0,0 +1,131 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../../src/algorithms/bron_kerbosch_serial.h"
+#include "mcis/graph.h"
+#include "mcis/graph_reorder.h"
+#include "mcis/indexed_graph.h"
+
+namespace {
+
+constexpr int TRAVERSAL_RUNS = 5;
+
+constexpr VertexOrdering ORDERINGS[] = {VertexOrdering::NATURAL,      VertexOrdering::DEGREE,
+                                        VertexOrdering::DEGENERACY,   VertexOrdering::LEVEL,
+                                        VertexOrdering::LABEL_RARITY, VertexOrdering::RCM};
+
+const char* ordering_name(VertexOrdering ordering) {
+    switch (ordering) {
+        case VertexOrdering::NATURAL:
+            return "NATURAL";
+        case VertexOrdering::DEGREE:
+            return "DEGREE";
+        case VertexOrdering::DEGENERACY:
+            return "DEGENERACY";
+        case VertexOrdering::LEVEL:
+            return "LEVEL";
+        case VertexOrdering::LABEL_RARITY:
+            return "LABEL_RARITY";
+        case VertexOrdering::RCM:
+            return "RCM";
+    }
+    return "";
+}
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Kahn pass over the CSR rows; returns the number of nodes reached so it is not optimized out
+int kahn_pass(const IndexedGraph& graph) {
+    const int n = graph.get_num_nodes();
+    std::vector<int> in_degree(n);
+    std::vector<int> queue;
+    queue.reserve(n);
+    for (int v = 0; v < n; ++v) {
+        in_degree[v] = graph.get_in_degree(v);
+        if (in_degree[v] == 0) {
+            queue.push_back(v);
+        }
+    }
+    for (size_t head = 0; head < queue.size(); ++head) {
+        for (int child : graph.get_children(queue[head])) {
+            if (--in_degree[child] == 0) {
+                queue.push_back(child);
+            }
+        }
+    }
+    return static_cast<int>(queue.size());
+}
+
+double mean_edge_span(const IndexedGraph& graph) {
+    long long total = 0;
+    for (int v = 0; v < graph.get_num_nodes(); ++v) {
+        for (int child : graph.get_children(v)) {
+            total += std::abs(child - v);
+        }
+    }
+    return static_cast<double>(total) / graph.get_num_edges();
+}
+
+}  // namespace
+
+// Node layouts (GraphReorder::node_order with IndexedGraph::reordered) on a large FFT CDAG: time
+// to compute and apply each layout, one Kahn pass over the CSR rows averaged over TRAVERSAL_RUNS,
+// and the mean index distance between the endpoints of an edge. Then the same orderings as the
+// search order of the bitset clique search on FFT(4) against MVM(2, 3).
+// Usage: layout_benchmark [log2 of the FFT inputs, default 16]
+int main(int argc, char** argv) {
+    const int log_inputs = argc > 1 ? std::atoi(argv[1]) : 16;
+    const Graph fft = Graph::create_fft_graph(1 << log_inputs);
+    const IndexedGraph indexed(fft);
+    std::printf("FFT with 2^%d inputs: %d nodes, %d edges\n\n", log_inputs,
+                indexed.get_num_nodes(), indexed.get_num_edges());
+
+    std::printf("| Layout       | Reorder time | Traversal | Mean edge span |\n");
+    std::printf("| ------------ | -----------: | --------: | -------------: |\n");
+    for (VertexOrdering ordering : ORDERINGS) {
+        auto start = std::chrono::steady_clock::now();
+        const std::vector<int> order = GraphReorder::node_order(indexed, ordering);
+        const IndexedGraph reordered = indexed.reordered(order);
+        const double reorder = seconds_since(start);
+
+        int reached = 0;
+        start = std::chrono::steady_clock::now();
+        for (int run = 0; run < TRAVERSAL_RUNS; ++run) {
+            reached += kahn_pass(reordered);
+        }
+        const double traversal = seconds_since(start) / TRAVERSAL_RUNS;
+        if (reached != TRAVERSAL_RUNS * reordered.get_num_nodes()) {
+            std::fprintf(stderr, "traversal missed nodes\n");
+            return 1;
+        }
+        std::printf("| %-12s | %10.2f s | %6.1f ms | %14.0f |\n", ordering_name(ordering), reorder,
+                    traversal * 1e3, mean_edge_span(reordered));
+    }
+
+    const Graph g1 = Graph::create_fft_graph(4);
+    const Graph g2 = Graph::create_mvm_graph_from_dimensions(2, 3);
+    std::printf("\n| Search order | Search nodes | Time    |\n");
+    std::printf("| ------------ | -----------: | ------: |\n");
+    for (VertexOrdering ordering : ORDERINGS) {
+        MCISOptions options;
+        options.ordering = ordering;
+        BronKerboschSerial finder;
+        finder.set_options(options);
+        const auto start = std::chrono::steady_clock::now();
+        const MCISResult result = finder.find_mapping(g1, g2);
+        std::printf("| %-12s | %12lld | %4.1f ms |\n", ordering_name(ordering),
+                    result.nodes_explored, seconds_since(start) * 1e3);
+    }
+    return 0;
+}
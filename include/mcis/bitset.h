@@ -0,0 +1,408 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef BITSET_H
+#define BITSET_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @enum SimdLevel
+ * @brief Instruction set used by the bitset kernels.
+ */
+enum class SimdLevel { SCALAR, AVX2, AVX512 };
+
+/**
+ * @class BitsetKernels
+ * @brief Word-array kernels for bitset algebra, dispatched at runtime to AVX-512, AVX2 or scalar
+ * implementations according to CPUID. All kernels operate on arrays of n 64-bit words; fused
+ * variants (e.g. and_count) never materialize the intermediate set.
+ */
+class BitsetKernels {
+public:
+    /**
+     * @brief Detects the best instruction set supported by the running CPU.
+     * @return The detected SIMD level.
+     */
+    static SimdLevel detect_simd_level();
+
+    /**
+     * @brief Retrieves the SIMD level currently used by the kernels.
+     * @return The active SIMD level.
+     */
+    static SimdLevel get_simd_level();
+
+    /**
+     * @brief Selects the kernels for the given SIMD level, clamped to what the CPU supports.
+     * Intended for benchmarks and tests; not thread-safe with concurrent kernel calls.
+     * @param level Requested SIMD level.
+     * @return The SIMD level actually selected.
+     */
+    static SimdLevel set_simd_level(SimdLevel level);
+
+    /**
+     * @brief Counts the set bits of a.
+     */
+    static size_t count(const uint64_t* a, size_t n);
+
+    /**
+     * @brief Counts the set bits of a & b.
+     */
+    static size_t and_count(const uint64_t* a, const uint64_t* b, size_t n);
+
+    /**
+     * @brief Counts the set bits of a & ~b.
+     */
+    static size_t andnot_count(const uint64_t* a, const uint64_t* b, size_t n);
+
+    /**
+     * @brief Computes dst = a & b. dst may alias a or b.
+     */
+    static void and_into(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t n);
+
+    /**
+     * @brief Computes dst = a & ~b. dst may alias a or b.
+     */
+    static void andnot_into(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t n);
+
+    /**
+     * @brief Computes dst = a | b. dst may alias a or b.
+     */
+    static void or_into(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t n);
+
+    /**
+     * @brief Computes dst = a & b and returns its number of set bits in the same pass.
+     */
+    static size_t and_into_count(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t n);
+
+    /**
+     * @brief Checks if a & b is non-empty.
+     */
+    static bool intersects(const uint64_t* a, const uint64_t* b, size_t n);
+
+    /**
+     * @brief Finds the lowest set bit of a.
+     * @return The bit index, or -1 if a is empty.
+     */
+    static long find_first(const uint64_t* a, size_t n);
+
+    /**
+     * @brief Finds the lowest set bit of a & b without materializing the intersection.
+     * @return The bit index, or -1 if the intersection is empty.
+     */
+    static long find_first_and(const uint64_t* a, const uint64_t* b, size_t n);
+};
+
+/**
+ * @class Bitset
+ * @brief Fixed-size dynamic bitset backed by 64-bit words, using BitsetKernels for set algebra.
+ * Bits past size() in the last word are always zero.
+ */
+class Bitset {
+private:
+    /**
+     * @brief Storage words, least significant bit first.
+     */
+    std::vector<uint64_t> words;
+
+    /**
+     * @brief Number of addressable bits.
+     */
+    size_t num_bits = 0;
+
+public:
+    /**
+     * @brief Constructs an empty bitset of size zero.
+     */
+    Bitset() = default;
+
+    /**
+     * @brief Constructs a bitset of the given size with all bits cleared.
+     * @param num_bits Number of bits.
+     */
+    explicit Bitset(size_t num_bits) : words((num_bits + 63) / 64, 0), num_bits(num_bits) {}
+
+    /**
+     * @brief Retrieves the number of addressable bits.
+     */
+    [[nodiscard]]
+    size_t size() const {
+        return num_bits;
+    }
+
+    /**
+     * @brief Retrieves the number of storage words.
+     */
+    [[nodiscard]]
+    size_t num_words() const {
+        return words.size();
+    }
+
+    /**
+     * @brief Raw access to the storage words.
+     */
+    [[nodiscard]]
+    uint64_t* data() {
+        return words.data();
+    }
+
+    [[nodiscard]]
+    const uint64_t* data() const {
+        return words.data();
+    }
+
+    void set(size_t i) { words[i >> 6] |= uint64_t{1} << (i & 63); }
+
+    void reset(size_t i) { words[i >> 6] &= ~(uint64_t{1} << (i & 63)); }
+
+    [[nodiscard]]
+    bool test(size_t i) const {
+        return (words[i >> 6] >> (i & 63)) & 1;
+    }
+
+    /**
+     * @brief Sets every addressable bit.
+     */
+    void set_all();
+
+    /**
+     * @brief Clears every bit.
+     */
+    void clear();
+
+    /**
+     * @brief Counts the set bits.
+     */
+    [[nodiscard]]
+    size_t count() const {
+        return BitsetKernels::count(words.data(), words.size());
+    }
+
+    /**
+     * @brief Checks if any bit is set.
+     */
+    [[nodiscard]]
+    bool any() const;
+
+    /**
+     * @brief Finds the lowest set bit.
+     * @return The bit index, or -1 if the bitset is empty.
+     */
+    [[nodiscard]]
+    long find_first() const {
+        return BitsetKernels::find_first(words.data(), words.size());
+    }
+
+    /**
+     * @brief Finds the lowest set bit strictly after position i.
+     * @return The bit index, or -1 if there is none.
+     */
+    [[nodiscard]]
+    long find_next(size_t i) const;
+
+    /**
+     * @brief Counts the set bits of this & other.
+     */
+    [[nodiscard]]
+    size_t and_count(const Bitset& other) const {
+        return BitsetKernels::and_count(words.data(), other.words.data(), words.size());
+    }
+
+    /**
+     * @brief Checks if this & other is non-empty.
+     */
+    [[nodiscard]]
+    bool intersects(const Bitset& other) const {
+        return BitsetKernels::intersects(words.data(), other.words.data(), words.size());
+    }
+
+    Bitset& operator&=(const Bitset& other) {
+        BitsetKernels::and_into(words.data(), words.data(), other.words.data(), words.size());
+        return *this;
+    }
+
+    Bitset& operator|=(const Bitset& other) {
+        BitsetKernels::or_into(words.data(), words.data(), other.words.data(), words.size());
+        return *this;
+    }
+
+    /**
+     * @brief Removes the bits of other from this set (this &= ~other).
+     */
+    Bitset& and_not(const Bitset& other) {
+        BitsetKernels::andnot_into(words.data(), words.data(), other.words.data(), words.size());
+        return *this;
+    }
+
+    /**
+     * @brief Assigns this = a & b and returns the number of set bits, in one pass.
+     */
+    size_t assign_and_count(const Bitset& a, const Bitset& b);
+
+    bool operator==(const Bitset& other) const {
+        return num_bits == other.num_bits && words == other.words;
+    }
+
+    /**
+     * @brief Calls f(i) for every set bit i in increasing order.
+     */
+    template <typename Function>
+    void for_each(Function&& f) const {
+        for (size_t w = 0; w < words.size(); ++w) {
+            uint64_t word = words[w];
+            while (word) {
+                f(w * 64 + static_cast<size_t>(std::countr_zero(word)));
+                word &= word - 1;
+            }
+        }
+    }
+};
+
+/**
+ * @class FixedBitset
+ * @brief Allocation-free bitset of N 64-bit words with every word loop unrolled at compile time.
+ * Mirrors the Bitset interface so search engines can be instantiated on either; intended for small
+ * instances (N <= 4) where loop bounds and heap storage dominate the cost of the set algebra.
+ * @tparam N Number of words.
+ */
+template <size_t N>
+class FixedBitset {
+private:
+    std::array<uint64_t, N> words{};
+
+    /**
+     * @brief Calls f(0), ..., f(N-1) as an unrolled fold expression.
+     */
+    template <typename Function>
+    static constexpr void unroll(Function&& f) {
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (f(I), ...);
+        }(std::make_index_sequence<N>{});
+    }
+
+public:
+    FixedBitset() = default;
+
+    /**
+     * @brief Constructs an empty bitset; the size argument only mirrors Bitset and must not exceed
+     * 64 * N.
+     */
+    explicit FixedBitset(size_t) {}
+
+    [[nodiscard]]
+    static constexpr size_t size() {
+        return N * 64;
+    }
+
+    [[nodiscard]]
+    static constexpr size_t num_words() {
+        return N;
+    }
+
+    [[nodiscard]]
+    uint64_t* data() {
+        return words.data();
+    }
+
+    [[nodiscard]]
+    const uint64_t* data() const {
+        return words.data();
+    }
+
+    void set(size_t i) { words[i >> 6] |= uint64_t{1} << (i & 63); }
+
+    void reset(size_t i) { words[i >> 6] &= ~(uint64_t{1} << (i & 63)); }
+
+    [[nodiscard]]
+    bool test(size_t i) const {
+        return (words[i >> 6] >> (i & 63)) & 1;
+    }
+
+    void clear() { words.fill(0); }
+
+    [[nodiscard]]
+    size_t count() const {
+        size_t total = 0;
+        unroll([&](size_t i) { total += std::popcount(words[i]); });
+        return total;
+    }
+
+    [[nodiscard]]
+    bool any() const {
+        uint64_t acc = 0;
+        unroll([&](size_t i) { acc |= words[i]; });
+        return acc != 0;
+    }
+
+    [[nodiscard]]
+    long find_first() const {
+        for (size_t i = 0; i < N; ++i) {
+            if (words[i]) {
+                return static_cast<long>(i * 64 + std::countr_zero(words[i]));
+            }
+        }
+        return -1;
+    }
+
+    [[nodiscard]]
+    size_t and_count(const FixedBitset& other) const {
+        size_t total = 0;
+        unroll([&](size_t i) { total += std::popcount(words[i] & other.words[i]); });
+        return total;
+    }
+
+    [[nodiscard]]
+    bool intersects(const FixedBitset& other) const {
+        uint64_t acc = 0;
+        unroll([&](size_t i) { acc |= words[i] & other.words[i]; });
+        return acc != 0;
+    }
+
+    FixedBitset& operator&=(const FixedBitset& other) {
+        unroll([&](size_t i) { words[i] &= other.words[i]; });
+        return *this;
+    }
+
+    FixedBitset& operator|=(const FixedBitset& other) {
+        unroll([&](size_t i) { words[i] |= other.words[i]; });
+        return *this;
+    }
+
+    FixedBitset& and_not(const FixedBitset& other) {
+        unroll([&](size_t i) { words[i] &= ~other.words[i]; });
+        return *this;
+    }
+
+    size_t assign_and_count(const FixedBitset& a, const FixedBitset& b) {
+        size_t total = 0;
+        unroll([&](size_t i) {
+            words[i] = a.words[i] & b.words[i];
+            total += std::popcount(words[i]);
+        });
+        return total;
+    }
+
+    bool operator==(const FixedBitset& other) const { return words == other.words; }
+
+    template <typename Function>
+    void for_each(Function&& f) const {
+        for (size_t w = 0; w < N; ++w) {
+            uint64_t word = words[w];
+            while (word) {
+                f(w * 64 + static_cast<size_t>(std::countr_zero(word)));
+                word &= word - 1;
+            }
+        }
+    }
+};
+
+#endif  // BITSET_H
@@ -0,0 +1,81 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef BOUNDS_H
+#define BOUNDS_H
+
+#include "graph.h"
+#include "graph_summary.h"
+#include "mcis_options.h"
+
+/**
+ * @class MCISBounds
+ * @brief Cheap upper bounds on the MCIS size of a graph pair, computed from the two graphs'
+ * summaries in time proportional to the number of distinct labels, degrees and levels. They let a
+ * batch of pairs be screened before any search: a pair whose bound does not exceed the best size
+ * known so far cannot improve on it.
+ */
+class MCISBounds {
+public:
+    /**
+     * @brief Label bound: for every label, the smaller of the two graphs' node counts with it.
+     */
+    static int label_bound(const GraphSummary& s1, const GraphSummary& s2);
+
+    /**
+     * @brief Degree-sequence bound. A node u with d1 distinct neighbors matched to v with d2 lies
+     * in a common induced subgraph of at most 1 + min(d1, d2) + min(n1 - 1 - d1, n2 - 1 - d2)
+     * nodes, as its neighbors and non-neighbors in the subgraph must be neighbors and
+     * non-neighbors in both graphs. The bound is the largest k such that, counting per label only
+     * the nodes with a partner allowing k, the label bound still reaches k.
+     */
+    static int degree_bound(const GraphSummary& s1, const GraphSummary& s2);
+
+    /**
+     * @brief Level-histogram bound for level-constrained mode: per label, every g1 node at level l
+     * needs a partner within max_level_offset levels, so level l contributes at most the number
+     * of such g2 nodes (and symmetrically for g2). Falls back to the label bound when the level
+     * constraint does not apply.
+     */
+    static int level_histogram_bound(const GraphSummary& s1, const GraphSummary& s2,
+                                     const MCISOptions& options);
+
+    /**
+     * @brief Colouring bound on the product (association) graph. The pairs sharing a g1 node, or
+     * sharing a g2 node, are independent, so a set of nodes covering every admissible (label,
+     * level) combination yields a colouring and thus a clique bound. The smallest such cover
+     * equals the maximum matching between the (label, level) histograms (König's theorem), found
+     * greedily since admissible levels form sliding windows. Without the level constraint this is
+     * the label bound.
+     */
+    static int colouring_bound(const GraphSummary& s1, const GraphSummary& s2,
+                               const MCISOptions& options);
+
+    /**
+     * @brief Retrieves the tightest of all bounds.
+     */
+    static int upper_bound(const GraphSummary& s1, const GraphSummary& s2,
+                           const MCISOptions& options = MCISOptions());
+
+    /**
+     * @brief Retrieves the tightest bound for two graphs from their cached summaries.
+     */
+    static int upper_bound(const Graph& g1, const Graph& g2,
+                           const MCISOptions& options = MCISOptions());
+
+    /**
+     * @brief Checks if a pair may hold a common induced subgraph larger than best.
+     * @param best Size of the best common subgraph known so far.
+     * @return False if the pair can be skipped.
+     */
+    static bool can_improve(const Graph& g1, const Graph& g2, int best,
+                            const MCISOptions& options = MCISOptions()) {
+        return upper_bound(g1, g2, options) > best;
+    }
+};
+
+#endif  // BOUNDS_H
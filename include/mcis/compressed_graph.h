@@ -0,0 +1,219 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef COMPRESSED_GRAPH_H
+#define COMPRESSED_GRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "graph.h"
+
+/**
+ * @brief Number of consecutive nodes per block of a CompressedGraph; random access decodes at
+ * most this many records from the start of a block.
+ */
+constexpr int COMPRESSED_BLOCK_NODES = 32;
+
+/**
+ * @class CompressedGraph
+ * @brief Immutable, compressed copy of a Graph for very large CDAGs.
+ *
+ * Nodes are numbered like IndexedGraph (lexicographic order of their IDs). Every node's sorted
+ * children are stored as a varint record: the out-degree, the first child as a zigzag offset from
+ * the first child of the previous node in the block (consecutive IDs tend to have nearby
+ * children), then the gaps minus one between consecutive children, each followed by its zigzag
+ * weight unless the graph is unweighted. IDs are front-coded (shared prefix length and suffix).
+ * Both streams restart at every block of COMPRESSED_BLOCK_NODES nodes, whose byte offsets give
+ * random access. Only children are stored, as in Graph, which keeps parent counts only; in-degrees
+ * and levels are recomputed in one sequential pass when needed. Generated CDAGs take about 2 to
+ * 2.5 bytes per edge for adjacency.
+ */
+class CompressedGraph {
+private:
+    int num_nodes = 0;
+    int num_edges = 0;
+    bool weighted = false;
+    std::vector<OpLabel> labels;
+
+    /**
+     * @brief Adjacency records and the byte offset of every block's first record.
+     */
+    std::vector<uint8_t> adjacency;
+    std::vector<uint64_t> adjacency_blocks;
+
+    /**
+     * @brief Front-coded IDs and the byte offset of every block's first (complete) ID.
+     */
+    std::vector<uint8_t> id_bytes;
+    std::vector<uint64_t> id_blocks;
+
+    [[nodiscard]]
+    static uint64_t read_varint(const uint8_t*& p) {
+        uint64_t value = *p & 0x7f;
+        for (int shift = 7; *p++ & 0x80; shift += 7) {
+            value |= static_cast<uint64_t>(*p & 0x7f) << shift;
+        }
+        return value;
+    }
+
+    [[nodiscard]]
+    static int64_t unzigzag(uint64_t value) {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    /**
+     * @brief Finds the adjacency record of node v.
+     * @param v Node index.
+     * @param anchor Output first child of the previous node of the block, from which v's first
+     * child is offset.
+     * @return Pointer to the record.
+     */
+    const uint8_t* seek(int v, int64_t& anchor) const;
+
+    /**
+     * @brief Decodes one adjacency record, advancing p past it and updating the anchor.
+     */
+    template <typename Visitor>
+    void decode(const uint8_t*& p, int64_t& anchor, Visitor&& visit) const {
+        const uint64_t degree = read_varint(p);
+        int64_t child = anchor;
+        for (uint64_t i = 0; i < degree; ++i) {
+            child = i == 0 ? anchor + unzigzag(read_varint(p))
+                           : child + 1 + static_cast<int64_t>(read_varint(p));
+            const int weight = weighted ? static_cast<int>(unzigzag(read_varint(p))) : 0;
+            visit(static_cast<int>(child), weight);
+            if (i == 0) {
+                anchor = child;
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Constructs an empty compressed graph.
+     */
+    CompressedGraph() = default;
+
+    /**
+     * @brief Compresses a graph.
+     * @param graph Graph to compress.
+     */
+    explicit CompressedGraph(const Graph& graph);
+
+    [[nodiscard]]
+    int get_num_nodes() const {
+        return num_nodes;
+    }
+
+    [[nodiscard]]
+    int get_num_edges() const {
+        return num_edges;
+    }
+
+    /**
+     * @brief Indicates if edge weights are stored; they are elided when every weight is zero.
+     */
+    [[nodiscard]]
+    bool is_weighted() const {
+        return weighted;
+    }
+
+    [[nodiscard]]
+    OpLabel get_label(int v) const {
+        return labels[v];
+    }
+
+    /**
+     * @brief Decodes the ID of a node.
+     * @param v Node index.
+     * @return The node's ID.
+     */
+    [[nodiscard]]
+    std::string get_id(int v) const;
+
+    /**
+     * @brief Finds a node by ID with a binary search over the blocks.
+     * @param id Node ID.
+     * @return The node's index, or -1 if the node does not exist.
+     */
+    [[nodiscard]]
+    int get_index(const std::string& id) const;
+
+    /**
+     * @brief Retrieves the number of children of a node.
+     */
+    [[nodiscard]]
+    int get_out_degree(int v) const;
+
+    /**
+     * @brief Calls visit(child, weight) for every child of node v, in ascending order.
+     */
+    template <typename Visitor>
+    void for_each_child(int v, Visitor&& visit) const {
+        int64_t anchor = 0;
+        const uint8_t* p = seek(v, anchor);
+        decode(p, anchor, visit);
+    }
+
+    /**
+     * @brief Calls visit(node, child, weight) for every edge, in node order, decoding the
+     * adjacency sequentially without any seeks.
+     */
+    template <typename Visitor>
+    void for_each_edge(Visitor&& visit) const {
+        const uint8_t* p = adjacency.data();
+        int64_t anchor = 0;
+        for (int v = 0; v < num_nodes; ++v) {
+            if (v % COMPRESSED_BLOCK_NODES == 0) {
+                anchor = v;
+            }
+            decode(p, anchor, [&](int child, int weight) { visit(v, child, weight); });
+        }
+    }
+
+    /**
+     * @brief Computes the number of parents of every node in one sequential pass.
+     */
+    [[nodiscard]]
+    std::vector<int> get_in_degrees() const;
+
+    /**
+     * @brief Computes topological levels (longest path from a source) with Kahn's algorithm.
+     * @param levels Output level of every node; cleared if the graph has a cycle.
+     * @return True if the graph is a DAG, false otherwise.
+     */
+    bool compute_levels(std::vector<int>& levels) const;
+
+    /**
+     * @brief Decompresses the graph.
+     * @return A Graph equal to the compressed one.
+     */
+    [[nodiscard]]
+    Graph to_graph() const;
+
+    /**
+     * @brief Retrieves the size of the adjacency records and their block offsets in bytes.
+     */
+    [[nodiscard]]
+    size_t get_adjacency_bytes() const {
+        return adjacency.size() + adjacency_blocks.size() * sizeof(uint64_t);
+    }
+
+    /**
+     * @brief Retrieves the size of all stored data (adjacency, IDs and labels) in bytes.
+     */
+    [[nodiscard]]
+    size_t get_memory_bytes() const {
+        return get_adjacency_bytes() + id_bytes.size() + id_blocks.size() * sizeof(uint64_t)
+               + labels.size();
+    }
+};
+
+#endif  // COMPRESSED_GRAPH_H
@@ -10,11 +10,15 @@
 
 #include <omp.h>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdlib>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -22,8 +26,53 @@
 
 #include "node.h"
 
+class Bitset;
+class IndexedGraph;
+struct GraphSummary;
+
 constexpr int MVM_PARALLEL_THRESHOLD = 100;
 
+/**
+ * @brief Largest number of edits a graph keeps in its edit log; older versions are dropped from
+ * the log once it grows beyond this.
+ */
+constexpr size_t GRAPH_EDIT_LOG_LIMIT = 4096;
+
+/**
+ * @brief Number of nodes from which node filtering and bulk removal run their passes in parallel.
+ */
+constexpr int FILTER_PARALLEL_THRESHOLD = 4096;
+
+/**
+ * @enum GraphEditKind
+ * @brief Kind of a logged graph modification: a node added, removed or relabeled, or an edge
+ * added, removed or reweighted.
+ */
+enum class GraphEditKind { ADD_NODE, REMOVE_NODE, SET_LABEL, ADD_EDGE, REMOVE_EDGE, CHANGE_WEIGHT };
+
+/**
+ * @struct GraphEdit
+ * @brief One entry of a graph's edit log.
+ */
+struct GraphEdit {
+    GraphEditKind kind;
+
+    /**
+     * @brief Node the edit applies to, or the source of an edge.
+     */
+    std::string from;
+
+    /**
+     * @brief Target of an edge; empty for node edits.
+     */
+    std::string to;
+
+    /**
+     * @brief Version of the graph the edit was applied to.
+     */
+    int version;
+};
+
 /**
  * @class Graph
  * @brief Represents a directed graph using an adjacency list.
@@ -37,22 +86,204 @@ private:
     std::unordered_map<std::string, Node*> nodes;
 
     /**
-     * @brief Cache for frequently accessed data to improve performance.
+     * @brief Values derived from one version of the graph, each computed at most once under
+     * std::call_once, so threads reading an unmodified graph can share them safely.
      */
-    mutable bool dag_cache_valid = false;
-    mutable bool dag_cache_result = false;
+    struct DerivedCache {
+        std::once_flag dag_once;
+        bool dag = false;
+        std::once_flag indexed_once;
+        std::shared_ptr<const IndexedGraph> indexed;
+        std::once_flag summary_once;
+        std::shared_ptr<const GraphSummary> summary;
+        std::once_flag snapshot_once;
+        std::shared_ptr<const Graph> snapshot;
+    };
+
+    /**
+     * @brief Derived values of the current version, created on first use; every modification
+     * detaches it, so readers still holding the old block keep consistent values.
+     */
+    mutable std::atomic<std::shared_ptr<DerivedCache>> cache;
     mutable int version = 0;
 
+    /**
+     * @brief Retrieves the derived-value block of the current version, creating it if needed.
+     */
+    std::shared_ptr<DerivedCache> derived() const;
+
+    /**
+     * @brief Replaces the (empty) graph by a deep copy of another, with children remapped to the
+     * new nodes.
+     */
+    void copy_from(const Graph& other);
+
     /**
      * @brief Invalidates all caches when the graph is modified.
      */
     void invalidate_caches() const;
 
+    /**
+     * @brief Deletes a set of nodes and every edge touching them, without invalidating caches.
+     */
+    void erase_nodes(const std::unordered_set<Node*>& removal_set);
+
+    /**
+     * @brief Retrieves the indexed snapshot if it was already built for the current version,
+     * without building it. Only for modifying methods, which have exclusive access.
+     */
+    [[nodiscard]]
+    std::shared_ptr<const IndexedGraph> get_cached_indexed() const;
+
+    /**
+     * @brief Retrieves the node of every index of an indexed snapshot of the graph.
+     */
+    std::vector<Node*> get_indexed_nodes(const IndexedGraph& indexed) const;
+
+    /**
+     * @brief Deletes the nodes marked in a bit vector over the indices of the current snapshot,
+     * in one pass over the snapshot's rows: surviving nodes drop their marked children and get
+     * their parent counts from their unmarked parents, so no hash set is probed per edge.
+     * @return Number of nodes removed.
+     */
+    int erase_marked(const IndexedGraph& indexed, const std::vector<Node*>& indexed_nodes,
+                     const Bitset& marked);
+
+    /**
+     * @brief Edits applied to versions edit_log_floor and later, in order.
+     */
+    std::vector<GraphEdit> edit_log;
+    int edit_log_floor = 0;
+
+    /**
+     * @brief Appends an edit applied to the current version, dropping the oldest versions from
+     * the log if it exceeds GRAPH_EDIT_LOG_LIMIT. Called before the version is bumped.
+     */
+    void record_edit(GraphEditKind kind, const std::string& from, const std::string& to = "");
+
+    /**
+     * @brief Empties the edit log after a change too large to record, so it starts at the
+     * current version.
+     */
+    void reset_edit_log();
+
     /**
      * @brief Indicates if the graph is weighted (edges have weights).
      */
     bool is_weighted = false;
 
+public:
+    /**
+     * @class BatchEdit
+     * @brief Buffers node and edge changes to a graph and applies them in one pass.
+     *
+     * Nodes are referred to by integer handles, so every ID is hashed once per batch rather than
+     * once per edge. On commit (or destruction), new nodes are created first, then the edge
+     * operations are sorted by endpoints, each edge's operations are collapsed to their net
+     * effect (with the same outcome as applying them one by one) and the children of every source
+     * are reserved before insertion, and finally removed nodes are deleted in a single sweep. The
+     * caches are invalidated and the version bumped once per commit, and only if something
+     * changed.
+     */
+    class BatchEdit {
+    private:
+        struct EdgeOperation {
+            int from;
+            int to;
+            int weight;
+            bool remove;
+        };
+
+        Graph& graph;
+
+        /**
+         * @brief ID of every handle, its node (null until a new node is created) and, for new
+         * nodes, their label.
+         */
+        std::vector<std::string> ids;
+        std::vector<Node*> handle_nodes;
+        std::vector<OpLabel> new_labels;
+        std::vector<bool> is_new;
+        std::unordered_map<std::string, int> handles;
+
+        std::vector<EdgeOperation> edge_operations;
+        std::vector<int> removed_nodes;
+
+        [[nodiscard]]
+        bool valid(int handle) const {
+            return handle >= 0 && handle < static_cast<int>(ids.size());
+        }
+
+    public:
+        /**
+         * @brief Starts a batch on a graph, which must outlive the batch and not be modified
+         * directly until the batch is committed.
+         */
+        explicit BatchEdit(Graph& graph);
+
+        BatchEdit(const BatchEdit&) = delete;
+        BatchEdit& operator=(const BatchEdit&) = delete;
+
+        /**
+         * @brief Commits the pending changes.
+         */
+        ~BatchEdit();
+
+        /**
+         * @brief Reserves room for the changes to come.
+         * @param num_nodes Expected number of added nodes.
+         * @param num_edges Expected number of edge operations.
+         */
+        void reserve(size_t num_nodes, size_t num_edges);
+
+        /**
+         * @brief Queues a new node.
+         * @param id Unique identifier of the node.
+         * @param label Operation performed by the node.
+         * @return Handle of the node, or -1 if a node with the same ID exists or is queued.
+         */
+        int add_node(const std::string& id, OpLabel label = OpLabel::NONE);
+
+        /**
+         * @brief Looks up the handle of an existing or queued node.
+         * @param id Node ID.
+         * @return Handle of the node, or -1 if there is no such node.
+         */
+        int node(const std::string& id);
+
+        /**
+         * @brief Queues a directed edge. As with Graph::add_edge, an existing edge keeps its
+         * weight.
+         * @return True if the edge was queued, false for invalid handles or a self-loop.
+         */
+        bool add_edge(int from, int to, int weight);
+
+        /**
+         * @brief Queues a directed edge between nodes given by ID.
+         * @return True if the edge was queued, false for unknown IDs or a self-loop.
+         */
+        bool add_edge(const std::string& from_id, const std::string& to_id, int weight);
+
+        /**
+         * @brief Queues the removal of a directed edge.
+         * @return True if the removal was queued, false for invalid handles.
+         */
+        bool remove_edge(int from, int to);
+
+        /**
+         * @brief Queues the removal of a node and its edges. Node removals apply after every
+         * other change of the batch, so edges queued to a removed node are dropped.
+         * @return True if the removal was queued, false for an invalid handle.
+         */
+        bool remove_node(int handle);
+
+        /**
+         * @brief Applies the pending changes; the batch can then be reused with fresh handles.
+         * @return Number of nodes and edges added or removed.
+         */
+        int commit();
+    };
+
 public:
     /**
      * @brief Default constructor that initializes an empty graph.
@@ -97,10 +328,12 @@ public:
     ~Graph();
 
     /**
-     * @brief Checks if the graph is a Directed Acyclic Graph (DAG).
+     * @brief Checks if the graph is a Directed Acyclic Graph (DAG). The result is computed once
+     * per version; concurrent calls on an unmodified graph are safe.
      * @return True if the graph is a DAG, false otherwise.
      */
-    bool is_dag();
+    [[nodiscard]]
+    bool is_dag() const;
 
     /**
      * @brief Prints the graph as node:[adjacency list].
@@ -110,18 +343,28 @@ public:
     /**
      * @brief Adds a node with the given ID to the graph.
      * @param id Unique identifier for the new node.
+     * @param label Operation performed by the node.
      * @return True if the node was added successfully, false if a node with the same ID already
      * exists.
      */
-    bool add_node(const std::string& id);
+    bool add_node(const std::string& id, OpLabel label = OpLabel::NONE);
 
     /**
      * @brief Adds multiple nodes with the given IDs to the graph.
      * @param ids Vector of unique identifiers for the new nodes.
+     * @param label Operation performed by every new node.
      * @return True if all nodes were added successfully, false if any node with the same ID already
      * exists.
      */
-    bool add_node_set(const std::vector<std::string>& ids);
+    bool add_node_set(const std::vector<std::string>& ids, OpLabel label = OpLabel::NONE);
+
+    /**
+     * @brief Sets the operation label of the node with the given ID.
+     * @param id Unique identifier of the node.
+     * @param label New operation label.
+     * @return True if the label was set, false if the node does not exist.
+     */
+    bool set_node_label(const std::string& id, OpLabel label);
 
     /**
      * @brief Removes the node with the given ID from the graph.
@@ -191,6 +434,31 @@ public:
     [[nodiscard]]
     const std::unordered_map<std::string, Node*>& get_nodes() const;
 
+    /**
+     * @brief Retrieves the label, degree and level summary of the graph, computing it on the first
+     * call after a modification.
+     * @return Constant reference to the cached summary, valid until the graph is modified.
+     */
+    [[nodiscard]]
+    const GraphSummary& get_summary() const;
+
+    /**
+     * @brief Retrieves the indexed view of the graph (dense indices, adjacency rows and
+     * topological levels), built once per version.
+     * @return Shared pointer to the view, which outlives later modifications of the graph.
+     */
+    [[nodiscard]]
+    std::shared_ptr<const IndexedGraph> get_indexed() const;
+
+    /**
+     * @brief Publishes an immutable copy of the current version. Calls between two
+     * modifications share one copy. The writer (or a thread holding the writer's lock) takes
+     * snapshots; any number of reader threads can then use them while the graph keeps changing.
+     * @return Shared pointer to the copy.
+     */
+    [[nodiscard]]
+    std::shared_ptr<const Graph> snapshot() const;
+
     /**
      * @brief Equality operator to compare two graphs.
      * @return True if the graphs are equal, false otherwise.
@@ -216,12 +484,74 @@ public:
      */
 
     /**
-     * @brief Removes multiple nodes efficiently in a single operation.
+     * @brief Removes multiple nodes efficiently in a single operation. If the indexed snapshot is
+     * cached, the nodes are removed in one pass over its rows instead of probing a hash set.
      * @param node_ids Vector of node IDs to remove.
      * @return Number of nodes successfully removed.
      */
     int remove_nodes_bulk(const std::vector<std::string>& node_ids);
 
+    /**
+     * @brief Removes every node matching a predicate, with its edges. If the indexed snapshot is
+     * cached, nodes to remove are marked in a bit vector and removed in one O(V+E) pass over it
+     * (parallel for large graphs); otherwise this falls back to remove_nodes_bulk.
+     * @param remove Predicate selecting the nodes to remove; it may be called concurrently.
+     * @return Number of nodes removed.
+     */
+    int remove_nodes_if(const std::function<bool(const Node&)>& remove);
+
+    /**
+     * @brief Builds the subgraph induced by the nodes matching a predicate in one O(V+E) pass
+     * over the indexed snapshot (parallel for large graphs), e.g. to drop nodes whose labels are
+     * absent from another graph before a search.
+     * @param keep Predicate selecting the nodes to keep; it may be called concurrently.
+     * @return The induced subgraph, with fresh nodes.
+     */
+    [[nodiscard]]
+    Graph filter_nodes(const std::function<bool(const Node&)>& keep) const;
+
+    /**
+     * @brief Builds the subgraph induced by the given node IDs, with fresh nodes and every edge
+     * between them. Unknown IDs are ignored.
+     * @param node_ids IDs of the nodes to keep.
+     * @return The induced subgraph.
+     */
+    [[nodiscard]]
+    Graph induced_subgraph(const std::vector<std::string>& node_ids) const;
+
+    /**
+     * @brief Splits the graph into weakly connected components, ignoring edge directions.
+     * @return Node IDs of each component, each sorted ascending, with components ordered by their
+     * smallest ID.
+     */
+    [[nodiscard]]
+    std::vector<std::vector<std::string>> get_weakly_connected_components() const;
+
+    /**
+     * @brief Checks if the graph is a forest: ignoring directions, it has no cycles, so every
+     * weakly connected component is a tree. Anti-parallel edges and self-loops count as cycles.
+     * @return True if the graph is a forest, false otherwise.
+     */
+    [[nodiscard]]
+    bool is_forest() const;
+
+    /**
+     * @brief Writes the graph in a compact binary format: a magic tag, then every node (ID and
+     * label) in ID order and every edge as node positions and weight.
+     * @param out Binary output stream.
+     * @return True if everything was written, false otherwise.
+     */
+    bool write_binary(std::ostream& out) const;
+
+    /**
+     * @brief Replaces the graph by one read with write_binary. Several graphs may follow each other
+     * in one stream.
+     * @param in Binary input stream, positioned at the start of a graph.
+     * @return True if a complete graph was read, false if the stream is malformed (the graph is
+     * left empty then).
+     */
+    bool read_binary(std::istream& in);
+
     /**
      * @brief Reserves memory for expected number of nodes to reduce allocations.
      * @param expected_size Expected number of nodes.
@@ -237,6 +567,16 @@ public:
         return version;
     }
 
+    /**
+     * @brief Retrieves the edits made since a version, e.g. to repair a mapping computed on it.
+     * The log covers single-node and single-edge modifications and batches of up to
+     * GRAPH_EDIT_LOG_LIMIT operations; copies, moves and reads start a fresh log.
+     * @param since Version the edits are wanted from.
+     * @param edits Output edits applied to version since and later, in order.
+     * @return True if the log covers every edit since that version, false if some were dropped.
+     */
+    bool get_edits_since(int since, std::vector<GraphEdit>& edits) const;
+
     /**
      * @brief Static factory method for MVM dataflow CDAG creation from actual matrix and vector
      * @param mat 2D vector representing the matrix
@@ -255,6 +595,28 @@ public:
      */
     [[nodiscard]]
     static Graph create_mvm_graph_from_dimensions(int m, int n);
+
+    /**
+     * @brief Static factory method for radix-2 decimation-in-time FFT dataflow CDAG creation.
+     * Inputs x0..x{n-1} and twiddle factors w0..w{n/2-1} feed log2(n) stages of butterflies, each
+     * a twiddle multiplication followed by an addition and a subtraction.
+     * @param n Number of points; must be a power of two
+     * @return Graph representing the FFT dataflow CDAG, or an empty graph if n is invalid
+     */
+    [[nodiscard]]
+    static Graph create_fft_graph(int n);
+
+    /**
+     * @brief Static factory method for multi-level two-tap discrete wavelet transform CDAG
+     * creation. Each level convolves pairs of the previous approximation with the low-pass (h0,
+     * h1) and high-pass (g0, g1) filter taps, producing approximation and detail coefficients.
+     * @param n Signal length; must be divisible by 2^levels
+     * @param levels Number of decomposition levels
+     * @return Graph representing the DWT dataflow CDAG, or an empty graph if the arguments are
+     * invalid
+     */
+    [[nodiscard]]
+    static Graph create_dwt_graph(int n, int levels);
 };
 
 #endif  // GRAPH_H
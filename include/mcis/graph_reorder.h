@@ -0,0 +1,72 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef GRAPH_REORDER_H
+#define GRAPH_REORDER_H
+
+#include <utility>
+#include <vector>
+
+#include "indexed_graph.h"
+#include "mcis_options.h"
+
+/**
+ * @class GraphReorder
+ *
+ * Node orders of indexed graphs, shared by the search orderings of the exact finders and the
+ * locality-improving renumbering passes. An order (node order[i] becomes node i) is applied by
+ * IndexedGraph::reordered; mappings between index spaces are carried over with the inverse
+ * permutations. Mappings by node ID (NodeMapping) do not depend on the numbering.
+ */
+class GraphReorder {
+public:
+    /**
+     * @brief Sorts the nodes of a graph. Ties keep the current order.
+     * @param graph Graph whose nodes are ordered.
+     * @param other The graph it is matched against, for label rarity.
+     * @param ordering Ordering to compute.
+     * @return All node indices, in order.
+     */
+    static std::vector<int> node_order(const IndexedGraph& graph, const IndexedGraph& other,
+                                       VertexOrdering ordering);
+
+    /**
+     * @brief Sorts the nodes of a graph on its own, as a memory layout; label rarity counts the
+     * labels of the graph only.
+     */
+    static std::vector<int> node_order(const IndexedGraph& graph, VertexOrdering ordering) {
+        return node_order(graph, graph, ordering);
+    }
+
+    /**
+     * @brief Inverts an order into the new index of every node.
+     * @param order Node indices in their new order.
+     * @return rank, with rank[order[i]] == i.
+     */
+    static std::vector<int> invert(const std::vector<int>& order);
+
+    /**
+     * @brief Carries an index mapping over to renumbered graphs.
+     * @param mapping Target index of every source node, or -1 if it is unmapped.
+     * @param rank1 New index of every source node (see invert).
+     * @param rank2 New index of every target node.
+     * @return The mapping between the renumbered graphs.
+     */
+    static std::vector<int> remap(const std::vector<int>& mapping, const std::vector<int>& rank1,
+                                  const std::vector<int>& rank2);
+
+    /**
+     * @brief Carries matched (g1 node, g2 node) pairs over to renumbered graphs.
+     * @param pairs Matched pairs, renumbered in place.
+     * @param rank1 New index of every g1 node.
+     * @param rank2 New index of every g2 node.
+     */
+    static void remap(std::vector<std::pair<int, int>>& pairs, const std::vector<int>& rank1,
+                      const std::vector<int>& rank2);
+};
+
+#endif  // GRAPH_REORDER_H
@@ -0,0 +1,111 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef GRAPH_SUMMARY_H
+#define GRAPH_SUMMARY_H
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "graph_view.h"
+#include "indexed_graph.h"
+#include "node.h"
+
+/**
+ * @struct GraphSummary
+ * @brief Label, degree and level histograms of a graph, small enough that MCIS upper bounds can be
+ * computed from two summaries without touching the graphs.
+ */
+struct GraphSummary {
+    int num_nodes = 0;
+    int num_edges = 0;
+
+    /**
+     * @brief Indicates if the graph is acyclic; level histograms are only filled for DAGs.
+     */
+    bool dag = false;
+
+    /**
+     * @brief Number of nodes with each label.
+     */
+    std::array<int, NUM_OP_LABELS> label_counts{};
+
+    /**
+     * @brief For each label, (number of distinct neighbors, number of nodes) pairs sorted by
+     * neighbor count; a neighbor is a child or a parent other than the node itself.
+     */
+    std::array<std::vector<std::pair<int, int>>, NUM_OP_LABELS> degree_histograms;
+
+    /**
+     * @brief For each label, the number of nodes on every topological level; empty for cyclic
+     * graphs.
+     */
+    std::array<std::vector<int>, NUM_OP_LABELS> level_histograms;
+
+    /**
+     * @brief Constructs the summary of an empty graph.
+     */
+    GraphSummary() = default;
+
+    /**
+     * @brief Summarizes an indexed graph in linear time.
+     * @param graph Graph to summarize.
+     */
+    explicit GraphSummary(const IndexedGraph& graph);
+
+    /**
+     * @brief Summarizes any graph view in one streaming pass, e.g. a procedural view far too
+     * large to materialize. Memory stays proportional to the histograms and the largest degree.
+     * @param graph Graph view to summarize.
+     */
+    template <typename View>
+        requires(!std::same_as<View, IndexedGraph> && GraphView<View>)
+    explicit GraphSummary(const View& graph)
+        : num_nodes(graph.get_num_nodes()), num_edges(graph.get_num_edges()),
+          dag(graph.is_dag()) {
+        std::array<std::map<int, int>, NUM_OP_LABELS> degrees;
+        if (dag) {
+            for (auto& histogram : level_histograms) {
+                histogram.assign(graph.get_num_levels(), 0);
+            }
+        }
+        std::vector<int> neighbors;
+        for (int v = 0; v < num_nodes; ++v) {
+            const int label = static_cast<int>(graph.get_label(v));
+            label_counts[label]++;
+
+            // Views need not visit neighbors in order, so shared ones are found by sorting
+            neighbors.clear();
+            graph.for_each_child(v, [&](int child, int) {
+                if (child != v) {
+                    neighbors.push_back(child);
+                }
+            });
+            graph.for_each_parent(v, [&](int parent) {
+                if (parent != v) {
+                    neighbors.push_back(parent);
+                }
+            });
+            std::sort(neighbors.begin(), neighbors.end());
+            const int distinct = static_cast<int>(
+                std::unique(neighbors.begin(), neighbors.end()) - neighbors.begin());
+            degrees[label][distinct]++;
+
+            if (dag) {
+                level_histograms[label][graph.get_level(v)]++;
+            }
+        }
+        for (int label = 0; label < NUM_OP_LABELS; ++label) {
+            degree_histograms[label].assign(degrees[label].begin(), degrees[label].end());
+        }
+    }
+};
+
+#endif  // GRAPH_SUMMARY_H
@@ -0,0 +1,464 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef GRAPH_VIEW_H
+#define GRAPH_VIEW_H
+
+#include <concepts>
+#include <string>
+
+#include "node.h"
+
+/**
+ * @concept GraphView
+ * @brief Read-only, densely indexed graph: nodes 0..n-1 with labels, IDs and topological levels,
+ * whose children (with edge weights) and parents are visited on demand. IndexedGraph models it by
+ * storing everything; the procedural views below compute it from the generator parameters, so
+ * they take constant memory however large the graph. GraphSummary (and thus MCISBounds) and
+ * IndexedGraph accept any view.
+ */
+template <typename G>
+concept GraphView = requires(const G& graph, int v) {
+    { graph.get_num_nodes() } -> std::convertible_to<int>;
+    { graph.get_num_edges() } -> std::convertible_to<int>;
+    { graph.get_id(v) } -> std::convertible_to<std::string>;
+    { graph.get_label(v) } -> std::same_as<OpLabel>;
+    { graph.get_out_degree(v) } -> std::convertible_to<int>;
+    { graph.get_in_degree(v) } -> std::convertible_to<int>;
+    { graph.is_dag() } -> std::convertible_to<bool>;
+    { graph.get_level(v) } -> std::convertible_to<int>;
+    { graph.get_num_levels() } -> std::convertible_to<int>;
+    graph.for_each_child(v, [](int, int) {});
+    graph.for_each_parent(v, [](int) {});
+};
+
+/**
+ * @class MVMView
+ * @brief Procedural view of Graph::create_mvm_graph_from_dimensions(m, n), with the same node
+ * IDs, labels and edges. Nodes are numbered as the matrix inputs (row-major), the vector inputs,
+ * the products (row-major) and the accumulators (by set, then row).
+ */
+class MVMView {
+private:
+    int m = 0;
+    int n = 0;
+
+    [[nodiscard]]
+    int vec_base() const {
+        return m * n;
+    }
+
+    [[nodiscard]]
+    int product_base() const {
+        return m * n + n;
+    }
+
+    [[nodiscard]]
+    int acc_base() const {
+        return 2 * m * n + n;
+    }
+
+public:
+    /**
+     * @brief Creates the view; it is empty if the dimensions are invalid or the graph would have
+     * more than INT_MAX nodes or edges.
+     * @param m Number of rows in the matrix.
+     * @param n Number of columns in the matrix.
+     */
+    MVMView(int m, int n);
+
+    [[nodiscard]]
+    int get_num_nodes() const;
+
+    [[nodiscard]]
+    int get_num_edges() const;
+
+    [[nodiscard]]
+    std::string get_id(int v) const;
+
+    [[nodiscard]]
+    OpLabel get_label(int v) const;
+
+    [[nodiscard]]
+    int get_out_degree(int v) const;
+
+    [[nodiscard]]
+    int get_in_degree(int v) const;
+
+    [[nodiscard]]
+    bool is_dag() const {
+        return true;
+    }
+
+    [[nodiscard]]
+    int get_level(int v) const;
+
+    [[nodiscard]]
+    int get_num_levels() const {
+        return m == 0 ? 0 : (n >= 2 ? n + 1 : 2);
+    }
+
+    /**
+     * @brief Calls visit(child, weight) for every child of node v.
+     */
+    template <typename Visitor>
+    void for_each_child(int v, Visitor&& visit) const {
+        if (v < vec_base()) {
+            visit(product_base() + v, 0);
+        } else if (v < product_base()) {
+            for (int i = 0; i < m; ++i) {
+                visit(product_base() + i * n + (v - vec_base()), 0);
+            }
+        } else if (v < acc_base()) {
+            if (n >= 2) {
+                visit(acc_base() + (v - product_base()) / n, 0);
+            }
+        } else if (v + m < get_num_nodes()) {
+            visit(v + m, 0);
+        }
+    }
+
+    /**
+     * @brief Calls visit(parent) for every parent of node v.
+     */
+    template <typename Visitor>
+    void for_each_parent(int v, Visitor&& visit) const {
+        if (v < product_base()) {
+            return;
+        }
+        if (v < acc_base()) {
+            const int p = v - product_base();
+            visit(p);
+            visit(vec_base() + p % n);
+        } else if (v < acc_base() + m) {
+            const int i = v - acc_base();
+            for (int j = 0; j < n; ++j) {
+                visit(product_base() + i * n + j);
+            }
+        } else {
+            visit(v - m);
+        }
+    }
+};
+
+/**
+ * @class FFTView
+ * @brief Procedural view of Graph::create_fft_graph(n), with the same node IDs, labels and
+ * edges. Nodes are numbered as the inputs (in bit-reversed order, like the butterfly positions),
+ * the twiddle factors, and per stage the (mul, add, sub) triple of every butterfly.
+ */
+class FFTView {
+private:
+    int n = 0;
+    int stages = 0;
+
+    [[nodiscard]]
+    int half_n() const {
+        return n / 2;
+    }
+
+    [[nodiscard]]
+    int stage_base(int s) const {
+        return n + half_n() + 3 * s * half_n();
+    }
+
+    /**
+     * @brief Butterfly index of the butterfly at stage s reading position p.
+     */
+    [[nodiscard]]
+    static int butterfly(int s, int p) {
+        return ((p >> (s + 1)) << s) | (p & ((1 << s) - 1));
+    }
+
+    /**
+     * @brief Top position of butterfly b at stage s.
+     */
+    [[nodiscard]]
+    static int top(int s, int b) {
+        return ((b >> s) << (s + 1)) | (b & ((1 << s) - 1));
+    }
+
+    /**
+     * @brief Node holding position p when stage s starts: an input, or the add or sub of stage
+     * s - 1 that wrote it.
+     */
+    [[nodiscard]]
+    int position_node(int s, int p) const {
+        if (s == 0) {
+            return p;
+        }
+        const int part = (p >> (s - 1)) & 1 ? 2 : 1;
+        return stage_base(s - 1) + 3 * butterfly(s - 1, p) + part;
+    }
+
+    /**
+     * @brief Calls visit for the nodes reading position p at stage s, if any.
+     */
+    template <typename Visitor>
+    void visit_readers(int s, int p, Visitor&& visit) const {
+        if (s == stages) {
+            return;
+        }
+        const int node = stage_base(s) + 3 * butterfly(s, p);
+        if ((p >> s) & 1) {
+            visit(node, 0);
+        } else {
+            visit(node + 1, 0);
+            visit(node + 2, 0);
+        }
+    }
+
+public:
+    /**
+     * @brief Creates the view; it is empty unless n is a power of two of at least 2, or if the
+     * graph would have more than INT_MAX nodes or edges.
+     * @param n Number of points.
+     */
+    explicit FFTView(int n);
+
+    [[nodiscard]]
+    int get_num_nodes() const {
+        return n == 0 ? 0 : stage_base(stages);
+    }
+
+    [[nodiscard]]
+    int get_num_edges() const {
+        return 6 * stages * half_n();
+    }
+
+    [[nodiscard]]
+    std::string get_id(int v) const;
+
+    [[nodiscard]]
+    OpLabel get_label(int v) const;
+
+    [[nodiscard]]
+    int get_out_degree(int v) const;
+
+    [[nodiscard]]
+    int get_in_degree(int v) const {
+        return v < n + half_n() ? 0 : 2;
+    }
+
+    [[nodiscard]]
+    bool is_dag() const {
+        return true;
+    }
+
+    [[nodiscard]]
+    int get_level(int v) const;
+
+    [[nodiscard]]
+    int get_num_levels() const {
+        return n == 0 ? 0 : 2 * stages + 1;
+    }
+
+    /**
+     * @brief Calls visit(child, weight) for every child of node v.
+     */
+    template <typename Visitor>
+    void for_each_child(int v, Visitor&& visit) const {
+        if (v < n) {
+            visit_readers(0, v, visit);
+        } else if (v < n + half_n()) {
+            // Twiddle k feeds the multiplications whose butterflies have j * stride == k
+            const int k = v - n;
+            for (int s = 0; s < stages; ++s) {
+                const int stride = half_n() >> s;
+                if (k % stride != 0) {
+                    continue;
+                }
+                for (int t = k / stride; t < n; t += 2 << s) {
+                    visit(stage_base(s) + 3 * butterfly(s, t), 0);
+                }
+            }
+        } else {
+            const int s = (v - stage_base(0)) / (3 * half_n());
+            const int b = (v - stage_base(s)) / 3;
+            const int part = (v - stage_base(s)) % 3;
+            if (part == 0) {
+                visit(v + 1, 0);
+                visit(v + 2, 0);
+            } else {
+                visit_readers(s + 1, top(s, b) + (part == 2 ? 1 << s : 0), visit);
+            }
+        }
+    }
+
+    /**
+     * @brief Calls visit(parent) for every parent of node v.
+     */
+    template <typename Visitor>
+    void for_each_parent(int v, Visitor&& visit) const {
+        if (v < n + half_n()) {
+            return;
+        }
+        const int s = (v - stage_base(0)) / (3 * half_n());
+        const int b = (v - stage_base(s)) / 3;
+        const int part = (v - stage_base(s)) % 3;
+        const int t = top(s, b);
+        if (part == 0) {
+            visit(position_node(s, t + (1 << s)));
+            visit(n + (b & ((1 << s) - 1)) * (half_n() >> s));
+        } else {
+            visit(position_node(s, t));
+            visit(v - part);
+        }
+    }
+};
+
+/**
+ * @class DWTView
+ * @brief Procedural view of Graph::create_dwt_graph(n, levels), with the same node IDs, labels
+ * and edges. Nodes are numbered as the filter taps (h0, h1, g0, g1), the inputs, and per level
+ * and output position the approximation sum with its two products, then the detail sum with its
+ * two products.
+ */
+class DWTView {
+private:
+    int n = 0;
+    int levels = 0;
+
+    [[nodiscard]]
+    int level_base(int level) const {
+        return 4 + n + 6 * (n - (n >> (level - 1)));
+    }
+
+    /**
+     * @brief Splits a node of a decomposition level into its level and offset from level_base.
+     */
+    void locate(int v, int& level, int& offset) const {
+        level = 1;
+        while (level < levels && v >= level_base(level + 1)) {
+            ++level;
+        }
+        offset = v - level_base(level);
+    }
+
+    /**
+     * @brief Node holding approximation coefficient p of a level (the inputs at level 0).
+     */
+    [[nodiscard]]
+    int approximation(int level, int p) const {
+        return level == 0 ? 4 + p : level_base(level) + 6 * p;
+    }
+
+    /**
+     * @brief Calls visit for the two products reading approximation coefficient p of a level.
+     */
+    template <typename Visitor>
+    void visit_readers(int level, int p, Visitor&& visit) const {
+        if (level == levels) {
+            return;
+        }
+        const int group = level_base(level + 1) + 6 * (p / 2) + 1 + p % 2;
+        visit(group, 0);
+        visit(group + 3, 0);
+    }
+
+public:
+    /**
+     * @brief Creates the view; it is empty if the arguments are invalid (as for
+     * Graph::create_dwt_graph) or the graph would have more than INT_MAX nodes or edges.
+     * @param n Signal length.
+     * @param levels Number of decomposition levels.
+     */
+    DWTView(int n, int levels);
+
+    [[nodiscard]]
+    int get_num_nodes() const {
+        return n == 0 ? 0 : level_base(levels + 1);
+    }
+
+    [[nodiscard]]
+    int get_num_edges() const {
+        return 12 * (n - (n >> levels));
+    }
+
+    [[nodiscard]]
+    std::string get_id(int v) const;
+
+    [[nodiscard]]
+    OpLabel get_label(int v) const;
+
+    [[nodiscard]]
+    int get_out_degree(int v) const;
+
+    [[nodiscard]]
+    int get_in_degree(int v) const {
+        return v < 4 + n ? 0 : 2;
+    }
+
+    [[nodiscard]]
+    bool is_dag() const {
+        return true;
+    }
+
+    [[nodiscard]]
+    int get_level(int v) const;
+
+    [[nodiscard]]
+    int get_num_levels() const {
+        return n == 0 ? 0 : 2 * levels + 1;
+    }
+
+    /**
+     * @brief Calls visit(child, weight) for every child of node v.
+     */
+    template <typename Visitor>
+    void for_each_child(int v, Visitor&& visit) const {
+        if (v < 4) {
+            // Tap (filter, tap) feeds that product of every output of every level
+            const int filter = v / 2;
+            const int tap = v % 2;
+            for (int level = 1; level <= levels; ++level) {
+                const int outputs = n >> level;
+                for (int i = 0; i < outputs; ++i) {
+                    visit(level_base(level) + 6 * i + 3 * filter + 1 + tap, 0);
+                }
+            }
+            return;
+        }
+        if (v < 4 + n) {
+            visit_readers(0, v - 4, visit);
+            return;
+        }
+        int level = 0;
+        int offset = 0;
+        locate(v, level, offset);
+        if (offset % 3 != 0) {
+            visit(v - offset % 3, 0);
+        } else if (offset % 6 == 0) {
+            visit_readers(level, offset / 6, visit);
+        }
+    }
+
+    /**
+     * @brief Calls visit(parent) for every parent of node v.
+     */
+    template <typename Visitor>
+    void for_each_parent(int v, Visitor&& visit) const {
+        if (v < 4 + n) {
+            return;
+        }
+        int level = 0;
+        int offset = 0;
+        locate(v, level, offset);
+        const int part = offset % 3;
+        if (part == 0) {
+            visit(v + 1);
+            visit(v + 2);
+        } else {
+            const int filter = (offset % 6) / 3;
+            const int tap = part - 1;
+            visit(approximation(level - 1, 2 * (offset / 6) + tap));
+            visit(2 * filter + tap);
+        }
+    }
+};
+
+#endif  // GRAPH_VIEW_H
@@ -0,0 +1,314 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef INDEXED_GRAPH_H
+#define INDEXED_GRAPH_H
+
+#include <span>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "graph.h"
+#include "graph_view.h"
+
+/**
+ * @class IndexedGraph
+ * @brief Immutable, densely indexed snapshot of a Graph.
+ * Nodes are numbered 0..n-1 in lexicographic order of their IDs (unless renumbered with reordered,
+ * see GraphReorder) and adjacency is stored as sorted compressed sparse rows in both directions,
+ * so solvers can work on integers instead of strings and pointers.
+ */
+class IndexedGraph {
+private:
+    /**
+     * @brief Node IDs indexed by dense node index.
+     */
+    std::vector<std::string> ids;
+
+    /**
+     * @brief Map of node IDs to dense node indices.
+     */
+    std::unordered_map<std::string, int> index;
+
+    /**
+     * @brief Operation label of each node, indexed by dense node index.
+     */
+    std::vector<OpLabel> labels;
+
+    /**
+     * @brief Outgoing adjacency in CSR form: children of v are out_targets[out_offsets[v]..
+     * out_offsets[v+1]), sorted ascending, with matching entries in out_weights.
+     */
+    std::vector<int> out_offsets;
+    std::vector<int> out_targets;
+    std::vector<int> out_weights;
+
+    /**
+     * @brief Incoming adjacency in CSR form, sorted ascending.
+     */
+    std::vector<int> in_offsets;
+    std::vector<int> in_sources;
+
+    /**
+     * @brief Indicates if any edge carries a non-zero weight.
+     */
+    bool weighted = false;
+
+    /**
+     * @brief Topological level of each node (length of the longest path from a source), empty if
+     * the graph has a cycle.
+     */
+    std::vector<int> levels;
+
+    /**
+     * @brief Number of distinct levels.
+     */
+    int num_levels = 0;
+
+    /**
+     * @brief Fills both CSR directions and the levels from unsorted (child, weight) rows.
+     * @param rows Outgoing edges of every node; sorted in place.
+     */
+    void build(std::vector<std::vector<std::pair<int, int>>>& rows);
+
+public:
+    /**
+     * @brief Constructs an empty indexed graph.
+     */
+    IndexedGraph() = default;
+
+    /**
+     * @brief Builds an indexed snapshot of the given graph.
+     * @param graph Graph to index.
+     */
+    explicit IndexedGraph(const Graph& graph);
+
+    /**
+     * @brief Builds an indexed graph directly from dense nodes, which keep the given order, e.g.
+     * for graphs derived from other indexed graphs.
+     * @param node_ids ID of every node.
+     * @param node_labels Operation label of every node.
+     * @param edges Edges as (source index, target index, weight) triples.
+     */
+    IndexedGraph(std::vector<std::string> node_ids, std::vector<OpLabel> node_labels,
+                 const std::vector<std::tuple<int, int, int>>& edges);
+
+    /**
+     * @brief Materializes a procedural view (see GraphView), keeping its node numbering, so
+     * solvers working on indexed graphs run on it without building a Graph of heap nodes.
+     * @param view Graph view to store.
+     */
+    template <typename View>
+        requires(!std::same_as<View, IndexedGraph> && GraphView<View>)
+    explicit IndexedGraph(const View& view) {
+        const int n = view.get_num_nodes();
+        ids.reserve(n);
+        labels.reserve(n);
+        index.reserve(n);
+        std::vector<std::vector<std::pair<int, int>>> rows(n);
+        for (int v = 0; v < n; ++v) {
+            ids.push_back(view.get_id(v));
+            index.emplace(ids.back(), v);
+            labels.push_back(view.get_label(v));
+            rows[v].reserve(view.get_out_degree(v));
+            view.for_each_child(v, [&](int child, int weight) {
+                rows[v].emplace_back(child, weight);
+            });
+        }
+        build(rows);
+    }
+
+    /**
+     * @brief Renumbers the nodes, e.g. into a layout with better locality (see GraphReorder).
+     * @param order Every node index once, in the new order: node order[i] becomes node i.
+     * @return The renumbered copy, with the same IDs, labels, edges and levels.
+     */
+    [[nodiscard]]
+    IndexedGraph reordered(const std::vector<int>& order) const;
+
+    /**
+     * @brief Retrieves the number of nodes.
+     * @return The number of nodes.
+     */
+    [[nodiscard]]
+    int get_num_nodes() const {
+        return static_cast<int>(ids.size());
+    }
+
+    /**
+     * @brief Retrieves the number of directed edges.
+     * @return The number of edges.
+     */
+    [[nodiscard]]
+    int get_num_edges() const {
+        return static_cast<int>(out_targets.size());
+    }
+
+    /**
+     * @brief Retrieves the ID of the node at the given index.
+     * @param v Dense node index.
+     * @return The node's ID.
+     */
+    [[nodiscard]]
+    const std::string& get_id(int v) const {
+        return ids[v];
+    }
+
+    /**
+     * @brief Retrieves the operation label of the node at the given index.
+     * @param v Dense node index.
+     * @return The node's label.
+     */
+    [[nodiscard]]
+    OpLabel get_label(int v) const {
+        return labels[v];
+    }
+
+    /**
+     * @brief Retrieves the dense index of the node with the given ID.
+     * @param id Node ID.
+     * @return The node's index, or -1 if the node does not exist.
+     */
+    [[nodiscard]]
+    int get_index(const std::string& id) const;
+
+    /**
+     * @brief Retrieves the sorted children of a node.
+     * @param v Dense node index.
+     * @return Span of child indices.
+     */
+    [[nodiscard]]
+    std::span<const int> get_children(int v) const {
+        return {out_targets.data() + out_offsets[v],
+                static_cast<size_t>(out_offsets[v + 1] - out_offsets[v])};
+    }
+
+    /**
+     * @brief Retrieves the weights of the outgoing edges of a node, aligned with get_children.
+     * @param v Dense node index.
+     * @return Span of edge weights.
+     */
+    [[nodiscard]]
+    std::span<const int> get_child_weights(int v) const {
+        return {out_weights.data() + out_offsets[v],
+                static_cast<size_t>(out_offsets[v + 1] - out_offsets[v])};
+    }
+
+    /**
+     * @brief Retrieves the sorted parents of a node.
+     * @param v Dense node index.
+     * @return Span of parent indices.
+     */
+    [[nodiscard]]
+    std::span<const int> get_parents(int v) const {
+        return {in_sources.data() + in_offsets[v],
+                static_cast<size_t>(in_offsets[v + 1] - in_offsets[v])};
+    }
+
+    /**
+     * @brief Retrieves the out-degree of a node.
+     * @param v Dense node index.
+     * @return The number of children.
+     */
+    [[nodiscard]]
+    int get_out_degree(int v) const {
+        return out_offsets[v + 1] - out_offsets[v];
+    }
+
+    /**
+     * @brief Retrieves the in-degree of a node.
+     * @param v Dense node index.
+     * @return The number of parents.
+     */
+    [[nodiscard]]
+    int get_in_degree(int v) const {
+        return in_offsets[v + 1] - in_offsets[v];
+    }
+
+    /**
+     * @brief Checks if there is a directed edge from u to v.
+     * @param u Source node index.
+     * @param v Destination node index.
+     * @return True if the edge exists, false otherwise.
+     */
+    [[nodiscard]]
+    bool has_edge(int u, int v) const;
+
+    /**
+     * @brief Retrieves the weight of the edge from u to v.
+     * @param u Source node index.
+     * @param v Destination node index.
+     * @return The edge weight, or 0 if the edge does not exist.
+     */
+    [[nodiscard]]
+    int get_edge_weight(int u, int v) const;
+
+    /**
+     * @brief Indicates if the graph is acyclic.
+     * @return True if the graph is a DAG, false otherwise.
+     */
+    [[nodiscard]]
+    bool is_dag() const {
+        return static_cast<int>(levels.size()) == get_num_nodes();
+    }
+
+    /**
+     * @brief Retrieves the topological level of a node: 0 for sources, otherwise one more than
+     * the highest level among its parents. Only valid for DAGs.
+     * @param v Dense node index.
+     * @return The node's level.
+     */
+    [[nodiscard]]
+    int get_level(int v) const {
+        return levels[v];
+    }
+
+    /**
+     * @brief Retrieves the number of topological levels (0 for cyclic graphs).
+     * @return The number of levels.
+     */
+    [[nodiscard]]
+    int get_num_levels() const {
+        return num_levels;
+    }
+
+    /**
+     * @brief Indicates if any edge carries a non-zero weight.
+     * @return True if the graph is weighted, false otherwise.
+     */
+    [[nodiscard]]
+    bool is_weighted() const {
+        return weighted;
+    }
+
+    /**
+     * @brief Calls visit(child, weight) for every child of node v, in ascending order.
+     */
+    template <typename Visitor>
+    void for_each_child(int v, Visitor&& visit) const {
+        for (int e = out_offsets[v]; e < out_offsets[v + 1]; ++e) {
+            visit(out_targets[e], out_weights[e]);
+        }
+    }
+
+    /**
+     * @brief Calls visit(parent) for every parent of node v, in ascending order.
+     */
+    template <typename Visitor>
+    void for_each_parent(int v, Visitor&& visit) const {
+        for (int e = in_offsets[v]; e < in_offsets[v + 1]; ++e) {
+            visit(in_sources[e]);
+        }
+    }
+};
+
+static_assert(GraphView<IndexedGraph>);
+
+#endif  // INDEXED_GRAPH_H
@@ -8,16 +8,45 @@
 #ifndef MCIS_ALGORITHM_H
 #define MCIS_ALGORITHM_H
 
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "../src/algorithms/mcis_finder.h"
 #include "graph.h"
+#include "mcis_options.h"
 
 /**
  * @enum AlgorithmType
  * @brief Enumeration of available MCIS algorithms.
  */
-enum class AlgorithmType { BRON_KERBOSCH_SERIAL };
+enum class AlgorithmType {
+    BRON_KERBOSCH_SERIAL,
+    COMPONENT_DECOMPOSITION,
+    TREE_DP,
+    HEURISTIC,
+    MULTILEVEL,
+    BRON_KERBOSCH_PARALLEL,
+    DISTRIBUTED
+};
+
+/**
+ * @brief Maximum number of VF3 search states spent checking whether one input graph is fully
+ * embedded in the other before falling back to the MCIS algorithm.
+ */
+constexpr long long EMBEDDING_CHECK_STATE_LIMIT = 100000;
+
+/**
+ * @brief Largest number of node pairs (|g1| * |g2|) solved by the compile-time specialized
+ * small-graph solver instead of the selected algorithm.
+ */
+constexpr int SMALL_GRAPH_MAX_PAIRS = 256;
+
+/**
+ * @brief Search nodes allowed to the exact fold search of run_multi, over all folds; beyond it the
+ * best common subgraph found so far is returned as non-optimal.
+ */
+constexpr long long MULTI_FOLD_NODE_LIMIT = 10000000;
 
 /**
  * @class MCISAlgorithm
@@ -32,6 +61,29 @@ private:
      */
     std::vector<MCISFinder*> algorithms;
 
+    /**
+     * @brief Options passed to every algorithm and to the small-graph solver.
+     */
+    MCISOptions options;
+
+    /**
+     * @brief Checks whether the smaller input graph is an induced subgraph of the larger one, in
+     * which case it is itself the MCIS.
+     * @param g1 The first input graph.
+     * @param g2 The second input graph.
+     * @return A newly allocated induced subgraph of g1 (with g1's node IDs) isomorphic to the
+     * smaller graph, or nullptr if no embedding was found within EMBEDDING_CHECK_STATE_LIMIT
+     * states.
+     */
+    static Graph* find_full_embedding(const Graph& g1, const Graph& g2);
+
+    /**
+     * @brief Solves a pair with the small-graph solver, the tree solver (seeding the selected
+     * algorithm when it is not optimal) or the selected algorithm, as run does after its
+     * embedding check.
+     */
+    MCISResult solve_pair(const Graph& g1, const Graph& g2, AlgorithmType type);
+
 public:
     /**
      * @brief Constructs the MCISAlgorithm manager and initializes available algorithms.
@@ -44,13 +96,64 @@ public:
     ~MCISAlgorithm();
 
     /**
-     * @brief Runs the specified MCIS algorithm on two input graphs.
+     * @brief Solves instances with at most SMALL_GRAPH_MAX_PAIRS node pairs exactly with the
+     * fixed-width (64, 128 or 256 pair) allocation-free solver.
+     * @param g1 The first input graph.
+     * @param g2 The second input graph.
+     * @param options Matching constraints.
+     * @return The MCIS, or std::nullopt if the instance is too large.
+     */
+    static std::optional<MCISResult> solve_small_instance(const Graph& g1, const Graph& g2,
+                                                          const MCISOptions& options = {});
+
+    /**
+     * @brief Sets the options used by every later run.
+     * @param new_options Matching constraints and tuning knobs.
+     */
+    void set_options(const MCISOptions& new_options);
+
+    /**
+     * @brief Runs the specified MCIS algorithm on two input graphs. If one graph is found to be
+     * an induced subgraph of the other, its image in g1 is returned directly without running the
+     * algorithm (except in level-constrained mode), and instances with at most
+     * SMALL_GRAPH_MAX_PAIRS node pairs are dispatched to the small-graph solver. When both graphs
+     * are forests, the polynomial tree solver runs first; its result is returned if it covers the
+     * smaller graph and otherwise seeds the selected algorithm as an incumbent.
      * @param g1 The first input graph.
      * @param g2 The second input graph.
      * @param type The type of algorithm to run (from AlgorithmType enum).
-     * @return A vector of pointers to Graph objects representing the found MCIS results.
+     * @param resume_from Checkpoint (written with MCISOptions::checkpoint_path) the selected
+     * exact clique search continues from; empty, unreadable or mismatching checkpoints start a
+     * fresh search.
+     * @return A vector of pointers to Graph objects representing the found MCIS results, each an
+     * induced subgraph of g1 with g1's node IDs.
+     */
+    std::vector<Graph*> run(const Graph& g1, const Graph& g2, AlgorithmType type,
+                            const std::string& resume_from = "");
+
+    /**
+     * @brief Finds a largest subgraph common to all input graphs. Inputs are first restricted to
+     * the labels they all share (unless level-constrained). The smallest input, the base, is
+     * solved against every other input in parallel; proven pairwise sizes (or the solvers' and
+     * summary bounds) bound the k-way optimum and order the other inputs, tightest first. An
+     * exact fold search (MultiFold) then folds the inputs in one at a time over sets of base
+     * nodes, starting from the tightest pairwise result: each fold carries the incumbent as the
+     * lower bound of its clique searches, stops once the incumbent reaches the pairwise bound,
+     * and backtracks to the other maximal mappings of a fold when the first does not extend.
+     * Level-constrained runs compare every input's levels with the base's original levels.
+     * @param graphs The input graphs.
+     * @param type The algorithm used for the pairwise preprocessing.
+     * @param upper_bound If non-null, receives an upper bound on the common subgraph size: the
+     * result size when it is optimal, the tightest pairwise bound otherwise.
+     * @param optimal If non-null, receives true if the fold search finished within
+     * MULTI_FOLD_NODE_LIMIT nodes, so the result is maximum; otherwise it is the best common
+     * subgraph found.
+     * @return A vector with one newly allocated Graph isomorphic to an induced subgraph of every
+     * input, or an empty vector if there are no inputs.
      */
-    std::vector<Graph*> run(const Graph& g1, const Graph& g2, AlgorithmType type);
+    std::vector<Graph*> run_multi(const std::vector<const Graph*>& graphs,
+                                  AlgorithmType type = AlgorithmType::BRON_KERBOSCH_SERIAL,
+                                  int* upper_bound = nullptr, bool* optimal = nullptr);
 
     /**
      * @brief Runs multiple specified MCIS algorithms on two input graphs.
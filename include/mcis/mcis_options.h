@@ -0,0 +1,102 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef MCIS_OPTIONS_H
+#define MCIS_OPTIONS_H
+
+#include <string>
+
+/**
+ * @enum VertexOrdering
+ * @brief Order of the nodes of a graph, used both as the order in which exact searches consider
+ * them and as a memory layout (GraphReorder): ID order, most distinct neighbors first, reverse
+ * degeneracy order (nodes of the densest cores first), topological level (sources first; ID order
+ * for cyclic graphs), labels with the fewest candidate pairs across both graphs first (grouping
+ * each label contiguously), or reverse Cuthill-McKee (breadth-first from a peripheral node,
+ * neighbors by increasing degree, reversed), which keeps adjacent nodes at nearby indices.
+ * Candidate pairs are numbered by the rank of their g1 node, then of their g2 node, and branched on
+ * in that order.
+ */
+enum class VertexOrdering { NATURAL, DEGREE, DEGENERACY, LEVEL, LABEL_RARITY, RCM };
+
+/**
+ * @enum BranchingPolicy
+ * @brief Choice of the next candidate pair at each node of an exact search: follow the vertex
+ * ordering, or take the pair whose g1 node (then g2 node) has the fewest remaining partners.
+ */
+enum class BranchingPolicy { STATIC, SMALLEST_DOMAIN };
+
+/**
+ * @struct MCISOptions
+ * @brief Optional constraints and tuning knobs shared by the MCIS finders.
+ */
+struct MCISOptions {
+    /**
+     * @brief Only match nodes whose topological levels (longest path from a source) differ by at
+     * most max_level_offset. Ignored unless both graphs are DAGs.
+     */
+    bool level_constrained = false;
+
+    /**
+     * @brief Largest allowed level difference between matched nodes in level-constrained mode.
+     */
+    int max_level_offset = 0;
+
+    /**
+     * @brief Wall-clock budget in seconds for heuristic searches.
+     */
+    double time_limit = 10.0;
+
+    /**
+     * @brief Seed of the random number generators of heuristic searches; each thread derives its
+     * own stream from it.
+     */
+    unsigned int seed = 0;
+
+    /**
+     * @brief Static vertex ordering of exact searches.
+     */
+    VertexOrdering ordering = VertexOrdering::NATURAL;
+
+    /**
+     * @brief Branching policy of exact searches.
+     */
+    BranchingPolicy branching = BranchingPolicy::STATIC;
+
+    /**
+     * @brief File to which exact clique searches periodically save their unexplored frontier,
+     * best mapping and statistics; empty disables checkpointing. Only the top-level instance is
+     * checkpointed, not the components or pairs a finder splits it into.
+     */
+    std::string checkpoint_path;
+
+    /**
+     * @brief Seconds between two checkpoints.
+     */
+    double checkpoint_interval = 60.0;
+
+    /**
+     * @brief Checkpoint an exact clique search resumes from instead of starting over. It is
+     * ignored (and the search starts fresh) if it is unreadable or belongs to another instance.
+     */
+    std::string resume_path;
+
+    /**
+     * @brief Options for the sub-instances a finder solves alongside each other (components,
+     * pairs of a multi-graph run). A checkpoint file belongs to a single instance, so the copy
+     * neither writes nor resumes one.
+     */
+    [[nodiscard]]
+    MCISOptions for_subproblem() const {
+        MCISOptions sub = *this;
+        sub.checkpoint_path.clear();
+        sub.resume_path.clear();
+        return sub;
+    }
+};
+
+#endif  // MCIS_OPTIONS_H
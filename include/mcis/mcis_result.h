@@ -0,0 +1,74 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef MCIS_RESULT_H
+#define MCIS_RESULT_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph.h"
+
+/**
+ * @brief Correspondence between node IDs of two graphs, as (first graph ID, second graph ID) pairs.
+ */
+using NodeMapping = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @struct MCISResult
+ * @brief Common induced subgraph found by an MCIS finder, as a node correspondence between the
+ * two input graphs, together with search statistics.
+ */
+struct MCISResult {
+    /**
+     * @brief Matched node pairs (g1 ID, g2 ID).
+     */
+    NodeMapping mapping;
+
+    /**
+     * @brief True if the search completed and the mapping is proven maximum.
+     */
+    bool optimal = true;
+
+    /**
+     * @brief Number of search nodes explored.
+     */
+    long long nodes_explored = 0;
+
+    /**
+     * @brief Upper bound on the MCIS size proven by the finder, or -1 if it computes none. The
+     * difference to size() bounds how far a heuristic mapping is from optimal.
+     */
+    int upper_bound = -1;
+
+    /**
+     * @brief Retrieves the number of matched nodes.
+     * @return The size of the common subgraph.
+     */
+    [[nodiscard]]
+    int size() const {
+        return static_cast<int>(mapping.size());
+    }
+
+    /**
+     * @brief Builds the common subgraph as the subgraph of g1 induced by the matched nodes.
+     * @param g1 The first input graph the mapping was computed on.
+     * @return A newly allocated Graph; the caller takes ownership.
+     */
+    [[nodiscard]]
+    Graph* to_graph(const Graph& g1) const {
+        std::vector<std::string> ids;
+        ids.reserve(mapping.size());
+        for (const auto& [id1, _] : mapping) {
+            ids.push_back(id1);
+        }
+        return new Graph(g1.induced_subgraph(ids));
+    }
+};
+
+#endif  // MCIS_RESULT_H
@@ -8,9 +8,174 @@
 #ifndef NODE_H
 #define NODE_H
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <string>
-#include <unordered_map>
+
+/**
+ * @enum OpLabel
+ * @brief Operation performed by a CDAG node. Solvers only match nodes with equal labels.
+ */
+enum class OpLabel : uint8_t { NONE, INPUT, COEFF, TWIDDLE, MUL, ADD, SUB };
+
+/**
+ * @brief Number of OpLabel values, for label-indexed tables.
+ */
+constexpr int NUM_OP_LABELS = 7;
+
+/**
+ * @brief Retrieves the printable name of an operation label.
+ * @param label Operation label.
+ * @return The label name, e.g. "mul".
+ */
+const char* op_label_name(OpLabel label);
+
+class Node;
+
+/**
+ * @brief Number of children a Node stores inline; nodes with more (e.g. MVM vector inputs) move
+ * their children to the heap. Nearly all CDAG nodes have one or two children.
+ */
+constexpr uint32_t NODE_INLINE_CHILDREN = 2;
+
+/**
+ * @struct ChildEdge
+ * @brief Outgoing edge of a Node. Members are named like the std::pair entries of a map, so
+ * structured bindings and ->first/->second work as they did on the map of children.
+ */
+struct ChildEdge {
+    Node* first;
+    int second;
+};
+
+/**
+ * @class ChildList
+ * @brief Outgoing edges of a Node as (child, weight) pairs sorted by child address, stored inline
+ * up to NODE_INLINE_CHILDREN entries and in a heap array beyond.
+ * Lookups are binary searches and iteration is a scan over contiguous pairs, in place of the hash
+ * nodes and bucket array of a std::unordered_map.
+ */
+class ChildList {
+public:
+    using value_type = ChildEdge;
+    using const_iterator = const value_type*;
+
+private:
+    uint32_t count = 0;
+    uint32_t capacity = NODE_INLINE_CHILDREN;
+    union {
+        value_type inline_entries[NODE_INLINE_CHILDREN];
+        value_type* heap;
+    };
+
+    [[nodiscard]]
+    bool is_inline() const {
+        return capacity == NODE_INLINE_CHILDREN;
+    }
+
+    [[nodiscard]]
+    value_type* data() {
+        return is_inline() ? inline_entries : heap;
+    }
+
+    [[nodiscard]]
+    const value_type* data() const {
+        return is_inline() ? inline_entries : heap;
+    }
+
+    /**
+     * @brief Position of the first entry whose child is not below the given one.
+     */
+    [[nodiscard]]
+    uint32_t lower_bound(const Node* child) const;
+
+    /**
+     * @brief Releases the heap array, if any, and returns to inline storage.
+     */
+    void release();
+
+public:
+    ChildList() : heap(nullptr) {}
+
+    ChildList(const ChildList& other);
+
+    ChildList& operator=(const ChildList& other);
+
+    ChildList(ChildList&& other) noexcept;
+
+    ChildList& operator=(ChildList&& other) noexcept;
+
+    ~ChildList();
+
+    [[nodiscard]]
+    size_t size() const {
+        return count;
+    }
+
+    [[nodiscard]]
+    bool empty() const {
+        return count == 0;
+    }
+
+    [[nodiscard]]
+    const_iterator begin() const {
+        return data();
+    }
+
+    [[nodiscard]]
+    const_iterator end() const {
+        return data() + count;
+    }
+
+    /**
+     * @brief Finds the edge to a child.
+     * @return Iterator to the (child, weight) pair, or end() if there is no such edge.
+     */
+    [[nodiscard]]
+    const_iterator find(const Node* child) const;
+
+    [[nodiscard]]
+    bool contains(const Node* child) const {
+        return find(child) != end();
+    }
+
+    /**
+     * @brief Retrieves the weight of the edge to a child, which must exist.
+     */
+    [[nodiscard]]
+    int at(const Node* child) const {
+        return find(child)->second;
+    }
+
+    /**
+     * @brief Inserts an edge at its sorted position.
+     * @return True if the edge was inserted, false if the child is already present.
+     */
+    bool insert(Node* child, int weight);
+
+    /**
+     * @brief Removes the edge to a child.
+     * @return True if the edge was removed, false if it does not exist.
+     */
+    bool erase(const Node* child);
+
+    /**
+     * @brief Changes the weight of the edge to a child.
+     * @return True if the weight was changed, false if the edge does not exist.
+     */
+    bool assign(const Node* child, int weight);
+
+    /**
+     * @brief Reserves room for a number of children.
+     */
+    void reserve(size_t new_capacity);
+
+    /**
+     * @brief Removes all edges and frees the heap array.
+     */
+    void clear();
+};
 
 /**
  * @class Node
@@ -25,26 +190,27 @@ private:
     std::string id;
 
     /**
-     * @brief Number of parent nodes (incoming edges).
+     * @brief Child nodes and the weights of the directed edges connecting to them.
      */
-    int num_parents;
+    ChildList children;
 
     /**
-     * @brief Number of child nodes (outgoing edges).
+     * @brief Number of parent nodes (incoming edges).
      */
-    int num_children;
+    int num_parents;
 
     /**
-     * @brief Map of child nodes to the weights of the directed edges connecting to them.
+     * @brief Operation performed by the node.
      */
-    std::unordered_map<Node*, int> children;
+    OpLabel label;
 
 public:
     /**
      * @brief Constructs a Node with a given ID and optional parent/child counts.
      * @param id Unique identifier for the node.
+     * @param label Operation performed by the node.
      */
-    Node(const std::string& id);
+    Node(const std::string& id, OpLabel label = OpLabel::NONE);
 
     /**
      * @brief Copy constructor.
@@ -84,6 +250,19 @@ public:
     [[nodiscard]]
     std::string get_id() const;
 
+    /**
+     * @brief Retrieves the operation performed by the node.
+     * @return The node's operation label.
+     */
+    [[nodiscard]]
+    OpLabel get_label() const;
+
+    /**
+     * @brief Sets the operation performed by the node.
+     * @param new_label New operation label.
+     */
+    void set_label(OpLabel new_label);
+
     /**
      * @brief Retrieves the number of parent nodes (incoming edges).
      * @return The number of parent nodes.
@@ -106,6 +285,12 @@ public:
      */
     bool add_edge(Node* neighbor, int weight);
 
+    /**
+     * @brief Reserves room for a number of children, so bulk edge insertion does not reallocate.
+     * @param count Expected number of children.
+     */
+    void reserve_children(size_t count);
+
     /**
      * @brief Removes the directed edge to a neighbor node.
      * @param neighbor Pointer to the neighbor node.
@@ -144,8 +329,8 @@ public:
     bool is_sink() const;
 
     /**
-     * @brief Equality operator to compare two nodes based on their ID, parent count, child count,
-     * and edges.
+     * @brief Equality operator to compare two nodes based on their ID, label, parent count, child
+     * count, and edges (children are compared by ID).
      * @return True if the nodes are equal, false otherwise.
      */
     bool operator==(const Node& other) const;
@@ -159,11 +344,11 @@ public:
     bool same_id(const Node& other) const;
 
     /**
-     * @brief Provides access to the children map for external use (e.g., in Graph class).
-     * @return Reference to the children map.
+     * @brief Provides access to the children for external use (e.g., in Graph class).
+     * @return Reference to the children, sorted by node address.
      */
     [[nodiscard]]
-    const std::unordered_map<Node*, int>& get_children() const;
+    const ChildList& get_children() const;
 
     /**
      * @brief operator to print node and its children
@@ -179,6 +364,11 @@ public:
      * @return void, prints to std::cout
      */
     void print_full() const;
+
+    /**
+     * @brief Bulk passes of Graph fill the children and parent counts of many nodes in parallel.
+     */
+    friend class Graph;
 };
 
 #endif  // NODE_H
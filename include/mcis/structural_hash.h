@@ -0,0 +1,109 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef STRUCTURAL_HASH_H
+#define STRUCTURAL_HASH_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "graph.h"
+#include "indexed_graph.h"
+
+/**
+ * @brief Smallest level size processed with an OpenMP parallel loop by the structural hash.
+ */
+constexpr int STRUCTURAL_HASH_PARALLEL_LEVEL = 1024;
+
+/**
+ * @class StructuralHash
+ * @brief Hash-consing of the rooted sub-DAGs of a CDAG.
+ * The rooted sub-DAG of a node is the computation producing it: the node and all its ancestors.
+ * Nodes are hashed bottom-up in topological order, from the sources down, each from its label and
+ * the sorted multiset of (operand hash, edge weight) pairs (a Merkle hash), so two nodes hash alike
+ * when they compute the same expression. Equal hashes are then confirmed on exact signatures (label
+ * and sorted (operand class, weight) pairs), so classes are never merged by a hash collision.
+ *
+ * Nodes of one topological level only depend on lower levels; each level is hashed by a parallel
+ * loop and then hash-consed serially. The pass takes time linear in the size of the graph (up to
+ * sorting the operands of each node). Operands are treated as unordered, since edges do not record
+ * operand positions. Classes describe expressions, not sharing: two nodes of a class may have
+ * sub-DAGs of different sizes when one reuses an operand that the other computes twice.
+ */
+class StructuralHash {
+private:
+    /**
+     * @brief Smallest node index in the class of each node.
+     */
+    std::vector<int> classes;
+
+    /**
+     * @brief Merkle hash of each node; depends only on the node's expression, so it is comparable
+     * across graphs.
+     */
+    std::vector<uint64_t> hashes;
+
+    /**
+     * @brief Number of distinct classes.
+     */
+    int num_classes = 0;
+
+public:
+    /**
+     * @brief Hashes every rooted sub-DAG of an indexed graph. In a cyclic graph, every node is its
+     * own class and is hashed by its label alone.
+     * @param graph Graph to analyze.
+     */
+    explicit StructuralHash(const IndexedGraph& graph);
+
+    /**
+     * @brief Retrieves the class representative of a node.
+     * @param v Dense node index.
+     * @return The smallest node index whose rooted sub-DAG is identical to v's.
+     */
+    [[nodiscard]]
+    int get_class(int v) const {
+        return classes[v];
+    }
+
+    /**
+     * @brief Retrieves the Merkle hash of a node.
+     * @param v Dense node index.
+     * @return The hash of v's rooted sub-DAG.
+     */
+    [[nodiscard]]
+    uint64_t get_hash(int v) const {
+        return hashes[v];
+    }
+
+    /**
+     * @brief Retrieves the number of classes.
+     * @return The number of classes.
+     */
+    [[nodiscard]]
+    int get_num_classes() const {
+        return num_classes;
+    }
+
+    /**
+     * @brief Retrieves the classes with at least two nodes, i.e. the repeated sub-DAGs.
+     * @return Classes sorted by their representative, each sorted ascending.
+     */
+    [[nodiscard]]
+    std::vector<std::vector<int>> get_repeated() const;
+
+    /**
+     * @brief Finds the repeated rooted sub-DAGs of a graph as groups of node IDs.
+     * @param graph Graph to analyze.
+     * @return Groups of at least two nodes with identical rooted sub-DAGs, sorted by their
+     * smallest ID, each sorted ascending.
+     */
+    static std::vector<std::vector<std::string>> find_repeated_subdags(const Graph& graph);
+};
+
+#endif  // STRUCTURAL_HASH_H
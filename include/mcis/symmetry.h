@@ -0,0 +1,188 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef SYMMETRY_H
+#define SYMMETRY_H
+
+#include <string>
+#include <vector>
+
+#include "graph.h"
+#include "indexed_graph.h"
+
+/**
+ * @brief Maximum number of refinement nodes explored when searching for an automorphism that maps
+ * one node onto another; searches that exceed it leave the two nodes in separate orbits.
+ */
+constexpr long long AUTOMORPHISM_SEARCH_LIMIT = 10000;
+
+/**
+ * @brief Number of levels of the MCIS clique search at which symmetry orbits are derived for
+ * orbital branching.
+ */
+constexpr int SYMMETRY_BREAKING_DEPTH = 6;
+
+/**
+ * @brief Clique search nodes that one refinement round costs per graph node, for weighing the
+ * stabilizers of orbital branching against the search they save.
+ */
+constexpr long long SYMMETRY_ROUND_COST = 8;
+
+/**
+ * @brief Search nodes' worth of stabilizer work orbital branching may spend beyond the search
+ * nodes it has saved, before the search stops requesting orbits.
+ */
+constexpr long long SYMMETRY_WORK_BUDGET = 100000;
+
+/**
+ * @class AutomorphismGroup
+ * @brief Automorphism orbits of a directed, labelled, weighted graph.
+ * Nodes are first split by colour refinement (labels, then the multisets of child and parent
+ * colours and edge weights) into an equitable partition whose cells contain every orbit. Inside a
+ * cell, individualization-refinement in the style of nauty/saucy searches for an automorphism
+ * mapping one node onto another; every automorphism found is kept as a generator and its cycles are
+ * merged into the orbits.
+ */
+class AutomorphismGroup {
+private:
+    /**
+     * @brief Smallest node index in the orbit of each node.
+     */
+    std::vector<int> orbit;
+
+    /**
+     * @brief Automorphisms found, as node index permutations.
+     */
+    std::vector<std::vector<int>> generators;
+
+    /**
+     * @brief Number of distinct orbits.
+     */
+    int num_orbits = 0;
+
+    /**
+     * @brief Indicates if no automorphism search hit the search limit.
+     */
+    bool complete = true;
+
+    /**
+     * @brief Number of refinement rounds spent computing the orbits.
+     */
+    long long work = 0;
+
+    /**
+     * @brief Searches for an automorphism consistent with a joint colouring of two copies of the
+     * graph (copy A in [0, n), copy B in [n, 2n)), by refining and then individualizing the first
+     * non-singleton cell.
+     * @param graph Graph whose automorphisms are searched.
+     * @param colours Joint colouring; consumed by the search.
+     * @param permutation Output automorphism, mapping copy A onto copy B.
+     * @param budget Remaining number of search nodes; decremented as the search proceeds.
+     * @return True if an automorphism was found, false otherwise.
+     */
+    static bool extend(const IndexedGraph& graph, std::vector<int>& colours,
+                       std::vector<int>& permutation, long long& budget);
+
+public:
+    /**
+     * @brief Computes the automorphism orbits of an indexed graph, optionally restricted to the
+     * automorphisms that fix each of the given nodes.
+     * @param graph Graph to analyze.
+     * @param fixed Nodes that every automorphism must map onto themselves.
+     * @param search_limit Search nodes allowed per pair of nodes tested for equivalence.
+     * @param supergroup Optional complete group containing this one, e.g. the stabilizer of a
+     * prefix of fixed; only nodes sharing one of its orbits are tested for equivalence.
+     */
+    explicit AutomorphismGroup(const IndexedGraph& graph, const std::vector<int>& fixed = {},
+                               long long search_limit = AUTOMORPHISM_SEARCH_LIMIT,
+                               const AutomorphismGroup* supergroup = nullptr);
+
+    /**
+     * @brief Retrieves the orbit representative of a node.
+     * @param v Dense node index.
+     * @return The smallest node index in v's orbit.
+     */
+    [[nodiscard]]
+    int get_orbit(int v) const {
+        return orbit[v];
+    }
+
+    /**
+     * @brief Retrieves the number of orbits.
+     * @return The number of orbits.
+     */
+    [[nodiscard]]
+    int get_num_orbits() const {
+        return num_orbits;
+    }
+
+    /**
+     * @brief Indicates if every orbit is a single node, i.e. no non-identity automorphism was
+     * found.
+     * @return True if the group is trivial, false otherwise.
+     */
+    [[nodiscard]]
+    bool is_trivial() const {
+        return num_orbits == static_cast<int>(orbit.size());
+    }
+
+    /**
+     * @brief Indicates if the orbits are exact. When a search hits the limit the orbits may be
+     * finer than the true ones, but nodes sharing an orbit are always truly equivalent.
+     * @return True if every search finished, false otherwise.
+     */
+    [[nodiscard]]
+    bool is_complete() const {
+        return complete;
+    }
+
+    /**
+     * @brief Indicates if every automorphism found maps a node onto itself. The stabilizer of
+     * such a node is then the group itself.
+     * @param v Dense node index.
+     * @return True if v is alone in its orbit, false otherwise.
+     */
+    [[nodiscard]]
+    bool fixes(int v) const;
+
+    /**
+     * @brief Retrieves the number of refinement rounds spent computing the orbits.
+     * @return The refinement rounds, one per individualization-refinement search node.
+     */
+    [[nodiscard]]
+    long long get_work() const {
+        return work;
+    }
+
+    /**
+     * @brief Retrieves the automorphisms found while computing the orbits.
+     * @return Permutations of node indices.
+     */
+    [[nodiscard]]
+    const std::vector<std::vector<int>>& get_generators() const {
+        return generators;
+    }
+
+    /**
+     * @brief Refines a colouring of one or more copies of the graph to the coarsest equitable
+     * colouring below it. Vertex x stands for node x % n of copy x / n. New colours are ranks of
+     * colour signatures, so copies coloured alike stay comparable.
+     * @param graph Graph whose adjacency drives the refinement.
+     * @param colours Colour of every vertex; refined in place.
+     * @return The number of distinct colours.
+     */
+    static int refine(const IndexedGraph& graph, std::vector<int>& colours);
+
+    /**
+     * @brief Computes the automorphism orbits of a graph as groups of node IDs.
+     * @param graph Graph to analyze.
+     * @return Orbits sorted by their smallest ID, each sorted ascending.
+     */
+    static std::vector<std::vector<std::string>> find_orbits(const Graph& graph);
+};
+
+#endif  // SYMMETRY_H
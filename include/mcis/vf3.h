@@ -0,0 +1,196 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef VF3_H
+#define VF3_H
+
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "graph.h"
+#include "indexed_graph.h"
+#include "mcis_result.h"
+
+/**
+ * @class VF3Matcher
+ * @brief Induced subgraph isomorphism engine for directed graphs in the style of VF3.
+ * Finds injective mappings of every pattern node onto a target node with the same operation label
+ * such that an edge exists between two pattern nodes if and only if it exists between their images
+ * (with equal weights when either graph is weighted). Pattern nodes are explored in a
+ * greatest-constraint-first order and candidates are pruned with degree, adjacency-consistency and
+ * terminal-set look-ahead rules.
+ */
+class VF3Matcher {
+private:
+    /**
+     * @brief Indexed snapshots owned by the matcher when constructed from Graph objects.
+     */
+    std::optional<IndexedGraph> owned_pattern;
+    std::optional<IndexedGraph> owned_target;
+
+    /**
+     * @brief Graphs being matched.
+     */
+    const IndexedGraph* pattern;
+    const IndexedGraph* target;
+
+    /**
+     * @brief Compare edge weights when matching.
+     */
+    bool compare_weights;
+
+    /**
+     * @brief Pattern nodes in exploration order and the position of each node in that order.
+     */
+    std::vector<int> order;
+    std::vector<int> position;
+
+    /**
+     * @brief For each position, the earliest already-ordered neighbor used to generate candidates
+     * (-1 if none) and whether the explored node is a child of that neighbor.
+     */
+    std::vector<int> anchor;
+    std::vector<bool> anchor_is_parent;
+
+    /**
+     * @brief Smallest position among each pattern node's neighbors (terminal set entry depth).
+     */
+    std::vector<int> first_neighbor_position;
+
+    /**
+     * @brief Maximum number of search states to explore, or -1 for no limit.
+     */
+    long long state_limit = -1;
+
+    /**
+     * @brief Number of states explored by the last search.
+     */
+    long long states_explored = 0;
+
+    /**
+     * @brief Indicates if the last search stopped because the state limit was reached.
+     */
+    bool limit_hit = false;
+
+    /**
+     * @brief Computes the node exploration order and per-position candidate anchors.
+     */
+    void compute_order();
+
+    /**
+     * @brief Runs the search, invoking the callback on every complete mapping until it returns
+     * false.
+     * @param visit Callback receiving the pattern-to-target index mapping.
+     */
+    template <typename Visitor>
+    void search(Visitor&& visit);
+
+public:
+    /**
+     * @brief Constructs a matcher for the given pattern and target graphs.
+     * @param pattern Graph whose nodes are all mapped.
+     * @param target Graph the pattern is embedded into.
+     */
+    VF3Matcher(const Graph& pattern, const Graph& target);
+
+    /**
+     * @brief Constructs a matcher over existing indexed snapshots; both must outlive the matcher.
+     * @param pattern Graph whose nodes are all mapped.
+     * @param target Graph the pattern is embedded into.
+     */
+    VF3Matcher(const IndexedGraph& pattern, const IndexedGraph& target);
+
+    VF3Matcher(const VF3Matcher&) = delete;
+    VF3Matcher& operator=(const VF3Matcher&) = delete;
+
+    /**
+     * @brief Limits the number of search states explored per search.
+     * @param limit Maximum number of states, or -1 for no limit.
+     */
+    void set_state_limit(long long limit) { state_limit = limit; }
+
+    /**
+     * @brief Indicates if the last search was cut short by the state limit, in which case a
+     * negative answer is inconclusive.
+     * @return True if the limit was reached, false otherwise.
+     */
+    [[nodiscard]]
+    bool limit_reached() const {
+        return limit_hit;
+    }
+
+    /**
+     * @brief Retrieves the number of states explored by the last search.
+     * @return The number of states.
+     */
+    [[nodiscard]]
+    long long get_states_explored() const {
+        return states_explored;
+    }
+
+    /**
+     * @brief Finds one induced embedding of the pattern into the target.
+     * @param mapping Output vector mapping each pattern index to a target index.
+     * @return True if an embedding was found, false otherwise.
+     */
+    bool find_first(std::vector<int>& mapping);
+
+    /**
+     * @brief Finds one induced embedding of the pattern into the target.
+     * @return The embedding as node ID pairs, or std::nullopt if none was found.
+     */
+    std::optional<NodeMapping> find();
+
+    /**
+     * @brief Enumerates induced embeddings of the pattern into the target.
+     * @param limit Maximum number of embeddings to return, or 0 for all.
+     * @return Vector of embeddings as pattern-to-target index mappings.
+     */
+    std::vector<std::vector<int>> find_all(size_t limit = 0);
+
+    /**
+     * @brief Checks if the pattern is isomorphic to an induced subgraph of the target.
+     * @param pattern Graph to embed.
+     * @param target Graph to embed into.
+     * @param state_limit Maximum number of search states, or -1 for no limit.
+     * @return True if an induced embedding exists, false if none exists or the limit was reached.
+     */
+    static bool is_induced_subgraph(const Graph& pattern, const Graph& target,
+                                    long long state_limit = -1);
+
+    /**
+     * @brief Checks if two graphs are isomorphic.
+     * @param g1 First graph.
+     * @param g2 Second graph.
+     * @return True if the graphs are isomorphic, false otherwise.
+     */
+    static bool is_isomorphic(const Graph& g1, const Graph& g2);
+
+    /**
+     * @brief Verifies that a node mapping describes a common induced subgraph of two graphs: the
+     * mapping is injective on both sides, pairs nodes with equal labels, and preserves adjacency
+     * (and weights) in both directions.
+     * @param g1 First graph.
+     * @param g2 Second graph.
+     * @param mapping Node ID pairs from g1 to g2.
+     * @return True if the mapping is a valid common induced subgraph, false otherwise.
+     */
+    static bool verify_mapping(const Graph& g1, const Graph& g2, const NodeMapping& mapping);
+
+    /**
+     * @brief Verifies that a reported common subgraph is an induced subgraph of both inputs.
+     * @param common Candidate common induced subgraph.
+     * @param g1 First graph.
+     * @param g2 Second graph.
+     * @return True if the candidate embeds as an induced subgraph into both graphs.
+     */
+    static bool is_common_induced_subgraph(const Graph& common, const Graph& g1, const Graph& g2);
+};
+
+#endif  // VF3_H
@@ -0,0 +1,86 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "assignment.h"
+
+#include <limits>
+
+std::vector<int> HungarianAssignment::solve(const std::vector<std::vector<long long>>& weights) {
+    const int rows = static_cast<int>(weights.size());
+    const int cols = rows == 0 ? 0 : static_cast<int>(weights[0].size());
+    if (rows == 0 || cols == 0) {
+        return std::vector<int>(rows, -1);
+    }
+
+    // The augmenting-path formulation needs rows <= cols, so work on the transpose otherwise
+    const bool transposed = rows > cols;
+    const int r = transposed ? cols : rows;
+    const int c = transposed ? rows : cols;
+    auto cost = [&](int i, int j) {
+        return transposed ? -weights[j][i] : -weights[i][j];
+    };
+
+    // 1-based potentials and matching; column 0 is the virtual source of each augmentation
+    constexpr long long INF = std::numeric_limits<long long>::max() / 4;
+    std::vector<long long> u(r + 1, 0);
+    std::vector<long long> v(c + 1, 0);
+    std::vector<int> match(c + 1, 0);
+    std::vector<int> way(c + 1, 0);
+    for (int i = 1; i <= r; ++i) {
+        match[0] = i;
+        int j0 = 0;
+        std::vector<long long> min_slack(c + 1, INF);
+        std::vector<bool> used(c + 1, false);
+        do {
+            used[j0] = true;
+            const int i0 = match[j0];
+            long long delta = INF;
+            int j1 = 0;
+            for (int j = 1; j <= c; ++j) {
+                if (used[j]) {
+                    continue;
+                }
+                const long long slack = cost(i0 - 1, j - 1) - u[i0] - v[j];
+                if (slack < min_slack[j]) {
+                    min_slack[j] = slack;
+                    way[j] = j0;
+                }
+                if (min_slack[j] < delta) {
+                    delta = min_slack[j];
+                    j1 = j;
+                }
+            }
+            for (int j = 0; j <= c; ++j) {
+                if (used[j]) {
+                    u[match[j]] += delta;
+                    v[j] -= delta;
+                } else {
+                    min_slack[j] -= delta;
+                }
+            }
+            j0 = j1;
+        } while (match[j0] != 0);
+        do {
+            const int j1 = way[j0];
+            match[j0] = match[j1];
+            j0 = j1;
+        } while (j0 != 0);
+    }
+
+    std::vector<int> assignment(rows, -1);
+    for (int j = 1; j <= c; ++j) {
+        if (match[j] == 0) {
+            continue;
+        }
+        if (transposed) {
+            assignment[j - 1] = match[j] - 1;
+        } else {
+            assignment[match[j] - 1] = j - 1;
+        }
+    }
+    return assignment;
+}
@@ -0,0 +1,31 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef ASSIGNMENT_H
+#define ASSIGNMENT_H
+
+#include <vector>
+
+/**
+ * @class HungarianAssignment
+ *
+ * Maximum-weight bipartite assignment with the Hungarian algorithm (shortest augmenting paths with
+ * potentials, O(r^2 c) for r <= c). Every row is matched to a distinct column when the matrix has
+ * at least as many columns as rows and vice versa; zero-weight matches are reported like any other
+ * and can be dropped by the caller.
+ */
+class HungarianAssignment {
+public:
+    /**
+     * @brief Finds an assignment of rows to distinct columns maximizing the total weight.
+     * @param weights Row-major weight matrix; all rows must have the same length.
+     * @return For each row, the assigned column, or -1 if the row is left unassigned.
+     */
+    static std::vector<int> solve(const std::vector<std::vector<long long>>& weights);
+};
+
+#endif  // ASSIGNMENT_H
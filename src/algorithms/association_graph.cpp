@@ -0,0 +1,89 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "association_graph.h"
+
+#include <unordered_map>
+
+#include "mcis/graph_reorder.h"
+
+AssociationGraph::AssociationGraph(const IndexedGraph& g1, const IndexedGraph& g2,
+                                   const MCISOptions& options) {
+    // Only nodes performing the same operation (at compatible levels) can be matched
+    const std::vector<int> order1 = GraphReorder::node_order(g1, g2, options.ordering);
+    const std::vector<int> order2 = GraphReorder::node_order(g2, g1, options.ordering);
+    for (int u : order1) {
+        for (int v : order2) {
+            if (admissible(g1, g2, u, v, options)) {
+                pairs.emplace_back(u, v);
+            }
+        }
+    }
+    const int n = static_cast<int>(pairs.size());
+
+    adjacency.assign(n, Bitset(n));
+#pragma omp parallel for schedule(dynamic, 16) if (n >= 1024)
+    for (int p = 0; p < n; ++p) {
+        const auto [u1, v1] = pairs[p];
+        for (int q = 0; q < n; ++q) {
+            const auto [u2, v2] = pairs[q];
+            if (compatible(g1, g2, u1, v1, u2, v2)) {
+                adjacency[p].set(q);
+            }
+        }
+    }
+}
+
+void AssociationGraph::get_pair_orbits(const AutomorphismGroup& a1, const AutomorphismGroup& a2,
+                                       std::vector<int>& orbit) const {
+    const int n = get_num_vertices();
+    std::unordered_map<long long, int> orbit_of;
+    orbit.resize(n);
+    for (int p = 0; p < n; ++p) {
+        const auto [u, v] = pairs[p];
+        const long long key = (static_cast<long long>(a1.get_orbit(u)) << 32) | a2.get_orbit(v);
+        orbit[p] = orbit_of.emplace(key, static_cast<int>(orbit_of.size())).first->second;
+    }
+}
+
+uint64_t AssociationGraph::get_fingerprint() const {
+    // FNV-1a over the pairs and the degree of every vertex
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&](uint64_t value) {
+        hash ^= value;
+        hash *= 1099511628211ULL;
+    };
+    mix(pairs.size());
+    for (size_t p = 0; p < pairs.size(); ++p) {
+        mix(static_cast<uint64_t>(pairs[p].first));
+        mix(static_cast<uint64_t>(pairs[p].second));
+        mix(adjacency[p].count());
+    }
+    return hash;
+}
+
+Bitset AssociationGraph::get_clique(const IndexedGraph& g1, const IndexedGraph& g2,
+                                    const NodeMapping& mapping) const {
+    std::unordered_map<long long, int> index;
+    for (size_t p = 0; p < pairs.size(); ++p) {
+        const long long key = (static_cast<long long>(pairs[p].first) << 32) | pairs[p].second;
+        index.emplace(key, static_cast<int>(p));
+    }
+    Bitset clique(get_num_vertices());
+    for (const auto& [id1, id2] : mapping) {
+        const int u = g1.get_index(id1);
+        const int v = g2.get_index(id2);
+        if (u < 0 || v < 0) {
+            continue;
+        }
+        auto it = index.find((static_cast<long long>(u) << 32) | v);
+        if (it != index.end()) {
+            clique.set(it->second);
+        }
+    }
+    return clique;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef ASSOCIATION_GRAPH_H
+#define ASSOCIATION_GRAPH_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "mcis/bitset.h"
+#include "mcis/indexed_graph.h"
+#include "mcis/mcis_options.h"
+#include "mcis/mcis_result.h"
+#include "mcis/symmetry.h"
+
+/**
+ * @class AssociationGraph
+ *
+ * Modular product of two directed graphs. Each vertex is a pair (u, v) of a g1 node and a g2
+ * node with the same operation label (and, in level-constrained mode, nearby topological levels);
+ * two pairs are adjacent when they use distinct nodes on both sides and agree on the
+ * presence, direction and weight of the edges between them. Cliques of the association graph are
+ * exactly the common induced subgraphs of g1 and g2.
+ */
+class AssociationGraph {
+private:
+    std::vector<std::pair<int, int>> pairs;
+    std::vector<Bitset> adjacency;
+
+public:
+    /**
+     * @brief Builds the association graph of two indexed graphs over all admissible pairs,
+     * numbered in lexicographic order of the ranks of u and v under options.ordering.
+     */
+    AssociationGraph(const IndexedGraph& g1, const IndexedGraph& g2,
+                     const MCISOptions& options = {});
+
+    [[nodiscard]]
+    int get_num_vertices() const {
+        return static_cast<int>(pairs.size());
+    }
+
+    [[nodiscard]]
+    const std::pair<int, int>& get_pair(int p) const {
+        return pairs[p];
+    }
+
+    [[nodiscard]]
+    const std::vector<std::pair<int, int>>& get_pairs() const {
+        return pairs;
+    }
+
+    [[nodiscard]]
+    const std::vector<Bitset>& get_adjacency() const {
+        return adjacency;
+    }
+
+    /**
+     * @brief Hashes the pairs and their adjacency, identifying the clique instance for
+     * checkpoints.
+     */
+    [[nodiscard]]
+    uint64_t get_fingerprint() const;
+
+    /**
+     * @brief Converts a node mapping into the clique of association vertices it consists of;
+     * pairs that are not vertices (e.g. excluded by the level constraint) are skipped.
+     */
+    [[nodiscard]]
+    Bitset get_clique(const IndexedGraph& g1, const IndexedGraph& g2,
+                      const NodeMapping& mapping) const;
+
+    /**
+     * @brief Groups pairs into orbits of the product of two automorphism groups: (u, v) and
+     * (u', v') share an orbit when u, u' share an orbit of g1 and v, v' share an orbit of g2.
+     * @param a1 Automorphism group of g1.
+     * @param a2 Automorphism group of g2.
+     * @param orbit Output orbit ID of every pair.
+     */
+    void get_pair_orbits(const AutomorphismGroup& a1, const AutomorphismGroup& a2,
+                         std::vector<int>& orbit) const;
+
+    /**
+     * @brief Indicates if the level constraint applies: it is requested and both graphs are DAGs.
+     */
+    static bool uses_levels(const IndexedGraph& g1, const IndexedGraph& g2,
+                            const MCISOptions& options) {
+        return options.level_constrained && g1.is_dag() && g2.is_dag();
+    }
+
+    /**
+     * @brief Checks if node u of g1 may be matched to node v of g2: equal labels, and levels at
+     * most options.max_level_offset apart when uses_levels holds.
+     */
+    static bool admissible(const IndexedGraph& g1, const IndexedGraph& g2, int u, int v,
+                           const MCISOptions& options) {
+        if (g1.get_label(u) != g2.get_label(v)) {
+            return false;
+        }
+        if (uses_levels(g1, g2, options)) {
+            const int offset = g1.get_level(u) - g2.get_level(v);
+            return offset <= options.max_level_offset && -offset <= options.max_level_offset;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Checks if the pairs (u1, v1) and (u2, v2) can both belong to a common induced
+     * subgraph.
+     */
+    static bool compatible(const IndexedGraph& g1, const IndexedGraph& g2, int u1, int v1, int u2,
+                           int v2) {
+        if (u1 == u2 || v1 == v2) {
+            return false;
+        }
+        const bool forward = g1.has_edge(u1, u2);
+        const bool backward = g1.has_edge(u2, u1);
+        if (forward != g2.has_edge(v1, v2) || backward != g2.has_edge(v2, v1)) {
+            return false;
+        }
+        if (g1.is_weighted() || g2.is_weighted()) {
+            if (forward && g1.get_edge_weight(u1, u2) != g2.get_edge_weight(v1, v2)) {
+                return false;
+            }
+            if (backward && g1.get_edge_weight(u2, u1) != g2.get_edge_weight(v2, v1)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+#endif  // ASSOCIATION_GRAPH_H
@@ -0,0 +1,168 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "mcis/bounds.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Histogram = std::vector<std::pair<int, int>>;
+
+bool uses_levels(const GraphSummary& s1, const GraphSummary& s2, const MCISOptions& options) {
+    return options.level_constrained && s1.dag && s2.dag;
+}
+
+// Largest subgraph size allowed by matching a node with a neighbors to one with b neighbors
+int pair_cap(int a, int b, int n1, int n2) {
+    return 1 + std::min(a, b) + std::min(n1 - 1 - a, n2 - 1 - b);
+}
+
+// For each degree of `from`, the largest cap over the degrees of `to`, as (cap, count) pairs. The
+// cap rises, stays flat, then falls as b grows, with its plateau between a and a + n_to - n_from,
+// so only the degrees next to those two points matter.
+Histogram degree_caps(const Histogram& from, const Histogram& to, int n_from, int n_to) {
+    Histogram caps;
+    if (to.empty()) {
+        return caps;
+    }
+    for (const auto& [a, count] : from) {
+        int best = 0;
+        for (int point : {a, a + n_to - n_from}) {
+            auto it = std::lower_bound(to.begin(), to.end(), std::pair(point, 0));
+            if (it != to.end()) {
+                best = std::max(best, pair_cap(a, it->first, n_from, n_to));
+            }
+            if (it != to.begin()) {
+                best = std::max(best, pair_cap(a, std::prev(it)->first, n_from, n_to));
+            }
+        }
+        caps.emplace_back(best, count);
+    }
+    return caps;
+}
+
+int count_at_least(const Histogram& caps, int k) {
+    int count = 0;
+    for (const auto& [cap, n] : caps) {
+        count += cap >= k ? n : 0;
+    }
+    return count;
+}
+
+// Sum over levels of min(nodes at l, partner nodes within offset of l)
+int window_sum(const std::vector<int>& from, const std::vector<int>& to, int offset) {
+    std::vector<int> prefix(to.size() + 1, 0);
+    for (size_t l = 0; l < to.size(); ++l) {
+        prefix[l + 1] = prefix[l] + to[l];
+    }
+    const int num_to = static_cast<int>(to.size());
+    int total = 0;
+    for (int l = 0; l < static_cast<int>(from.size()); ++l) {
+        const int lo = std::clamp(l - offset, 0, num_to);
+        const int hi = std::clamp(l + offset + 1, 0, num_to);
+        total += std::min(from[l], lo < hi ? prefix[hi] - prefix[lo] : 0);
+    }
+    return total;
+}
+
+}  // namespace
+
+int MCISBounds::label_bound(const GraphSummary& s1, const GraphSummary& s2) {
+    int bound = 0;
+    for (int label = 0; label < NUM_OP_LABELS; ++label) {
+        bound += std::min(s1.label_counts[label], s2.label_counts[label]);
+    }
+    return bound;
+}
+
+int MCISBounds::degree_bound(const GraphSummary& s1, const GraphSummary& s2) {
+    std::vector<Histogram> caps1(NUM_OP_LABELS);
+    std::vector<Histogram> caps2(NUM_OP_LABELS);
+    for (int label = 0; label < NUM_OP_LABELS; ++label) {
+        caps1[label] = degree_caps(s1.degree_histograms[label], s2.degree_histograms[label],
+                                   s1.num_nodes, s2.num_nodes);
+        caps2[label] = degree_caps(s2.degree_histograms[label], s1.degree_histograms[label],
+                                   s2.num_nodes, s1.num_nodes);
+    }
+    auto reaches = [&](int k) {
+        int usable = 0;
+        for (int label = 0; label < NUM_OP_LABELS; ++label) {
+            usable += std::min(count_at_least(caps1[label], k), count_at_least(caps2[label], k));
+        }
+        return usable >= k;
+    };
+
+    // Usable nodes only get fewer as k grows, so the feasible sizes form a prefix
+    int lo = 0;
+    int hi = label_bound(s1, s2);
+    while (lo < hi) {
+        const int mid = (lo + hi + 1) / 2;
+        if (reaches(mid)) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
+
+int MCISBounds::level_histogram_bound(const GraphSummary& s1, const GraphSummary& s2,
+                                      const MCISOptions& options) {
+    if (!uses_levels(s1, s2, options)) {
+        return label_bound(s1, s2);
+    }
+    int bound = 0;
+    for (int label = 0; label < NUM_OP_LABELS; ++label) {
+        const auto& h1 = s1.level_histograms[label];
+        const auto& h2 = s2.level_histograms[label];
+        bound += std::min(window_sum(h1, h2, options.max_level_offset),
+                          window_sum(h2, h1, options.max_level_offset));
+    }
+    return bound;
+}
+
+int MCISBounds::colouring_bound(const GraphSummary& s1, const GraphSummary& s2,
+                                const MCISOptions& options) {
+    if (!uses_levels(s1, s2, options)) {
+        return label_bound(s1, s2);
+    }
+    const int offset = options.max_level_offset;
+    int matched = 0;
+    for (int label = 0; label < NUM_OP_LABELS; ++label) {
+        const auto& h1 = s1.level_histograms[label];
+        std::vector<int> remaining = s2.level_histograms[label];
+        const int num_levels2 = static_cast<int>(remaining.size());
+
+        // Windows slide forward with l, so each g1 level takes the lowest free g2 levels it may
+        int first = 0;
+        for (int l = 0; l < static_cast<int>(h1.size()); ++l) {
+            first = std::max(first, l - offset);
+            int need = h1[l];
+            for (int j = first; j < num_levels2 && j <= l + offset && need > 0; ++j) {
+                const int take = std::min(need, remaining[j]);
+                remaining[j] -= take;
+                need -= take;
+                matched += take;
+            }
+        }
+    }
+    return matched;
+}
+
+int MCISBounds::upper_bound(const GraphSummary& s1, const GraphSummary& s2,
+                            const MCISOptions& options) {
+    return std::min({label_bound(s1, s2), degree_bound(s1, s2),
+                     level_histogram_bound(s1, s2, options), colouring_bound(s1, s2, options)});
+}
+
+int MCISBounds::upper_bound(const Graph& g1, const Graph& g2, const MCISOptions& options) {
+    return upper_bound(g1.get_summary(), g2.get_summary(), options);
+}
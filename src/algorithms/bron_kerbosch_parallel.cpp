@@ -0,0 +1,63 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "bron_kerbosch_parallel.h"
+
+#include "association_graph.h"
+#include "checkpoint.h"
+#include "level_bound.h"
+#include "mcis/indexed_graph.h"
+#include "parallel_search.h"
+#include "vertex_order.h"
+
+MCISResult BronKerboschParallel::find_mapping(const Graph& g1, const Graph& g2) {
+    return improve_mapping(g1, g2, MCISResult());
+}
+
+MCISResult BronKerboschParallel::improve_mapping(const Graph& g1, const Graph& g2,
+                                                 const MCISResult& incumbent) {
+    IndexedGraph i1(g1);
+    IndexedGraph i2(g2);
+    AssociationGraph association(i1, i2, options);
+    const int n = association.get_num_vertices();
+
+    Bitset all(n);
+    all.set_all();
+    ParallelCliqueSearch<Bitset> search(association.get_adjacency().data(), Bitset(n),
+                                        num_threads);
+    if (AssociationGraph::uses_levels(i1, i2, options)) {
+        search.set_bound([&]() { return LevelHistogramBound(association, i1, i2); });
+    }
+    if (options.branching == BranchingPolicy::SMALLEST_DOMAIN) {
+        search.set_branching(VertexOrder::smallest_domain(
+            association.get_pairs(), i1.get_num_nodes(), i2.get_num_nodes(), Bitset(n)));
+    }
+    search.set_checkpoint(options.checkpoint_path, options.checkpoint_interval,
+                          association.get_fingerprint(), n);
+
+    SearchCheckpoint checkpoint;
+    const bool resumed = !options.resume_path.empty() && checkpoint.load(options.resume_path)
+                         && search.resume(checkpoint) >= 0;
+    if (!resumed) {
+        const Bitset seed = association.get_clique(i1, i2, incumbent.mapping);
+        const bool seeded = static_cast<int>(seed.count()) == incumbent.size();
+        search.run(all, incumbent.size(), seeded ? &seed : nullptr);
+    }
+
+    MCISResult result;
+    // A resumed search may finish below an incumbent found since the checkpoint
+    if (static_cast<int>(search.get_best().count()) <= incumbent.size()) {
+        result.mapping = incumbent.mapping;
+    } else {
+        search.get_best().for_each([&](size_t p) {
+            const auto [u, v] = association.get_pair(static_cast<int>(p));
+            result.mapping.emplace_back(i1.get_id(u), i2.get_id(v));
+        });
+    }
+    result.nodes_explored = search.get_nodes_explored();
+    return result;
+}
@@ -0,0 +1,42 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef BRON_KERBOSCH_PARALLEL_H
+#define BRON_KERBOSCH_PARALLEL_H
+
+#include "mcis/graph.h"
+#include "mcis_finder.h"
+
+/**
+ * @class BronKerboschParallel
+ *
+ * Multi-threaded counterpart of BronKerboschSerial: the maximum clique of the association graph
+ * is searched by ParallelCliqueSearch on all OpenMP threads, with work stealing and a shared
+ * incumbent. Level-constrained searches use one level-histogram bound per worker, and an
+ * incumbent passed to improve_mapping seeds the shared bound. Orbital branching is not applied,
+ * since its orbit computations are serial. With options.checkpoint_path set, the search
+ * periodically saves its frontier there, and with options.resume_path set it continues from a
+ * saved frontier of the same instance.
+ */
+class BronKerboschParallel : public MCISFinder {
+private:
+    int num_threads;
+
+public:
+    /**
+     * @brief Creates the finder.
+     * @param threads Number of search workers; 0 uses the OpenMP default.
+     */
+    explicit BronKerboschParallel(int threads = 0) : num_threads(threads) {}
+
+    MCISResult find_mapping(const Graph& g1, const Graph& g2) override;
+
+    MCISResult improve_mapping(const Graph& g1, const Graph& g2,
+                               const MCISResult& incumbent) override;
+};
+
+#endif  // BRON_KERBOSCH_PARALLEL_H
@@ -7,10 +7,63 @@
 
 #include "bron_kerbosch_serial.h"
 
-#include <iostream>
+#include "association_graph.h"
+#include "bron_kerbosch_parallel.h"
+#include "clique_search.h"
+#include "level_bound.h"
+#include "mcis/indexed_graph.h"
+#include "orbital_branching.h"
+#include "vertex_order.h"
 
-std::vector<Graph*> BronKerboschSerial::find(const Graph& g1, const Graph& g2) {
-    // Placeholder implementation
-    std::cout << "Bron-Kerbosch Serial algorithm not yet implemented.\n";
-    return {};
+MCISResult BronKerboschSerial::find_mapping(const Graph& g1, const Graph& g2) {
+    return improve_mapping(g1, g2, MCISResult());
+}
+
+MCISResult BronKerboschSerial::improve_mapping(const Graph& g1, const Graph& g2,
+                                               const MCISResult& incumbent) {
+    // Orbital pruning depends on the path to each search node, which a saved frontier does not
+    // record, so checkpointed searches run on the single-threaded work-stealing driver instead
+    if (!options.checkpoint_path.empty() || !options.resume_path.empty()) {
+        BronKerboschParallel checkpointed(1);
+        checkpointed.set_options(options);
+        return checkpointed.improve_mapping(g1, g2, incumbent);
+    }
+
+    IndexedGraph i1(g1);
+    IndexedGraph i2(g2);
+    AssociationGraph association(i1, i2, options);
+    const int n = association.get_num_vertices();
+
+    Bitset all(n);
+    all.set_all();
+    MaxCliqueSearch<Bitset> search(association.get_adjacency().data(), Bitset(n));
+
+    // Symmetric generated graphs (MVM rows, FFT butterflies) otherwise revisit equivalent branches
+    OrbitalBranching orbits(association, i1, i2);
+    if (orbits.applies()) {
+        search.set_symmetry(
+            [&](const std::vector<int>& clique, std::vector<int>& orbit) {
+                return orbits.get_orbits(clique, orbit, search.get_orbit_saved());
+            },
+            SYMMETRY_BREAKING_DEPTH);
+    }
+    if (AssociationGraph::uses_levels(i1, i2, options)) {
+        search.set_bound(LevelHistogramBound(association, i1, i2));
+    }
+    if (options.branching == BranchingPolicy::SMALLEST_DOMAIN) {
+        search.set_branching(VertexOrder::smallest_domain(
+            association.get_pairs(), i1.get_num_nodes(), i2.get_num_nodes(), Bitset(n)));
+    }
+    search.run(all, incumbent.size());
+
+    MCISResult result;
+    if (!search.get_best().any()) {
+        result.mapping = incumbent.mapping;
+    }
+    search.get_best().for_each([&](size_t p) {
+        const auto [u, v] = association.get_pair(static_cast<int>(p));
+        result.mapping.emplace_back(i1.get_id(u), i2.get_id(v));
+    });
+    result.nodes_explored = search.get_nodes_explored();
+    return result;
 }
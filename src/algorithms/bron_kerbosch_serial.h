@@ -16,12 +16,20 @@
 /**
  * @class BronKerboschSerial
  *
- * Implements the Bron-Kerbosch algorithm for finding maximal cliques in an undirected graph.
- * This is a serial implementation without optimizations.
+ * Finds the MCIS as a maximum clique of the association graph of g1 and g2, using the
+ * Bron-Kerbosch algorithm with Tomita pivoting over dynamic bitsets. The first levels are pruned
+ * with the orbits of the stabilizers of both graphs' automorphism groups (see OrbitalBranching),
+ * skipped entirely when both groups are trivial; level-constrained searches use the level-histogram
+ * bound, and an incumbent passed to improve_mapping seeds the size bound. This is a serial
+ * implementation; checkpointed or resumed searches (see MCISOptions) run on a single
+ * BronKerboschParallel worker without orbital pruning.
  */
 class BronKerboschSerial : public MCISFinder {
 public:
-    std::vector<Graph*> find(const Graph& g1, const Graph& g2) override;
+    MCISResult find_mapping(const Graph& g1, const Graph& g2) override;
+
+    MCISResult improve_mapping(const Graph& g1, const Graph& g2,
+                               const MCISResult& incumbent) override;
 };
 
 #endif  // BRON_KERBOSCH_SERIAL_H
@@ -0,0 +1,156 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "checkpoint.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+namespace {
+
+const char MAGIC[8] = {'M', 'C', 'I', 'S', 'C', 'K', 'P', '1'};
+
+void write_varint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+// Sorted vertices as their count followed by the gaps between consecutive vertices
+void write_vertices(std::string& out, std::vector<int> vertices) {
+    std::sort(vertices.begin(), vertices.end());
+    write_varint(out, vertices.size());
+    int previous = 0;
+    for (int v : vertices) {
+        write_varint(out, static_cast<uint64_t>(v - previous));
+        previous = v;
+    }
+}
+
+class Reader {
+private:
+    const std::string& data;
+    size_t position = 0;
+
+public:
+    bool ok = true;
+
+    Reader(const std::string& data, size_t position) : data(data), position(position) {}
+
+    uint64_t varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (position >= data.size()) {
+                ok = false;
+                return 0;
+            }
+            const auto byte = static_cast<unsigned char>(data[position++]);
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        ok = false;
+        return 0;
+    }
+
+    // Vertices must lie in [0, limit)
+    std::vector<int> vertices(int limit) {
+        const uint64_t count = varint();
+        if (!ok || count > static_cast<uint64_t>(limit)) {
+            ok = false;
+            return {};
+        }
+        std::vector<int> result;
+        result.reserve(count);
+        uint64_t v = 0;
+        for (uint64_t i = 0; i < count && ok; ++i) {
+            v += varint();
+            if (v >= static_cast<uint64_t>(limit)) {
+                ok = false;
+                return {};
+            }
+            result.push_back(static_cast<int>(v));
+        }
+        return result;
+    }
+
+    [[nodiscard]]
+    bool at_end() const {
+        return position == data.size();
+    }
+};
+
+}  // namespace
+
+bool SearchCheckpoint::save(const std::string& path) const {
+    std::string out(MAGIC, sizeof(MAGIC));
+    for (int shift = 0; shift < 64; shift += 8) {
+        out.push_back(static_cast<char>((fingerprint >> shift) & 0xff));
+    }
+    write_varint(out, static_cast<uint64_t>(num_vertices));
+    write_varint(out, static_cast<uint64_t>(best_size));
+    write_varint(out, static_cast<uint64_t>(nodes_explored));
+    write_vertices(out, best);
+    write_varint(out, frontier.size());
+    for (const Node& node : frontier) {
+        write_vertices(out, node.clique);
+        write_vertices(out, node.candidates);
+    }
+
+    const std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file.write(out.data(), static_cast<std::streamsize>(out.size())) || !file.flush()) {
+            return false;
+        }
+    }
+    return std::rename(temporary.c_str(), path.c_str()) == 0;
+}
+
+bool SearchCheckpoint::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    const std::string data((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+    if (data.size() < sizeof(MAGIC) + 8
+        || !std::equal(MAGIC, MAGIC + sizeof(MAGIC), data.begin())) {
+        return false;
+    }
+
+    SearchCheckpoint loaded;
+    for (int i = 0; i < 8; ++i) {
+        const auto byte = static_cast<unsigned char>(data[sizeof(MAGIC) + i]);
+        loaded.fingerprint |= static_cast<uint64_t>(byte) << (8 * i);
+    }
+    Reader reader(data, sizeof(MAGIC) + 8);
+    loaded.num_vertices = static_cast<int>(reader.varint());
+    if (loaded.num_vertices < 0) {
+        return false;
+    }
+    loaded.best_size = static_cast<int>(reader.varint());
+    loaded.nodes_explored = static_cast<long long>(reader.varint());
+    loaded.best = reader.vertices(loaded.num_vertices);
+    const uint64_t count = reader.varint();
+    for (uint64_t i = 0; i < count && reader.ok; ++i) {
+        Node node;
+        node.clique = reader.vertices(loaded.num_vertices);
+        node.candidates = reader.vertices(loaded.num_vertices);
+        loaded.frontier.push_back(std::move(node));
+    }
+    if (!reader.ok || !reader.at_end()) {
+        return false;
+    }
+    *this = std::move(loaded);
+    return true;
+}
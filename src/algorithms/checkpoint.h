@@ -0,0 +1,67 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Number of child search nodes a worker visits between two checks of the checkpoint clock.
+ */
+constexpr long long CHECKPOINT_CLOCK_STRIDE = 4096;
+
+/**
+ * @class SearchCheckpoint
+ *
+ * Snapshot of a clique search over a numbered vertex set: the unexplored search nodes (each a
+ * clique and its candidates), the best clique so far and the statistics. Vertex lists are stored
+ * sorted as LEB128-encoded gaps, so a frontier of sparse candidate sets takes a few bytes per
+ * vertex. Files are written to a temporary path and renamed, so an interrupted write never
+ * replaces the previous checkpoint.
+ */
+class SearchCheckpoint {
+public:
+    /**
+     * @struct Node
+     * @brief One unexplored search node.
+     */
+    struct Node {
+        std::vector<int> clique;
+        std::vector<int> candidates;
+    };
+
+    /**
+     * @brief Identifies the search instance; a checkpoint is only resumed by a search with the
+     * same fingerprint.
+     */
+    uint64_t fingerprint = 0;
+
+    int num_vertices = 0;
+    int best_size = 0;
+    std::vector<int> best;
+    long long nodes_explored = 0;
+    std::vector<Node> frontier;
+
+    /**
+     * @brief Writes the checkpoint.
+     * @param path Destination file.
+     * @return True if the file was written completely, false otherwise.
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * @brief Reads a checkpoint written by save.
+     * @param path Source file.
+     * @return True if the file was read completely, false if it is missing or malformed.
+     */
+    bool load(const std::string& path);
+};
+
+#endif  // CHECKPOINT_H
@@ -0,0 +1,349 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef CLIQUE_SEARCH_H
+#define CLIQUE_SEARCH_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * @class MaxCliqueSearch
+ *
+ * Bron-Kerbosch search for a maximum clique with Tomita pivoting and a |R| + |P| size bound.
+ * Templated on the vertex set type so that the same search runs on the dynamic Bitset or on an
+ * allocation-free FixedBitset<N> for small instances.
+ *
+ * @tparam Set Bitset-like type providing set/reset/test/count/any/find_first/and_count/and_not/
+ * assign_and_count.
+ */
+template <typename Set>
+class MaxCliqueSearch {
+public:
+    /**
+     * @brief Computes the symmetry orbits of the subproblem below a search node: given the clique
+     * so far, assigns every vertex an orbit ID under the symmetries of the instance that fix each
+     * clique vertex. Returns false if there is nothing to prune or the orbits are not exact.
+     */
+    using OrbitFunction
+        = std::function<bool(const std::vector<int>& clique, std::vector<int>& orbit)>;
+
+    /**
+     * @brief Computes an upper bound on the size of any clique within a candidate set.
+     */
+    using BoundFunction = std::function<int(const Set& candidates)>;
+
+    /**
+     * @brief Picks the next vertex to branch on from the non-empty branch set, given all
+     * remaining candidates of the search node.
+     */
+    using BranchFunction = std::function<long(const Set& branch, const Set& candidates)>;
+
+    /**
+     * @brief Offered every child search node (the clique including the branch vertex, and its
+     * candidates) before it is searched; returns true if it takes the child over, e.g. to hand it
+     * to another thread, in which case the child is skipped here.
+     */
+    using SplitFunction = std::function<bool(const std::vector<int>& clique, const Set& candidates,
+                                             size_t candidate_count)>;
+
+private:
+    /**
+     * @brief Neighborhood of each vertex.
+     */
+    const Set* adjacency;
+
+    /**
+     * @brief Optional orbit callback and the number of clique levels it is applied to.
+     */
+    OrbitFunction orbit_function;
+    int symmetry_depth = 0;
+
+    /**
+     * @brief Optional bound tightening the |R| + |P| test.
+     */
+    BoundFunction bound_function;
+
+    /**
+     * @brief Optional branching policy; the lowest-numbered vertex is taken otherwise.
+     */
+    BranchFunction branch_function;
+
+    /**
+     * @brief Optional hand-off of child search nodes.
+     */
+    SplitFunction split_function;
+
+    /**
+     * @brief Optional incumbent size shared with other searches; pruning uses the larger of it
+     * and the local best.
+     */
+    std::atomic<int>* shared_best = nullptr;
+
+    /**
+     * @brief Optional interruption flag and the callback receiving the unexplored search nodes
+     * once it is raised.
+     */
+    const std::atomic<bool>* interrupt = nullptr;
+    SplitFunction emit_function;
+
+    /**
+     * @brief An empty set of the right size, copied to create working sets.
+     */
+    Set empty;
+
+    Set current;
+    std::vector<int> clique;
+    int current_size = 0;
+    Set best;
+    int best_size = 0;
+    long long nodes_explored = 0;
+    long long orbit_saved = 0;
+
+    [[nodiscard]]
+    int incumbent() const {
+        return shared_best ? std::max(best_size, shared_best->load(std::memory_order_relaxed))
+                           : best_size;
+    }
+
+    void record() {
+        best = current;
+        best_size = current_size;
+        if (shared_best) {
+            int known = shared_best->load(std::memory_order_relaxed);
+            while (known < best_size
+                   && !shared_best->compare_exchange_weak(known, best_size,
+                                                          std::memory_order_relaxed)) {
+            }
+        }
+    }
+
+    /**
+     * @brief Hands every remaining branch of a search node to emit_function, as the loop in
+     * expand would have searched them.
+     */
+    void emit_rest(Set& branch, Set& remaining) {
+        Set next = empty;
+        branch.for_each([&](size_t v) {
+            const size_t next_count = next.assign_and_count(remaining, adjacency[v]);
+            if (current_size + 1 + static_cast<int>(next_count) > incumbent()) {
+                clique.push_back(static_cast<int>(v));
+                emit_function(clique, next, next_count);
+                clique.pop_back();
+            }
+            remaining.reset(v);
+        });
+    }
+
+    void expand(const Set& candidates, size_t candidate_count, bool symmetric) {
+        nodes_explored++;
+        if (current_size > incumbent()) {
+            record();
+        }
+        if (candidate_count == 0
+            || current_size + static_cast<int>(candidate_count) <= incumbent()) {
+            return;
+        }
+        if (bound_function && current_size + bound_function(candidates) <= incumbent()) {
+            return;
+        }
+
+        // Tomita pivot: the candidate with the most neighbors among the candidates
+        long pivot = -1;
+        size_t pivot_degree = 0;
+        candidates.for_each([&](size_t u) {
+            const size_t degree = candidates.and_count(adjacency[u]);
+            if (pivot < 0 || degree > pivot_degree) {
+                pivot = static_cast<long>(u);
+                pivot_degree = degree;
+            }
+        });
+
+        // Orbital branching: the remaining candidates are always a union of orbits of the current
+        // stabilizer, so once v is searched the rest of its orbit can only repeat its cliques
+        std::vector<int> orbit;
+        const bool prune = symmetric && current_size < symmetry_depth
+                           && orbit_function(clique, orbit);
+
+        Set branch = candidates;
+        branch.and_not(adjacency[pivot]);
+        Set remaining = candidates;
+        size_t remaining_count = candidate_count;
+        Set next = empty;
+
+        while (branch.any()) {
+            if (interrupt && interrupt->load(std::memory_order_relaxed)) {
+                emit_rest(branch, remaining);
+                return;
+            }
+            const long v = branch_function ? branch_function(branch, remaining)
+                                           : branch.find_first();
+            branch.reset(v);
+
+            const size_t next_count = next.assign_and_count(remaining, adjacency[v]);
+            current.set(v);
+            clique.push_back(static_cast<int>(v));
+            current_size++;
+            const long long before = nodes_explored;
+            if (!(split_function && split_function(clique, next, next_count))) {
+                expand(next, next_count, prune);
+            }
+            current.reset(v);
+            clique.pop_back();
+            current_size--;
+
+            remaining.reset(v);
+            remaining_count--;
+            if (prune) {
+                Set same = empty;
+                remaining.for_each([&](size_t w) {
+                    if (orbit[w] == orbit[v]) {
+                        same.set(w);
+                    }
+                });
+                branch.and_not(same);
+                remaining.and_not(same);
+                // Each dropped candidate would have repeated the search below v
+                const size_t count = remaining.count();
+                orbit_saved += static_cast<long long>(remaining_count - count)
+                               * (nodes_explored - before);
+                remaining_count = count;
+            }
+            if (current_size + static_cast<int>(remaining_count) <= incumbent()) {
+                break;
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Prepares a search over the given adjacency rows.
+     * @param adjacency Neighborhood set of every vertex; must outlive the search.
+     * @param empty An empty set sized for the vertex count.
+     */
+    MaxCliqueSearch(const Set* adjacency, const Set& empty)
+        : adjacency(adjacency), empty(empty), current(empty), best(empty) {}
+
+    /**
+     * @brief Enables symmetry breaking in the first levels of the search: once the branch on a
+     * vertex has been searched, the other vertices of its orbit are dropped from that node, so
+     * only the lexicographically first vertex of each orbit is branched on. Below a node whose
+     * callback returned false no further orbits are requested.
+     * @param orbits Orbit callback.
+     * @param depth Number of clique levels at which orbits are computed.
+     */
+    void set_symmetry(OrbitFunction orbits, int depth) {
+        orbit_function = std::move(orbits);
+        symmetry_depth = depth;
+    }
+
+    /**
+     * @brief Installs an additional upper bound checked at every search node.
+     * @param bound Bound callback; must never underestimate.
+     */
+    void set_bound(BoundFunction bound) { bound_function = std::move(bound); }
+
+    /**
+     * @brief Installs a dynamic branching policy.
+     * @param branch Callback returning a vertex of the branch set.
+     */
+    void set_branching(BranchFunction branch) { branch_function = std::move(branch); }
+
+    /**
+     * @brief Installs a hand-off callback for child search nodes.
+     * @param split Split callback.
+     */
+    void set_split(SplitFunction split) { split_function = std::move(split); }
+
+    /**
+     * @brief Shares the incumbent size with other searches. Only cliques larger than every
+     * incumbent seen so far are recorded in get_best.
+     * @param shared Shared incumbent size; must outlive the search.
+     */
+    void set_shared_best(std::atomic<int>* shared) { shared_best = shared; }
+
+    /**
+     * @brief Makes the search stop as soon as a flag is raised. Every search node on the current
+     * path then passes its unexplored branches to a callback before returning, so the callback
+     * receives the exact remaining frontier and nothing is searched twice on resumption.
+     * @param flag Interruption flag; must outlive the search.
+     * @param emit Receives each unexplored search node; its return value is ignored.
+     */
+    void set_interrupt(const std::atomic<bool>* flag, SplitFunction emit) {
+        interrupt = flag;
+        emit_function = std::move(emit);
+    }
+
+    /**
+     * @brief Finds a maximum clique among the given candidate vertices.
+     * @param candidates Vertices allowed in the clique.
+     * @param lower_bound Size of a clique already known elsewhere; only larger cliques are
+     * recorded, so get_best stays empty if none exists.
+     * @return The size of the maximum clique, or lower_bound if no larger clique exists.
+     */
+    int run(const Set& candidates, int lower_bound = 0) {
+        reset(lower_bound);
+        expand(candidates, candidates.count(), static_cast<bool>(orbit_function));
+        return best_size;
+    }
+
+    /**
+     * @brief Clears the best clique and the statistics before a series of run_subproblem calls.
+     * @param lower_bound Size of a clique already known elsewhere.
+     */
+    void reset(int lower_bound = 0) {
+        best = empty;
+        best_size = lower_bound;
+        nodes_explored = 0;
+        orbit_saved = 0;
+    }
+
+    /**
+     * @brief Searches the cliques extending a given clique within its candidates, keeping the best
+     * clique of earlier calls since the last reset. Symmetry breaking is not applied.
+     * @param start Clique of the search node; every candidate must be adjacent to all of it.
+     * @param candidates Candidates of the search node.
+     * @param candidate_count Number of candidates.
+     * @return The size of the best clique found since the last reset.
+     */
+    int run_subproblem(const std::vector<int>& start, const Set& candidates,
+                       size_t candidate_count) {
+        current = empty;
+        for (int v : start) {
+            current.set(v);
+        }
+        clique = start;
+        current_size = static_cast<int>(start.size());
+        expand(candidates, candidate_count, false);
+        return best_size;
+    }
+
+    [[nodiscard]]
+    const Set& get_best() const {
+        return best;
+    }
+
+    [[nodiscard]]
+    long long get_nodes_explored() const {
+        return nodes_explored;
+    }
+
+    /**
+     * @brief Estimates the search nodes orbital branching has saved since the last reset: every
+     * dropped candidate counts the size of the search below its symmetric sibling.
+     */
+    [[nodiscard]]
+    long long get_orbit_saved() const {
+        return orbit_saved;
+    }
+};
+
+#endif  // CLIQUE_SEARCH_H
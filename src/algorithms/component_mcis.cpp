@@ -0,0 +1,155 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "component_mcis.h"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "assignment.h"
+#include "bron_kerbosch_serial.h"
+#include "mcis/mcis_algorithm.h"
+#include "mcis/vf3.h"
+
+namespace {
+
+/**
+ * @brief A weakly connected component, its isomorphism class, and the node mapping from the
+ * class representative onto it (empty for the representative itself).
+ */
+struct Component {
+    Graph graph;
+    int cls = -1;
+    std::unordered_map<std::string, std::string> from_rep;
+};
+
+/**
+ * @brief Isomorphism invariant: node and edge counts and the sorted (label, in, out) degree
+ * sequence.
+ */
+std::vector<int> invariant(const Graph& graph) {
+    std::vector<std::tuple<int, int, int>> degrees;
+    int edges = 0;
+    for (const auto& [_, node] : graph.get_nodes()) {
+        degrees.emplace_back(static_cast<int>(node->get_label()), node->get_num_parents(),
+                             node->get_num_children());
+        edges += node->get_num_children();
+    }
+    std::sort(degrees.begin(), degrees.end());
+    std::vector<int> key = {graph.get_num_nodes(), edges};
+    for (const auto& [label, in, out] : degrees) {
+        key.insert(key.end(), {label, in, out});
+    }
+    return key;
+}
+
+std::vector<Component> split(const Graph& graph) {
+    std::vector<Component> components;
+    for (const auto& ids : graph.get_weakly_connected_components()) {
+        components.push_back({graph.induced_subgraph(ids), -1, {}});
+    }
+    return components;
+}
+
+}  // namespace
+
+MCISResult ComponentMCIS::solve_pair(const Graph& g1, const Graph& g2,
+                                     const MCISOptions& options) {
+    if (auto small = MCISAlgorithm::solve_small_instance(g1, g2, options)) {
+        return *small;
+    }
+    BronKerboschSerial solver;
+    solver.set_options(options);
+    return solver.find_mapping(g1, g2);
+}
+
+MCISResult ComponentMCIS::find_mapping(const Graph& g1, const Graph& g2) {
+    std::vector<Component> parts1 = split(g1);
+    std::vector<Component> parts2 = split(g2);
+    if (parts1.size() <= 1 && parts2.size() <= 1) {
+        return solve_pair(g1, g2, options);
+    }
+
+    // Group the components of both graphs into isomorphism classes
+    std::vector<const Component*> reps;
+    std::map<std::vector<int>, std::vector<int>> buckets;
+    for (auto* parts : {&parts1, &parts2}) {
+        for (Component& part : *parts) {
+            std::vector<int>& bucket = buckets[invariant(part.graph)];
+            for (int cls : bucket) {
+                VF3Matcher matcher(reps[cls]->graph, part.graph);
+                matcher.set_state_limit(EMBEDDING_CHECK_STATE_LIMIT);
+                if (auto mapping = matcher.find()) {
+                    part.cls = cls;
+                    part.from_rep.insert(mapping->begin(), mapping->end());
+                    break;
+                }
+            }
+            if (part.cls < 0) {
+                part.cls = static_cast<int>(reps.size());
+                bucket.push_back(part.cls);
+                reps.push_back(&part);
+            }
+        }
+    }
+
+    // Solve each distinct pair of classes once, in parallel
+    std::map<std::pair<int, int>, int> task_of;
+    std::vector<std::pair<int, int>> tasks;
+    for (const Component& a : parts1) {
+        for (const Component& b : parts2) {
+            if (task_of.emplace(std::pair{a.cls, b.cls}, static_cast<int>(tasks.size())).second) {
+                tasks.emplace_back(a.cls, b.cls);
+            }
+        }
+    }
+    const MCISOptions sub_options = options.for_subproblem();
+    std::vector<MCISResult> solved(tasks.size());
+#pragma omp parallel for schedule(dynamic)
+    for (size_t t = 0; t < tasks.size(); ++t) {
+        solved[t]
+            = solve_pair(reps[tasks[t].first]->graph, reps[tasks[t].second]->graph, sub_options);
+    }
+
+    // Use each component at most once
+    std::vector<std::vector<long long>> weights(parts1.size(),
+                                                std::vector<long long>(parts2.size()));
+    for (size_t i = 0; i < parts1.size(); ++i) {
+        for (size_t j = 0; j < parts2.size(); ++j) {
+            weights[i][j] = solved[task_of.at({parts1[i].cls, parts2[j].cls})].size();
+        }
+    }
+    std::vector<int> assignment = HungarianAssignment::solve(weights);
+
+    MCISResult result;
+    result.optimal = true;
+    for (const MCISResult& pair : solved) {
+        result.nodes_explored += pair.nodes_explored;
+        result.optimal = result.optimal && pair.optimal;
+    }
+    auto image = [](const Component& part, const std::string& id) {
+        return part.from_rep.empty() ? id : part.from_rep.at(id);
+    };
+    for (size_t i = 0; i < parts1.size(); ++i) {
+        if (assignment[i] < 0) {
+            continue;
+        }
+        const Component& a = parts1[i];
+        const Component& b = parts2[assignment[i]];
+        for (const auto& [id1, id2] : solved[task_of.at({a.cls, b.cls})].mapping) {
+            result.mapping.emplace_back(image(a, id1), image(b, id2));
+        }
+    }
+    result.optimal = result.optimal
+                     && result.size() == std::min(g1.get_num_nodes(), g2.get_num_nodes());
+    return result;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef COMPONENT_MCIS_H
+#define COMPONENT_MCIS_H
+
+#include "mcis/graph.h"
+#include "mcis_finder.h"
+
+/**
+ * @class ComponentMCIS
+ *
+ * Splits both graphs into weakly connected components and solves every pair of components
+ * independently and in parallel, then combines the pairs with a maximum-weight assignment so that
+ * each component is used at most once. Isomorphic components are grouped first, so each pair of
+ * isomorphism classes is solved only once and its mapping is carried over to the other members.
+ *
+ * When either graph has several components the result is a lower bound: a disconnected common
+ * subgraph may spread over several components of the same graph. It is reported as optimal only
+ * when both graphs are connected or when the whole smaller graph is matched.
+ */
+class ComponentMCIS : public MCISFinder {
+public:
+    MCISResult find_mapping(const Graph& g1, const Graph& g2) override;
+
+    /**
+     * @brief Solves one pair of graphs exactly, with the small-graph solver when it fits and the
+     * serial Bron-Kerbosch solver otherwise.
+     */
+    static MCISResult solve_pair(const Graph& g1, const Graph& g2, const MCISOptions& options);
+};
+
+#endif  // COMPONENT_MCIS_H
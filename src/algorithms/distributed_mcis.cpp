@@ -0,0 +1,689 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "distributed_mcis.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <omp.h>
+#include <poll.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "association_graph.h"
+#include "clique_search.h"
+#include "level_bound.h"
+#include "mcis/indexed_graph.h"
+#include "vertex_order.h"
+
+extern char** environ;
+
+namespace {
+
+// Message types; every frame is the type byte, the number of values and the values, each
+// 4 bytes little-endian
+constexpr char CONFIG = 'C';    // coordinator: level constraint, level offset, ordering, branching
+constexpr char HELLO = 'H';     // worker: vertex count, fingerprint (low, high)
+constexpr char TASK = 'T';      // coordinator: incumbent size, clique size, clique, candidates
+constexpr char BOUND = 'B';     // coordinator: incumbent size
+constexpr char HUNGRY = 'G';    // coordinator: number of search nodes to donate
+constexpr char DONATE = 'D';    // worker: clique size, clique, candidates
+constexpr char IMPROVED = 'I';  // worker: clique
+constexpr char DONE = 'E';      // worker: nodes explored (low, high)
+constexpr char STOP = 'S';      // coordinator
+
+struct Task {
+    std::vector<int> clique;
+    std::vector<int> candidates;
+};
+
+class Channel {
+private:
+    int fd;
+    std::string buffer;
+
+public:
+    explicit Channel(int fd) : fd(fd) {}
+
+    Channel(const Channel&) = delete;
+    Channel& operator=(const Channel&) = delete;
+
+    ~Channel() {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+
+    [[nodiscard]]
+    int get_fd() const {
+        return fd;
+    }
+
+    bool send(char type, const std::vector<int>& values) {
+        std::string frame(1, type);
+        auto append = [&](uint32_t value) {
+            for (int i = 0; i < 4; ++i) {
+                frame.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+            }
+        };
+        append(static_cast<uint32_t>(values.size()));
+        for (int value : values) {
+            append(static_cast<uint32_t>(value));
+        }
+        size_t sent = 0;
+        while (sent < frame.size()) {
+            const ssize_t written =
+                ::send(fd, frame.data() + sent, frame.size() - sent, MSG_NOSIGNAL);
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            if (written <= 0) {
+                return false;
+            }
+            sent += static_cast<size_t>(written);
+        }
+        return true;
+    }
+
+    // Appends the bytes available on the socket, waiting for some if block is set; false once
+    // the peer is gone
+    bool fill(bool block) {
+        char chunk[1 << 16];
+        while (true) {
+            const ssize_t received = recv(fd, chunk, sizeof(chunk), block ? 0 : MSG_DONTWAIT);
+            if (received > 0) {
+                buffer.append(chunk, static_cast<size_t>(received));
+                return true;
+            }
+            if (received == 0) {
+                return false;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            return !block && (errno == EAGAIN || errno == EWOULDBLOCK);
+        }
+    }
+
+    // Extracts the next complete frame from the buffer
+    bool next(char& type, std::vector<int>& values) {
+        auto read = [&](size_t offset) {
+            uint32_t value = 0;
+            for (int i = 0; i < 4; ++i) {
+                value |= static_cast<uint32_t>(static_cast<unsigned char>(buffer[offset + i]))
+                         << (8 * i);
+            }
+            return value;
+        };
+        if (buffer.size() < 5) {
+            return false;
+        }
+        const size_t count = read(1);
+        if (buffer.size() < 5 + 4 * count) {
+            return false;
+        }
+        type = buffer[0];
+        values.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            values[i] = static_cast<int>(read(5 + 4 * i));
+        }
+        buffer.erase(0, 5 + 4 * count);
+        return true;
+    }
+
+    // Waits for the next frame; false once the peer is gone
+    bool receive(char& type, std::vector<int>& values) {
+        while (!next(type, values)) {
+            if (!fill(true)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+std::vector<int> encode_task(int bound, const Task& task) {
+    std::vector<int> values;
+    if (bound >= 0) {
+        values.push_back(bound);
+    }
+    values.push_back(static_cast<int>(task.clique.size()));
+    values.insert(values.end(), task.clique.begin(), task.clique.end());
+    values.insert(values.end(), task.candidates.begin(), task.candidates.end());
+    return values;
+}
+
+// Inverse of encode_task from the clique size on; false if the sizes are inconsistent
+bool decode_task(const std::vector<int>& values, size_t offset, Task& task) {
+    if (values.size() <= offset || values[offset] < 0
+        || values.size() - offset - 1 < static_cast<size_t>(values[offset])) {
+        return false;
+    }
+    const auto clique_end = values.begin() + static_cast<long>(offset) + 1 + values[offset];
+    task.clique.assign(values.begin() + static_cast<long>(offset) + 1, clique_end);
+    task.candidates.assign(clique_end, values.end());
+    return true;
+}
+
+// Unique path in the temporary directory, so concurrent searches do not collide
+std::string temp_path(const std::string& extension) {
+    static std::atomic<int> created(0);
+    const std::string name =
+        "mcis-" + std::to_string(getpid()) + "-" + std::to_string(created++) + extension;
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+int listen_on(SocketTransport transport, std::string& address) {
+    if (transport == SocketTransport::UNIX) {
+        const std::string path = temp_path(".sock");
+        sockaddr_un local{};
+        if (path.size() >= sizeof(local.sun_path)) {
+            return -1;
+        }
+        local.sun_family = AF_UNIX;
+        std::strcpy(local.sun_path, path.c_str());
+        unlink(path.c_str());
+        const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0 || bind(fd, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0
+            || listen(fd, SOMAXCONN) != 0) {
+            if (fd >= 0) {
+                close(fd);
+            }
+            return -1;
+        }
+        address = "unix:" + path;
+        return fd;
+    }
+
+    sockaddr_in local{};
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    local.sin_port = 0;
+    socklen_t length = sizeof(local);
+    const int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd < 0 || bind(fd, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0
+        || listen(fd, SOMAXCONN) != 0
+        || getsockname(fd, reinterpret_cast<sockaddr*>(&local), &length) != 0) {
+        if (fd >= 0) {
+            close(fd);
+        }
+        return -1;
+    }
+    address = "tcp:" + std::to_string(ntohs(local.sin_port));
+    return fd;
+}
+
+int connect_to(const std::string& address) {
+    int fd = -1;
+    int status = -1;
+    if (address.rfind("unix:", 0) == 0) {
+        const std::string path = address.substr(5);
+        sockaddr_un remote{};
+        if (path.size() >= sizeof(remote.sun_path)) {
+            return -1;
+        }
+        remote.sun_family = AF_UNIX;
+        std::strcpy(remote.sun_path, path.c_str());
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0) {
+            status = connect(fd, reinterpret_cast<sockaddr*>(&remote), sizeof(remote));
+        }
+    } else if (address.rfind("tcp:", 0) == 0) {
+        sockaddr_in remote{};
+        remote.sin_family = AF_INET;
+        remote.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        remote.sin_port = htons(static_cast<uint16_t>(std::atoi(address.c_str() + 4)));
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd >= 0) {
+            status = connect(fd, reinterpret_cast<sockaddr*>(&remote), sizeof(remote));
+        }
+    }
+    if (status != 0 && fd >= 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Installs the options-dependent bound and branching policy, as BronKerboschSerial does
+void configure(MaxCliqueSearch<Bitset>& search, const AssociationGraph& association,
+               const IndexedGraph& i1, const IndexedGraph& i2, const MCISOptions& options) {
+    const int n = association.get_num_vertices();
+    if (AssociationGraph::uses_levels(i1, i2, options)) {
+        search.set_bound(LevelHistogramBound(association, i1, i2));
+    }
+    if (options.branching == BranchingPolicy::SMALLEST_DOMAIN) {
+        search.set_branching(VertexOrder::smallest_domain(
+            association.get_pairs(), i1.get_num_nodes(), i2.get_num_nodes(), Bitset(n)));
+    }
+}
+
+Bitset to_set(const std::vector<int>& vertices, int n) {
+    Bitset set(n);
+    for (int v : vertices) {
+        set.set(v);
+    }
+    return set;
+}
+
+std::vector<int> to_vertices(const Bitset& set) {
+    std::vector<int> vertices;
+    set.for_each([&](size_t v) { vertices.push_back(static_cast<int>(v)); });
+    return vertices;
+}
+
+// Checks that a reported clique is one, so a faulty worker cannot corrupt the result
+bool is_clique(const AssociationGraph& association, const std::vector<int>& clique) {
+    const int n = association.get_num_vertices();
+    for (size_t i = 0; i < clique.size(); ++i) {
+        if (clique[i] < 0 || clique[i] >= n) {
+            return false;
+        }
+        for (size_t j = 0; j < i; ++j) {
+            if (!association.get_adjacency()[clique[i]].test(clique[j])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+MCISResult DistributedMCIS::find_mapping(const Graph& g1, const Graph& g2) {
+    return improve_mapping(g1, g2, MCISResult());
+}
+
+MCISResult DistributedMCIS::improve_mapping(const Graph& g1, const Graph& g2,
+                                            const MCISResult& incumbent) {
+    donations = 0;
+    IndexedGraph i1(g1);
+    IndexedGraph i2(g2);
+    AssociationGraph association(i1, i2, options);
+    const int n = association.get_num_vertices();
+    const auto& adjacency = association.get_adjacency();
+
+    Bitset best = association.get_clique(i1, i2, incumbent.mapping);
+    int best_size = incumbent.size();
+    if (static_cast<int>(best.count()) != best_size) {
+        best = Bitset(n);
+    }
+    long long nodes_explored = 1;
+
+    // Split the root under Tomita pivoting, one subproblem per branch
+    std::deque<Task> queue;
+    if (n > 0) {
+        int pivot = 0;
+        for (int u = 1; u < n; ++u) {
+            if (adjacency[u].count() > adjacency[pivot].count()) {
+                pivot = u;
+            }
+        }
+        Bitset remaining(n);
+        remaining.set_all();
+        for (int v = 0; v < n; ++v) {
+            if (adjacency[pivot].test(v)) {
+                continue;
+            }
+            Task task{{v}, {}};
+            Bitset candidates(n);
+            const size_t count = candidates.assign_and_count(remaining, adjacency[v]);
+            remaining.reset(v);
+            if (count == 0 && best_size < 1) {
+                best = to_set({v}, n);
+                best_size = 1;
+            }
+            if (1 + static_cast<int>(count) > best_size) {
+                task.candidates = to_vertices(candidates);
+                queue.push_back(std::move(task));
+            }
+        }
+    }
+
+    // Inside a parallel region (e.g. the pairwise solves of run_multi) every thread would start
+    // its own workers, so the subproblems are searched in-process instead
+    int workers = num_workers > 0 ? num_workers : omp_get_max_threads();
+    if (queue.empty() || omp_in_parallel()) {
+        workers = 0;
+    }
+    const std::string graph_path = temp_path(".graphs");
+    std::string address;
+    int listener = -1;
+    if (workers > 0) {
+        std::ofstream file(graph_path, std::ios::binary | std::ios::trunc);
+        if (g1.write_binary(file) && g2.write_binary(file) && file.flush()) {
+            listener = listen_on(transport, address);
+        }
+    }
+
+    // Workers are separate executables rather than forks, since the caller may be multithreaded;
+    // each runs single-threaded and does not inherit the listening socket
+    std::vector<pid_t> children;
+    if (workers > 0 && listener >= 0) {
+        std::vector<std::string> variables;
+        for (char** variable = environ; *variable != nullptr; ++variable) {
+            if (std::strncmp(*variable, "OMP_NUM_THREADS=", 16) != 0) {
+                variables.emplace_back(*variable);
+            }
+        }
+        variables.emplace_back("OMP_NUM_THREADS=1");
+        std::vector<char*> envp;
+        for (std::string& variable : variables) {
+            envp.push_back(variable.data());
+        }
+        envp.push_back(nullptr);
+        std::string program = worker_path;
+        std::vector<char*> argv = {program.data(), address.data(),
+                                   const_cast<char*>(graph_path.c_str()), nullptr};
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_addclose(&actions, listener);
+        for (int w = 0; w < workers; ++w) {
+            pid_t pid = 0;
+            if (posix_spawnp(&pid, program.c_str(), &actions, nullptr, argv.data(), envp.data())
+                != 0) {
+                break;
+            }
+            children.push_back(pid);
+        }
+        posix_spawn_file_actions_destroy(&actions);
+    }
+
+    struct Peer {
+        std::unique_ptr<Channel> channel;
+        Task current;
+        bool alive = true;
+        bool busy = false;
+        bool asked = false;
+    };
+    std::vector<Peer> peers;
+    const uint64_t fingerprint = association.get_fingerprint();
+    while (listener >= 0 && peers.size() < children.size()) {
+        pollfd waiting{listener, POLLIN, 0};
+        if (poll(&waiting, 1, DISTRIBUTED_CONNECT_TIMEOUT_MS) <= 0) {
+            break;
+        }
+        const int fd = accept(listener, nullptr, nullptr);
+        if (fd < 0) {
+            continue;
+        }
+        Peer peer;
+        peer.channel = std::make_unique<Channel>(fd);
+        char type = 0;
+        std::vector<int> values;
+        const bool ready =
+            peer.channel->send(CONFIG, {options.level_constrained ? 1 : 0,
+                                        options.max_level_offset,
+                                        static_cast<int>(options.ordering),
+                                        static_cast<int>(options.branching)})
+            && peer.channel->receive(type, values) && type == HELLO && values.size() == 3
+            && values[0] == n && static_cast<uint32_t>(values[1]) == (fingerprint & 0xffffffffu)
+            && static_cast<uint32_t>(values[2]) == (fingerprint >> 32);
+        if (ready) {
+            peers.push_back(std::move(peer));
+        }
+    }
+    if (listener >= 0) {
+        close(listener);
+        if (address.rfind("unix:", 0) == 0) {
+            unlink(address.c_str() + 5);
+        }
+    }
+
+    auto assign = [&](Peer& peer) {
+        peer.current = std::move(queue.front());
+        queue.pop_front();
+        peer.busy = peer.channel->send(TASK, encode_task(best_size, peer.current));
+        peer.asked = false;
+        if (!peer.busy) {
+            peer.alive = false;
+            queue.push_back(std::move(peer.current));
+        }
+    };
+    auto handle = [&](Peer& peer, char type, const std::vector<int>& values) {
+        Task task;
+        if (type == IMPROVED && static_cast<int>(values.size()) > best_size
+            && is_clique(association, values)) {
+            best = to_set(values, n);
+            best_size = static_cast<int>(values.size());
+            for (Peer& other : peers) {
+                if (&other != &peer && other.alive) {
+                    other.channel->send(BOUND, {best_size});
+                }
+            }
+        } else if (type == DONATE && decode_task(values, 0, task)) {
+            queue.push_back(std::move(task));
+            peer.asked = false;
+            donations++;
+        } else if (type == DONE && values.size() == 2) {
+            nodes_explored += static_cast<long long>(static_cast<uint32_t>(values[0]))
+                              | (static_cast<long long>(values[1]) << 32);
+            peer.busy = false;
+            peer.asked = false;
+        }
+    };
+
+    std::vector<pollfd> events;
+    while (true) {
+        int live = 0;
+        int busy = 0;
+        for (Peer& peer : peers) {
+            if (peer.alive && !peer.busy && !queue.empty()) {
+                assign(peer);
+            }
+            live += peer.alive ? 1 : 0;
+            busy += peer.alive && peer.busy ? 1 : 0;
+        }
+        if (live == 0 || (queue.empty() && busy == 0)) {
+            break;
+        }
+        if (queue.empty() && busy < live) {
+            for (Peer& peer : peers) {
+                if (peer.alive && peer.busy && !peer.asked) {
+                    peer.asked = peer.channel->send(HUNGRY, {1});
+                }
+            }
+        }
+
+        events.clear();
+        for (const Peer& peer : peers) {
+            events.push_back({peer.alive ? peer.channel->get_fd() : -1, POLLIN, 0});
+        }
+        if (poll(events.data(), events.size(), -1) < 0 && errno != EINTR) {
+            break;
+        }
+        for (size_t p = 0; p < peers.size(); ++p) {
+            Peer& peer = peers[p];
+            if (!peer.alive || !(events[p].revents & (POLLIN | POLLHUP | POLLERR))) {
+                continue;
+            }
+            const bool open = peer.channel->fill(false);
+            char type = 0;
+            std::vector<int> values;
+            while (peer.channel->next(type, values)) {
+                handle(peer, type, values);
+            }
+            // A lost worker's subproblem is searched again (its donations may repeat)
+            if (!open) {
+                peer.alive = false;
+                if (peer.busy) {
+                    queue.push_back(std::move(peer.current));
+                    peer.busy = false;
+                }
+            }
+        }
+    }
+
+    for (Peer& peer : peers) {
+        if (peer.alive) {
+            peer.channel->send(STOP, {});
+        }
+    }
+    peers.clear();
+    for (pid_t child : children) {
+        waitpid(child, nullptr, 0);
+    }
+    if (workers > 0) {
+        std::remove(graph_path.c_str());
+    }
+
+    // Without workers the remaining subproblems are searched here
+    if (!queue.empty()) {
+        MaxCliqueSearch<Bitset> search(adjacency.data(), Bitset(n));
+        configure(search, association, i1, i2, options);
+        search.reset(best_size);
+        for (const Task& task : queue) {
+            const Bitset candidates = to_set(task.candidates, n);
+            search.run_subproblem(task.clique, candidates, task.candidates.size());
+        }
+        if (static_cast<int>(search.get_best().count()) > best_size) {
+            best = search.get_best();
+            best_size = static_cast<int>(best.count());
+        }
+        nodes_explored += search.get_nodes_explored();
+    }
+
+    MCISResult result;
+    if (static_cast<int>(best.count()) <= incumbent.size()) {
+        result.mapping = incumbent.mapping;
+    } else {
+        best.for_each([&](size_t p) {
+            const auto [u, v] = association.get_pair(static_cast<int>(p));
+            result.mapping.emplace_back(i1.get_id(u), i2.get_id(v));
+        });
+    }
+    result.nodes_explored = nodes_explored;
+    return result;
+}
+
+std::string DistributedMCIS::default_worker_path() {
+    if (const char* path = std::getenv("MCIS_WORKER")) {
+        return path;
+    }
+#ifdef MCIS_WORKER_PATH
+    return MCIS_WORKER_PATH;
+#else
+    return "mcis_worker";
+#endif
+}
+
+bool DistributedMCIS::run_worker(const std::string& address, const std::string& graph_path) {
+    Graph g1;
+    Graph g2;
+    {
+        std::ifstream file(graph_path, std::ios::binary);
+        if (!g1.read_binary(file) || !g2.read_binary(file)) {
+            return false;
+        }
+    }
+    const int fd = connect_to(address);
+    if (fd < 0) {
+        return false;
+    }
+    Channel channel(fd);
+    char type = 0;
+    std::vector<int> values;
+    if (!channel.receive(type, values) || type != CONFIG || values.size() != 4) {
+        return false;
+    }
+    MCISOptions options;
+    options.level_constrained = values[0] != 0;
+    options.max_level_offset = values[1];
+    options.ordering = static_cast<VertexOrdering>(values[2]);
+    options.branching = static_cast<BranchingPolicy>(values[3]);
+
+    IndexedGraph i1(g1);
+    IndexedGraph i2(g2);
+    AssociationGraph association(i1, i2, options);
+    const int n = association.get_num_vertices();
+    const uint64_t fingerprint = association.get_fingerprint();
+    if (!channel.send(HELLO, {n, static_cast<int>(fingerprint & 0xffffffffu),
+                              static_cast<int>(fingerprint >> 32)})) {
+        return false;
+    }
+
+    MaxCliqueSearch<Bitset> search(association.get_adjacency().data(), Bitset(n));
+    configure(search, association, i1, i2, options);
+    std::atomic<int> bound(0);
+    search.set_shared_best(&bound);
+
+    int budget = 0;
+    size_t reported = 0;
+    bool connected = true;
+    auto raise = [&](int size) {
+        int current = bound.load();
+        while (size > current && !bound.compare_exchange_weak(current, size)) {
+        }
+    };
+    auto report = [&]() {
+        const size_t size = search.get_best().count();
+        if (size > reported) {
+            reported = size;
+            connected = channel.send(IMPROVED, to_vertices(search.get_best())) && connected;
+        }
+    };
+    long long ticks = 0;
+    search.set_split([&](const std::vector<int>& clique, const Bitset& next, size_t next_count) {
+        if (++ticks % DISTRIBUTED_POLL_STRIDE == 0) {
+            report();
+            connected = channel.fill(false) && connected;
+            char message = 0;
+            std::vector<int> update;
+            while (channel.next(message, update)) {
+                if (message == BOUND && !update.empty()) {
+                    raise(update[0]);
+                } else if (message == HUNGRY && !update.empty()) {
+                    budget += update[0];
+                }
+            }
+        }
+        if (budget <= 0 || next_count < DISTRIBUTED_MIN_DONATION || !connected) {
+            return false;
+        }
+        budget--;
+        return channel.send(DONATE, encode_task(-1, {clique, to_vertices(next)}));
+    });
+
+    while (channel.receive(type, values)) {
+        Task task;
+        if (type == STOP) {
+            return true;
+        }
+        if (type == BOUND && !values.empty()) {
+            raise(values[0]);
+        } else if (type == TASK && decode_task(values, 1, task)) {
+            raise(values[0]);
+            budget = 0;
+            reported = 0;
+            search.reset(bound.load());
+            search.run_subproblem(task.clique, to_set(task.candidates, n), task.candidates.size());
+            report();
+            const long long explored = search.get_nodes_explored();
+            if (!connected
+                || !channel.send(DONE, {static_cast<int>(explored & 0xffffffffLL),
+                                        static_cast<int>(explored >> 32)})) {
+                return false;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef DISTRIBUTED_MCIS_H
+#define DISTRIBUTED_MCIS_H
+
+#include <string>
+
+#include "mcis/graph.h"
+#include "mcis_finder.h"
+
+/**
+ * @brief Number of child search nodes a worker process visits between two polls of its socket.
+ */
+constexpr long long DISTRIBUTED_POLL_STRIDE = 256;
+
+/**
+ * @brief Smallest candidate count of a search node a worker process donates to the coordinator.
+ */
+constexpr size_t DISTRIBUTED_MIN_DONATION = 8;
+
+/**
+ * @brief Milliseconds the coordinator waits for its worker processes to connect.
+ */
+constexpr int DISTRIBUTED_CONNECT_TIMEOUT_MS = 10000;
+
+/**
+ * @enum SocketTransport
+ * @brief Socket family connecting the coordinator and its workers: a Unix-domain socket in the
+ * temporary directory, or TCP on the loopback interface.
+ */
+enum class SocketTransport { UNIX, TCP };
+
+/**
+ * @class DistributedMCIS
+ *
+ * Coordinator/worker variant of BronKerboschSerial across processes. The coordinator writes both
+ * graphs to one binary file, listens on a local socket and spawns the worker executable (see
+ * set_worker_path), single-threaded, once per worker; each worker loads the graphs from the file
+ * once, builds the association graph itself and then searches subproblems (a clique and its
+ * candidates) handed out by the coordinator. The root is
+ * split into one subproblem per branch of the first search node. Workers report improved cliques,
+ * which the coordinator broadcasts as the new incumbent size. Whenever the queue is empty while
+ * a worker is idle, the coordinator asks the busy workers to donate their next child search node
+ * instead of descending into it. If every worker is lost or cannot be started, the remaining
+ * subproblems are searched in-process, as they are when the search runs inside an OpenMP parallel
+ * region.
+ */
+class DistributedMCIS : public MCISFinder {
+private:
+    int num_workers;
+    SocketTransport transport;
+    std::string worker_path;
+    long long donations = 0;
+
+public:
+    /**
+     * @brief Creates the coordinator.
+     * @param workers Number of worker processes; 0 uses the OpenMP thread count.
+     * @param transport Socket family.
+     */
+    explicit DistributedMCIS(int workers = 0, SocketTransport transport = SocketTransport::UNIX)
+        : num_workers(workers), transport(transport), worker_path(default_worker_path()) {}
+
+    /**
+     * @brief Retrieves the worker executable used by default: $MCIS_WORKER if set, otherwise the
+     * mcis_worker built alongside the library (looked up in PATH if the build did not record it).
+     */
+    static std::string default_worker_path();
+
+    /**
+     * @brief Sets the worker executable, which is called as `worker <address> <graph file>` (see
+     * run_worker).
+     */
+    void set_worker_path(const std::string& path) { worker_path = path; }
+
+    MCISResult find_mapping(const Graph& g1, const Graph& g2) override;
+
+    MCISResult improve_mapping(const Graph& g1, const Graph& g2,
+                               const MCISResult& incumbent) override;
+
+    /**
+     * @brief Runs a worker process: loads both graphs, connects to a coordinator and searches
+     * subproblems until it is stopped. This is the entry point of the mcis_worker executable;
+     * worker processes may also be started independently of the coordinator.
+     * @param address Coordinator address, "unix:<path>" or "tcp:<port>" on the loopback
+     * interface.
+     * @param graph_path Binary file with g1 followed by g2 (see Graph::write_binary).
+     * @return True if the coordinator stopped the worker, false if the graphs could not be loaded
+     * or the connection failed.
+     */
+    static bool run_worker(const std::string& address, const std::string& graph_path);
+
+    /**
+     * @brief Retrieves the number of search nodes donated by workers during the last search.
+     */
+    [[nodiscard]]
+    long long get_donations() const {
+        return donations;
+    }
+};
+
+#endif  // DISTRIBUTED_MCIS_H
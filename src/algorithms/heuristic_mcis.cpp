@@ -0,0 +1,56 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "heuristic_mcis.h"
+
+#include <chrono>
+#include <vector>
+
+#include "local_search.h"
+
+std::vector<int> HeuristicMCIS::label_colours(const IndexedGraph& graph) {
+    std::vector<int> colours(graph.get_num_nodes());
+    for (int v = 0; v < graph.get_num_nodes(); ++v) {
+        colours[v] = static_cast<int>(graph.get_label(v));
+    }
+    return colours;
+}
+
+int HeuristicMCIS::label_bound(const IndexedGraph& g1, const IndexedGraph& g2) {
+    return LocalSearch::colour_bound(label_colours(g1), label_colours(g2));
+}
+
+MCISResult HeuristicMCIS::find_mapping(const Graph& g1, const Graph& g2) {
+    return improve_mapping(g1, g2, MCISResult());
+}
+
+MCISResult HeuristicMCIS::improve_mapping(const Graph& g1, const Graph& g2,
+                                          const MCISResult& incumbent) {
+    IndexedGraph i1(g1);
+    IndexedGraph i2(g2);
+    const std::vector<int> colours1 = label_colours(i1);
+    const std::vector<int> colours2 = label_colours(i2);
+    const int upper_bound = LocalSearch::colour_bound(colours1, colours2);
+
+    IndexMapping start;
+    for (const auto& [id1, id2] : incumbent.mapping) {
+        start.emplace_back(i1.get_index(id1), i2.get_index(id2));
+    }
+    const auto deadline = LocalSearch::Clock::now()
+                          + std::chrono::duration_cast<LocalSearch::Clock::duration>(
+                              std::chrono::duration<double>(options.time_limit));
+
+    MCISResult result;
+    const IndexMapping best = LocalSearch::anneal(i1, i2, colours1, colours2, options, start,
+                                                  deadline, upper_bound, result.nodes_explored);
+    for (const auto& [u, v] : best) {
+        result.mapping.emplace_back(i1.get_id(u), i2.get_id(v));
+    }
+    result.upper_bound = upper_bound;
+    result.optimal = result.size() == upper_bound;
+    return result;
+}
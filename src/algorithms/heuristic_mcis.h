@@ -0,0 +1,58 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef HEURISTIC_MCIS_H
+#define HEURISTIC_MCIS_H
+
+#include <vector>
+
+#include "mcis/graph.h"
+#include "mcis/indexed_graph.h"
+#include "mcis_finder.h"
+
+/**
+ * @class HeuristicMCIS
+ *
+ * Anytime MCIS heuristic for instances too large for the exact solvers. Each restart builds a
+ * mapping greedily: a random admissible seed pair is extended through matching neighbors, and
+ * new seeds are tried once the frontier is exhausted. Simulated annealing then repeatedly
+ * removes a random connected group of matched nodes around a random center, forbids the
+ * removed pairs for a few moves (tabu), and re-extends the mapping from the boundary; worse
+ * mappings are accepted with probability exp(delta / temperature). Every added pair is checked
+ * against the matched neighbors of both nodes only, so a move costs time proportional to the
+ * degrees involved. The moves are implemented by LocalSearch.
+ *
+ * Restarts run independently on all OpenMP threads until options.time_limit expires or the best
+ * mapping reaches the label histogram upper bound, which is reported in
+ * MCISResult::upper_bound.
+ */
+class HeuristicMCIS : public MCISFinder {
+public:
+    /**
+     * @brief Colours the nodes of a graph by their operation labels, for LocalSearch.
+     */
+    static std::vector<int> label_colours(const IndexedGraph& graph);
+
+    /**
+     * @brief Upper bound on the MCIS size: for every label, the smaller of the two graphs' node
+     * counts with that label.
+     * @param g1 First graph.
+     * @param g2 Second graph.
+     * @return The sum of the per-label minima.
+     */
+    static int label_bound(const IndexedGraph& g1, const IndexedGraph& g2);
+
+    MCISResult find_mapping(const Graph& g1, const Graph& g2) override;
+
+    /**
+     * @brief Runs the heuristic with the incumbent as the starting mapping of the first restart.
+     */
+    MCISResult improve_mapping(const Graph& g1, const Graph& g2,
+                               const MCISResult& incumbent) override;
+};
+
+#endif  // HEURISTIC_MCIS_H
@@ -0,0 +1,92 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "level_bound.h"
+
+#include <algorithm>
+
+LevelHistogramBound::LevelHistogramBound(const AssociationGraph& association,
+                                         const IndexedGraph& g1, const IndexedGraph& g2)
+    : n1(g1.get_num_nodes()), n2(g2.get_num_nodes()) {
+    const int n = association.get_num_vertices();
+    pair_u.resize(n);
+    pair_v.resize(n);
+    level_u.resize(n);
+    level_v.resize(n);
+    for (int p = 0; p < n; ++p) {
+        const auto [u, v] = association.get_pair(p);
+        pair_u[p] = u;
+        pair_v[p] = v;
+        level_u[p] = g1.get_level(u);
+        level_v[p] = g2.get_level(v);
+    }
+
+    const int levels1 = g1.get_num_levels();
+    const int levels2 = g2.get_num_levels();
+    seen_u.assign(n1, 0);
+    seen_v.assign(n2, 0);
+    seen_level_u_v.assign(static_cast<size_t>(levels1) * n2, 0);
+    seen_level_v_u.assign(static_cast<size_t>(levels2) * n1, 0);
+    nodes1_at.assign(levels1, 0);
+    partners1_at.assign(levels1, 0);
+    nodes2_at.assign(levels2, 0);
+    partners2_at.assign(levels2, 0);
+}
+
+int LevelHistogramBound::operator()(const Bitset& candidates) {
+    stamp++;
+    int distinct_u = 0;
+    int distinct_v = 0;
+    candidates.for_each([&](size_t p) {
+        const int u = pair_u[p];
+        const int v = pair_v[p];
+        const int l1 = level_u[p];
+        const int l2 = level_v[p];
+        if (nodes1_at[l1] == 0 && partners1_at[l1] == 0) {
+            touched1.push_back(l1);
+        }
+        if (nodes2_at[l2] == 0 && partners2_at[l2] == 0) {
+            touched2.push_back(l2);
+        }
+        if (seen_u[u] != stamp) {
+            seen_u[u] = stamp;
+            distinct_u++;
+            nodes1_at[l1]++;
+        }
+        if (seen_v[v] != stamp) {
+            seen_v[v] = stamp;
+            distinct_v++;
+            nodes2_at[l2]++;
+        }
+        int& level_u_v = seen_level_u_v[static_cast<size_t>(l1) * n2 + v];
+        if (level_u_v != stamp) {
+            level_u_v = stamp;
+            partners1_at[l1]++;
+        }
+        int& level_v_u = seen_level_v_u[static_cast<size_t>(l2) * n1 + u];
+        if (level_v_u != stamp) {
+            level_v_u = stamp;
+            partners2_at[l2]++;
+        }
+    });
+
+    int by_level1 = 0;
+    for (int l : touched1) {
+        by_level1 += std::min(nodes1_at[l], partners1_at[l]);
+        nodes1_at[l] = 0;
+        partners1_at[l] = 0;
+    }
+    int by_level2 = 0;
+    for (int l : touched2) {
+        by_level2 += std::min(nodes2_at[l], partners2_at[l]);
+        nodes2_at[l] = 0;
+        partners2_at[l] = 0;
+    }
+    touched1.clear();
+    touched2.clear();
+    return std::min({by_level1, by_level2, distinct_u, distinct_v});
+}
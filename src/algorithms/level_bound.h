@@ -0,0 +1,73 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef LEVEL_BOUND_H
+#define LEVEL_BOUND_H
+
+#include <vector>
+
+#include "association_graph.h"
+#include "mcis/bitset.h"
+#include "mcis/indexed_graph.h"
+
+/**
+ * @class LevelHistogramBound
+ *
+ * Level-histogram upper bound for level-constrained MCIS. A clique uses every g1 node and every g2
+ * node at most once, so the pairs it takes from g1 level l number at most min(distinct g1 nodes
+ * at l, distinct g2 nodes paired with them) among the candidates; summing over levels (and
+ * likewise grouping by g2 level) bounds the clique. Holds scratch state, so each search needs its
+ * own instance.
+ */
+class LevelHistogramBound {
+private:
+    /**
+     * @brief g1 node, g2 node and their levels for each association vertex.
+     */
+    std::vector<int> pair_u;
+    std::vector<int> pair_v;
+    std::vector<int> level_u;
+    std::vector<int> level_v;
+
+    int n1;
+    int n2;
+
+    /**
+     * @brief Per-call stamps marking nodes, (level, node) combinations and levels already counted.
+     */
+    std::vector<int> seen_u;
+    std::vector<int> seen_v;
+    std::vector<int> seen_level_u_v;
+    std::vector<int> seen_level_v_u;
+    int stamp = 0;
+
+    /**
+     * @brief Distinct g1 / g2 node counts per level and the levels touched by the current call.
+     */
+    std::vector<int> nodes1_at;
+    std::vector<int> partners1_at;
+    std::vector<int> nodes2_at;
+    std::vector<int> partners2_at;
+    std::vector<int> touched1;
+    std::vector<int> touched2;
+
+public:
+    /**
+     * @brief Prepares the bound for an association graph of two DAGs.
+     */
+    LevelHistogramBound(const AssociationGraph& association, const IndexedGraph& g1,
+                        const IndexedGraph& g2);
+
+    /**
+     * @brief Bounds the size of any clique within the candidate pairs.
+     * @param candidates Candidate association vertices.
+     * @return An upper bound on the clique size.
+     */
+    int operator()(const Bitset& candidates);
+};
+
+#endif  // LEVEL_BOUND_H
@@ -0,0 +1,307 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "local_search.h"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <unordered_map>
+
+#include "association_graph.h"
+
+namespace {
+
+template <typename F>
+void for_each_neighbor(const IndexedGraph& graph, int v, F f) {
+    for (int w : graph.get_children(v)) {
+        f(w);
+    }
+    for (int w : graph.get_parents(v)) {
+        f(w);
+    }
+}
+
+}  // namespace
+
+LocalSearch::LocalSearch(const IndexedGraph& g1, const IndexedGraph& g2,
+                         const std::vector<int>& colours1, const std::vector<int>& colours2,
+                         const std::vector<std::vector<int>>& by_colour2,
+                         const MCISOptions& options, unsigned int seed)
+    : g1(g1),
+      g2(g2),
+      colours1(colours1),
+      colours2(colours2),
+      by_colour2(by_colour2),
+      options(options),
+      rng(seed),
+      m1(g1.get_num_nodes(), -1),
+      m2(g2.get_num_nodes(), -1),
+      position(g1.get_num_nodes(), -1),
+      tabu_v(g1.get_num_nodes(), -1),
+      tabu_until(g1.get_num_nodes(), 0) {}
+
+void LocalSearch::link(int u, int v) {
+    m1[u] = v;
+    m2[v] = u;
+    position[u] = static_cast<int>(mapped.size());
+    mapped.push_back(u);
+}
+
+void LocalSearch::unlink(int u) {
+    const int last = mapped.back();
+    mapped[position[u]] = last;
+    position[last] = position[u];
+    mapped.pop_back();
+    m2[m1[u]] = -1;
+    m1[u] = -1;
+}
+
+bool LocalSearch::consistent(int u, int v) const {
+    if (m1[u] >= 0 || m2[v] >= 0 || colours1[u] != colours2[v]) {
+        return false;
+    }
+    if (!AssociationGraph::admissible(g1, g2, u, v, options)) {
+        return false;
+    }
+    bool ok = true;
+    for_each_neighbor(g1, u, [&](int w) {
+        ok = ok && (m1[w] < 0 || AssociationGraph::compatible(g1, g2, u, v, w, m1[w]));
+    });
+    for_each_neighbor(g2, v, [&](int y) {
+        ok = ok && (m2[y] < 0 || AssociationGraph::compatible(g1, g2, u, v, m2[y], y));
+    });
+    return ok;
+}
+
+void LocalSearch::add(int u, int v) {
+    link(u, v);
+    log.push_back({u, v, true});
+    queue.push_back(u);
+}
+
+void LocalSearch::extend_from(int u) {
+    const int v = m1[u];
+    std::vector<int> around1;
+    std::vector<int> around2;
+    for_each_neighbor(g1, u, [&](int x) {
+        if (m1[x] < 0) {
+            around1.push_back(x);
+        }
+    });
+    for_each_neighbor(g2, v, [&](int y) {
+        if (m2[y] < 0) {
+            around2.push_back(y);
+        }
+    });
+    if (around1.empty() || around2.empty()) {
+        return;
+    }
+
+    // Nodes with the same in- and out-degrees are more likely to extend the mapping further;
+    // both scans start at random offsets
+    auto degree_difference = [&](int x, int y) {
+        return std::abs(g1.get_in_degree(x) - g2.get_in_degree(y))
+               + std::abs(g1.get_out_degree(x) - g2.get_out_degree(y));
+    };
+    const int start1 = random_below(static_cast<int>(around1.size()));
+    const int start2 = random_below(static_cast<int>(around2.size()));
+    for (size_t i = 0; i < around1.size(); ++i) {
+        const int x = around1[(start1 + i) % around1.size()];
+        int best = -1;
+        int best_difference = 0;
+        for (size_t j = 0; j < around2.size(); ++j) {
+            const int y = around2[(start2 + j) % around2.size()];
+            const int difference = degree_difference(x, y);
+            if ((best < 0 || difference < best_difference) && allowed(x, y)) {
+                best = y;
+                best_difference = difference;
+                if (difference == 0) {
+                    break;
+                }
+            }
+        }
+        if (best >= 0) {
+            add(x, best);
+            queue.push_back(u);
+            return;
+        }
+    }
+}
+
+bool LocalSearch::try_seed() {
+    for (int attempt = 0; attempt < HEURISTIC_SEED_ATTEMPTS; ++attempt) {
+        const int u = random_below(g1.get_num_nodes());
+        if (m1[u] >= 0 || colours1[u] >= static_cast<int>(by_colour2.size())) {
+            continue;
+        }
+        const auto& candidates = by_colour2[colours1[u]];
+        if (candidates.empty()) {
+            continue;
+        }
+        const int v = candidates[random_below(static_cast<int>(candidates.size()))];
+        if (allowed(u, v)) {
+            add(u, v);
+            return true;
+        }
+    }
+    return false;
+}
+
+void LocalSearch::extend() {
+    do {
+        while (!queue.empty()) {
+            const int u = queue.back();
+            queue.pop_back();
+            if (m1[u] >= 0) {
+                extend_from(u);
+            }
+        }
+    } while (try_seed());
+}
+
+IndexMapping LocalSearch::get_pairs() const {
+    IndexMapping pairs;
+    pairs.reserve(mapped.size());
+    for (int u : mapped) {
+        pairs.emplace_back(u, m1[u]);
+    }
+    return pairs;
+}
+
+void LocalSearch::restart(const IndexMapping& start) {
+    while (!mapped.empty()) {
+        unlink(mapped.back());
+    }
+    log.clear();
+    for (const auto& [u, v] : start) {
+        if (consistent(u, v)) {
+            add(u, v);
+        }
+    }
+    extend();
+}
+
+void LocalSearch::step(double temperature) {
+    moves++;
+    log.clear();
+    const int before = size();
+    if (!mapped.empty()) {
+        const int center = mapped[random_below(size())];
+        std::vector<int> removed = {center};
+        std::bernoulli_distribution coin(0.5);
+        for (size_t i = 0; i < removed.size(); ++i) {
+            for_each_neighbor(g1, removed[i], [&](int w) {
+                if (removed.size() < HEURISTIC_MAX_REMOVED && m1[w] >= 0 && coin(rng)
+                    && std::find(removed.begin(), removed.end(), w) == removed.end()) {
+                    removed.push_back(w);
+                }
+            });
+        }
+        for (int u : removed) {
+            tabu_v[u] = m1[u];
+            tabu_until[u] = moves + HEURISTIC_TABU_TENURE;
+            log.push_back({u, m1[u], false});
+            unlink(u);
+        }
+        for (int u : removed) {
+            for_each_neighbor(g1, u, [&](int w) {
+                if (m1[w] >= 0) {
+                    queue.push_back(w);
+                }
+            });
+        }
+    }
+    extend();
+
+    const int delta = size() - before;
+    if (delta >= 0
+        || std::uniform_real_distribution<double>(0.0, 1.0)(rng) < std::exp(delta / temperature)) {
+        return;
+    }
+    for (auto it = log.rbegin(); it != log.rend(); ++it) {
+        if (it->added) {
+            unlink(it->u);
+        } else {
+            link(it->u, it->v);
+        }
+    }
+}
+
+int LocalSearch::colour_bound(const std::vector<int>& colours1, const std::vector<int>& colours2) {
+    std::unordered_map<int, int> balance;
+    for (int colour : colours1) {
+        balance[colour]++;
+    }
+    int bound = 0;
+    for (int colour : colours2) {
+        auto it = balance.find(colour);
+        if (it != balance.end() && it->second > 0) {
+            it->second--;
+            bound++;
+        }
+    }
+    return bound;
+}
+
+IndexMapping LocalSearch::anneal(const IndexedGraph& g1, const IndexedGraph& g2,
+                                 const std::vector<int>& colours1,
+                                 const std::vector<int>& colours2, const MCISOptions& options,
+                                 const IndexMapping& start, Clock::time_point deadline,
+                                 int upper_bound, long long& moves) {
+    int num_colours = 0;
+    for (int colour : colours2) {
+        num_colours = std::max(num_colours, colour + 1);
+    }
+    std::vector<std::vector<int>> by_colour2(num_colours);
+    for (int v = 0; v < g2.get_num_nodes(); ++v) {
+        by_colour2[colours2[v]].push_back(v);
+    }
+
+    // start may contain inconsistent pairs, so it only counts once a restart has filtered it
+    IndexMapping best;
+    std::atomic<int> best_size = 0;
+    std::atomic<bool> stop = upper_bound <= 0;
+    long long total_moves = 0;
+
+    // Independent restarts on every thread, sharing only the best mapping
+#pragma omp parallel reduction(+ : total_moves)
+    {
+        const int thread = omp_get_thread_num();
+        LocalSearch search(g1, g2, colours1, colours2, by_colour2, options,
+                           options.seed + 7919u * thread);
+        bool first = true;
+        while ((first && thread == 0) || !stop.load(std::memory_order_relaxed)) {
+            search.restart(first && thread == 0 ? start : IndexMapping());
+            first = false;
+            for (double temperature = HEURISTIC_INITIAL_TEMPERATURE;
+                 temperature > HEURISTIC_FINAL_TEMPERATURE; temperature *= HEURISTIC_COOLING_RATE) {
+                if (search.size() > best_size.load(std::memory_order_relaxed)) {
+#pragma omp critical(local_search_best)
+                    if (search.size() > best_size.load()) {
+                        best = search.get_pairs();
+                        best_size.store(search.size());
+                    }
+                }
+                if (best_size.load(std::memory_order_relaxed) >= upper_bound
+                    || ((search.get_moves() & 63) == 0 && Clock::now() >= deadline)) {
+                    stop.store(true);
+                }
+                if (stop.load(std::memory_order_relaxed)) {
+                    break;
+                }
+                search.step(temperature);
+            }
+        }
+        total_moves += search.get_moves();
+    }
+    moves += total_moves;
+    return best;
+}
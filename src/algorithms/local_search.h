@@ -0,0 +1,188 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef LOCAL_SEARCH_H
+#define LOCAL_SEARCH_H
+
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "mcis/indexed_graph.h"
+#include "mcis/mcis_options.h"
+
+/**
+ * @brief Number of random (g1 node, g2 node) pairs tried to start a new piece of the mapping once
+ * the greedy extension has no frontier left.
+ */
+constexpr int HEURISTIC_SEED_ATTEMPTS = 64;
+
+/**
+ * @brief Annealing temperature at the start of every restart.
+ */
+constexpr double HEURISTIC_INITIAL_TEMPERATURE = 2.0;
+
+/**
+ * @brief Factor applied to the temperature after every local search move.
+ */
+constexpr double HEURISTIC_COOLING_RATE = 0.9995;
+
+/**
+ * @brief Temperature below which a restart ends and a new greedy mapping is built.
+ */
+constexpr double HEURISTIC_FINAL_TEMPERATURE = 0.05;
+
+/**
+ * @brief Largest number of matched nodes removed by one local search move.
+ */
+constexpr size_t HEURISTIC_MAX_REMOVED = 8;
+
+/**
+ * @brief Number of moves during which a removed pair may not be matched again.
+ */
+constexpr int HEURISTIC_TABU_TENURE = 16;
+
+/**
+ * @brief Correspondence between dense node indices of two indexed graphs, as (g1, g2) pairs.
+ */
+using IndexMapping = std::vector<std::pair<int, int>>;
+
+/**
+ * @class LocalSearch
+ *
+ * Partial mapping between two indexed graphs with the greedy and annealing moves of the MCIS
+ * heuristics. Nodes may only be matched when their colours are equal (on top of labels and
+ * levels), which lets callers search on graphs whose nodes stand for groups of original nodes.
+ * Every added pair is checked against the matched neighbors of its two nodes only.
+ */
+class LocalSearch {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    struct Change {
+        int u;
+        int v;
+        bool added;
+    };
+
+    const IndexedGraph& g1;
+    const IndexedGraph& g2;
+    const std::vector<int>& colours1;
+    const std::vector<int>& colours2;
+    const std::vector<std::vector<int>>& by_colour2;
+    const MCISOptions& options;
+    std::mt19937 rng;
+
+    std::vector<int> m1;
+    std::vector<int> m2;
+    std::vector<int> mapped;
+    std::vector<int> position;
+
+    /**
+     * @brief Pairs removed by recent moves, which may not be matched again until tabu_until.
+     */
+    std::vector<int> tabu_v;
+    std::vector<long long> tabu_until;
+    long long moves = 0;
+
+    /**
+     * @brief Changes of the current move, undone if the move is rejected.
+     */
+    std::vector<Change> log;
+    std::vector<int> queue;
+
+    int random_below(int n) { return std::uniform_int_distribution<int>(0, n - 1)(rng); }
+
+    void link(int u, int v);
+
+    void unlink(int u);
+
+    /**
+     * @brief Checks if (u, v) can be added: both unmatched, same colour, admissible, and
+     * compatible with the matched neighbors of u and v.
+     */
+    [[nodiscard]]
+    bool consistent(int u, int v) const;
+
+    /**
+     * @brief Checks if (u, v) is consistent and not tabu.
+     */
+    [[nodiscard]]
+    bool allowed(int u, int v) const {
+        return !(tabu_v[u] == v && tabu_until[u] > moves) && consistent(u, v);
+    }
+
+    void add(int u, int v);
+
+    /**
+     * @brief Matches one unmatched neighbor of u to the unmatched neighbor of m1[u] with the
+     * closest degrees.
+     */
+    void extend_from(int u);
+
+    bool try_seed();
+
+    void extend();
+
+public:
+    /**
+     * @brief Creates an empty mapping.
+     * @param by_colour2 Nodes of g2 grouped by colour.
+     * @param seed Seed of the random number generator.
+     */
+    LocalSearch(const IndexedGraph& g1, const IndexedGraph& g2, const std::vector<int>& colours1,
+                const std::vector<int>& colours2, const std::vector<std::vector<int>>& by_colour2,
+                const MCISOptions& options, unsigned int seed);
+
+    [[nodiscard]]
+    int size() const {
+        return static_cast<int>(mapped.size());
+    }
+
+    [[nodiscard]]
+    long long get_moves() const {
+        return moves;
+    }
+
+    [[nodiscard]]
+    IndexMapping get_pairs() const;
+
+    /**
+     * @brief Replaces the mapping with the consistent pairs of start, taken in order, and extends
+     * it greedily.
+     */
+    void restart(const IndexMapping& start);
+
+    /**
+     * @brief Removes a random connected group of matched nodes, re-extends the mapping, and keeps
+     * the result with the annealing acceptance rule.
+     */
+    void step(double temperature);
+
+    /**
+     * @brief Upper bound on the size of any mapping: for every colour, the smaller of the two
+     * graphs' node counts with that colour.
+     */
+    static int colour_bound(const std::vector<int>& colours1, const std::vector<int>& colours2);
+
+    /**
+     * @brief Runs independent annealing restarts on all OpenMP threads, the first one starting
+     * from the consistent pairs of start, until the deadline or until a mapping reaches
+     * upper_bound.
+     * @param moves Incremented by the number of moves made.
+     * @return The largest mapping found, never smaller than the consistent part of start.
+     */
+    static IndexMapping anneal(const IndexedGraph& g1, const IndexedGraph& g2,
+                               const std::vector<int>& colours1, const std::vector<int>& colours2,
+                               const MCISOptions& options, const IndexMapping& start,
+                               Clock::time_point deadline, int upper_bound, long long& moves);
+};
+
+#endif  // LOCAL_SEARCH_H
@@ -7,11 +7,32 @@
 
 #include "mcis/mcis_algorithm.h"
 
+#include <algorithm>
 #include <iostream>
+#include <string>
 
+#include "bron_kerbosch_parallel.h"
 #include "bron_kerbosch_serial.h"
+#include "component_mcis.h"
+#include "distributed_mcis.h"
+#include "heuristic_mcis.h"
+#include "mcis/bounds.h"
+#include "mcis/indexed_graph.h"
+#include "mcis/vf3.h"
+#include "multi_fold.h"
+#include "multilevel_mcis.h"
+#include "small_graph_solver.h"
+#include "tree_mcis.h"
 
-MCISAlgorithm::MCISAlgorithm() { algorithms.push_back(new BronKerboschSerial()); }
+MCISAlgorithm::MCISAlgorithm() {
+    algorithms.push_back(new BronKerboschSerial());
+    algorithms.push_back(new ComponentMCIS());
+    algorithms.push_back(new TreeMCIS());
+    algorithms.push_back(new HeuristicMCIS());
+    algorithms.push_back(new MultilevelMCIS());
+    algorithms.push_back(new BronKerboschParallel());
+    algorithms.push_back(new DistributedMCIS());
+}
 
 MCISAlgorithm::~MCISAlgorithm() {
     for (auto algorithm : algorithms) {
@@ -19,10 +40,84 @@ MCISAlgorithm::~MCISAlgorithm() {
     }
 }
 
-std::vector<Graph*> MCISAlgorithm::run(const Graph& g1, const Graph& g2, AlgorithmType type) {
+Graph* MCISAlgorithm::find_full_embedding(const Graph& g1, const Graph& g2) {
+    const bool g1_smaller = g1.get_num_nodes() <= g2.get_num_nodes();
+    const Graph& pattern = g1_smaller ? g1 : g2;
+    const Graph& target = g1_smaller ? g2 : g1;
+
+    VF3Matcher matcher(*pattern.get_indexed(), *target.get_indexed());
+    matcher.set_state_limit(EMBEDDING_CHECK_STATE_LIMIT);
+    std::optional<NodeMapping> embedding = matcher.find();
+    if (!embedding) {
+        return nullptr;
+    }
+    // The result is a subgraph of g1 like every other result of run, so pairs are (g1, g2)
+    MCISResult result;
+    result.mapping = std::move(*embedding);
+    if (!g1_smaller) {
+        for (auto& [id1, id2] : result.mapping) {
+            std::swap(id1, id2);
+        }
+    }
+    return result.to_graph(g1);
+}
+
+std::optional<MCISResult> MCISAlgorithm::solve_small_instance(const Graph& g1, const Graph& g2,
+                                                              const MCISOptions& options) {
+    const long long pairs = static_cast<long long>(g1.get_num_nodes()) * g2.get_num_nodes();
+    if (pairs > SMALL_GRAPH_MAX_PAIRS) {
+        return std::nullopt;
+    }
+    const IndexedGraph& i1 = *g1.get_indexed();
+    const IndexedGraph& i2 = *g2.get_indexed();
+    if (pairs <= 64) {
+        return SmallGraphSolver<1>::solve(i1, i2, options);
+    }
+    if (pairs <= 128) {
+        return SmallGraphSolver<2>::solve(i1, i2, options);
+    }
+    return SmallGraphSolver<4>::solve(i1, i2, options);
+}
+
+void MCISAlgorithm::set_options(const MCISOptions& new_options) {
+    options = new_options;
+    for (auto algorithm : algorithms) {
+        algorithm->set_options(options);
+    }
+}
+
+std::vector<Graph*> MCISAlgorithm::run(const Graph& g1, const Graph& g2, AlgorithmType type,
+                                       const std::string& resume_from) {
+    if (!resume_from.empty()) {
+        MCISFinder* finder = algorithms[static_cast<int>(type)];
+        MCISOptions resumed = options;
+        resumed.resume_path = resume_from;
+        finder->set_options(resumed);
+        std::vector<Graph*> result = run(g1, g2, type);
+        finder->set_options(options);
+        return result;
+    }
+
+    // The exact small-graph solver finds a full embedding itself, so tiny instances skip the check
+    if (auto small = solve_small_instance(g1, g2, options)) {
+        return {small->to_graph(g1)};
+    }
+
+    // A full embedding ignores levels, so it only answers unconstrained runs
+    if (!options.level_constrained) {
+        if (Graph* embedded = find_full_embedding(g1, g2)) {
+            return {embedded};
+        }
+    }
     switch (type) {
         case AlgorithmType::BRON_KERBOSCH_SERIAL:
-            return algorithms[static_cast<int>(type)]->find(g1, g2);
+        case AlgorithmType::COMPONENT_DECOMPOSITION:
+        case AlgorithmType::TREE_DP:
+        case AlgorithmType::HEURISTIC:
+        case AlgorithmType::MULTILEVEL:
+        case AlgorithmType::BRON_KERBOSCH_PARALLEL:
+        case AlgorithmType::DISTRIBUTED:
+            return {solve_pair(g1, g2, type).to_graph(g1)};
             break;
         default:
             std::cerr << "Algorithm type not implemented.\n";
@@ -32,12 +127,147 @@ std::vector<Graph*> MCISAlgorithm::run(const Graph& g1, const Graph& g2, Algorit
     return {};
 }
 
+MCISResult MCISAlgorithm::solve_pair(const Graph& g1, const Graph& g2, AlgorithmType type) {
+    if (auto small = solve_small_instance(g1, g2, options)) {
+        return *small;
+    }
+    if (type != AlgorithmType::TREE_DP && TreeMCIS::applies(g1, g2)) {
+        const int tree_dp = static_cast<int>(AlgorithmType::TREE_DP);
+        MCISResult tree = algorithms[tree_dp]->find_mapping(g1, g2);
+        if (tree.optimal) {
+            return tree;
+        }
+        return algorithms[static_cast<int>(type)]->improve_mapping(g1, g2, tree);
+    }
+    return algorithms[static_cast<int>(type)]->find_mapping(g1, g2);
+}
+
+std::vector<Graph*> MCISAlgorithm::run_multi(const std::vector<const Graph*>& graphs,
+                                             AlgorithmType type, int* upper_bound,
+                                             bool* optimal) {
+    if (graphs.empty()) {
+        return {};
+    }
+    const int k = static_cast<int>(graphs.size());
+
+    // Only labels present in every input can appear in the common subgraph. Dropping the others
+    // would change the levels, so level-constrained runs keep the inputs whole.
+    std::vector<bool> shared(NUM_OP_LABELS, true);
+    for (const Graph* graph : graphs) {
+        std::vector<bool> present(NUM_OP_LABELS, false);
+        for (const auto& [_, node] : graph->get_nodes()) {
+            present[static_cast<int>(node->get_label())] = true;
+        }
+        for (int label = 0; label < NUM_OP_LABELS; ++label) {
+            shared[label] = shared[label] && (present[label] || options.level_constrained);
+        }
+    }
+    std::vector<Graph*> inputs(k);
+    int base = 0;
+    for (int i = 0; i < k; ++i) {
+        std::vector<std::string> ids;
+        for (const auto& [id, node] : graphs[i]->get_nodes()) {
+            if (shared[static_cast<int>(node->get_label())]) {
+                ids.push_back(id);
+            }
+        }
+        inputs[i] = new Graph(graphs[i]->induced_subgraph(ids));
+        if (inputs[i]->get_num_nodes() < inputs[base]->get_num_nodes()) {
+            base = i;
+        }
+    }
+    if (k == 1) {
+        if (upper_bound != nullptr) {
+            *upper_bound = inputs[0]->get_num_nodes();
+        }
+        if (optimal != nullptr) {
+            *optimal = true;
+        }
+        return {inputs[0]};
+    }
+
+    // Pairwise preprocessing against the smallest input, each pair with its own finders. A
+    // pairwise size only bounds the k-way optimum when it is proven, so heuristic results
+    // contribute their own or the summary bounds instead.
+    std::vector<MCISResult> pairwise(k);
+    std::vector<int> bounds(k, inputs[base]->get_num_nodes());
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < k; ++i) {
+        if (i == base) {
+            continue;
+        }
+        MCISAlgorithm local;
+        local.set_options(options.for_subproblem());
+        std::optional<NodeMapping> embedding;
+        if (!options.level_constrained) {
+            VF3Matcher matcher(*inputs[base], *inputs[i]);
+            matcher.set_state_limit(EMBEDDING_CHECK_STATE_LIMIT);
+            embedding = matcher.find();
+        }
+        if (embedding) {
+            pairwise[i].mapping = std::move(*embedding);
+        } else {
+            pairwise[i] = local.solve_pair(*inputs[base], *inputs[i], type);
+        }
+        if (pairwise[i].optimal) {
+            bounds[i] = pairwise[i].size();
+        } else {
+            const int summary = MCISBounds::upper_bound(*inputs[base], *inputs[i], options);
+            bounds[i] = pairwise[i].upper_bound >= 0 ? std::min(pairwise[i].upper_bound, summary)
+                                                     : summary;
+        }
+    }
+
+    // Fold the inputs with the tightest bounds first, starting from the pairwise result
+    std::vector<int> order;
+    for (int i = 0; i < k; ++i) {
+        if (i != base) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return bounds[a] < bounds[b]; });
+    const int bound = bounds[order[0]];
+
+    const IndexedGraph& indexed_base = *inputs[base]->get_indexed();
+    std::vector<const IndexedGraph*> others;
+    for (int i : order) {
+        others.push_back(inputs[i]->get_indexed().get());
+    }
+    Bitset first(indexed_base.get_num_nodes());
+    for (const auto& [id, _] : pairwise[order[0]].mapping) {
+        first.set(indexed_base.get_index(id));
+    }
+    MultiFold search(indexed_base, others, options, bound, MULTI_FOLD_NODE_LIMIT);
+    search.run(&first);
+
+    std::vector<std::string> ids;
+    search.get_best().for_each([&](size_t v) { ids.push_back(indexed_base.get_id(v)); });
+    Graph* common = new Graph(inputs[base]->induced_subgraph(ids));
+    if (upper_bound != nullptr) {
+        *upper_bound = search.is_complete() ? common->get_num_nodes() : bound;
+    }
+    if (optimal != nullptr) {
+        *optimal = search.is_complete();
+    }
+
+    for (Graph* graph : inputs) {
+        delete graph;
+    }
+    return {common};
+}
+
 std::vector<std::vector<Graph*>> MCISAlgorithm::run_many(const Graph& g1, const Graph& g2,
                                                          std::vector<AlgorithmType> types) {
     std::vector<std::vector<Graph*>> results;
     for (const auto& type : types) {
         switch (type) {
             case AlgorithmType::BRON_KERBOSCH_SERIAL:
+            case AlgorithmType::COMPONENT_DECOMPOSITION:
+            case AlgorithmType::TREE_DP:
+            case AlgorithmType::HEURISTIC:
+            case AlgorithmType::MULTILEVEL:
+            case AlgorithmType::BRON_KERBOSCH_PARALLEL:
+            case AlgorithmType::DISTRIBUTED:
                 results.push_back(algorithms[static_cast<int>(type)]->find(g1, g2));
                 break;
             default:
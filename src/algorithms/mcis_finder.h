@@ -8,19 +8,91 @@
 #ifndef MCIS_FINDER_H
 #define MCIS_FINDER_H
 
+#include <algorithm>
+#include <memory>
 #include <vector>
 
+#include "mcis/bounds.h"
 #include "mcis/graph.h"
+#include "mcis/mcis_options.h"
+#include "mcis/mcis_result.h"
+#include "warm_start.h"
 
 /**
  * @class MCISFinder
  *
  * Abstract base class for finding the Maximum Common Induced Subgraph (MCIS) between two graphs.
- * Derived classes must implement the find method.
+ * Derived classes must implement the find_mapping method; find returns the result as a subgraph
+ * of g1. Options set with set_options apply to every later search.
  */
 class MCISFinder {
+protected:
+    MCISOptions options;
+
 public:
-    virtual std::vector<Graph*> find(const Graph& g1, const Graph& g2) = 0;
+    void set_options(const MCISOptions& new_options) { options = new_options; }
+
+    [[nodiscard]]
+    const MCISOptions& get_options() const {
+        return options;
+    }
+
+    virtual MCISResult find_mapping(const Graph& g1, const Graph& g2) = 0;
+
+    /**
+     * @brief Searches for a common induced subgraph larger than a known one. Solvers that support
+     * it prune with the incumbent's size; the incumbent is returned if nothing larger is found.
+     */
+    virtual MCISResult improve_mapping(const Graph& g1, const Graph& g2,
+                                       const MCISResult& incumbent) {
+        MCISResult result = find_mapping(g1, g2);
+        if (result.size() < incumbent.size()) {
+            result.mapping = incumbent.mapping;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Re-solves after small edits to the graphs. The previous mapping is repaired against
+     * the edits logged since the versions it was computed on (see WarmStart::repair_mapping) and
+     * passed to improve_mapping as the incumbent, so exact solvers prune with its size from the
+     * start. If the previous result was optimal and the repaired mapping already reaches
+     * WarmStart::edit_bound (or the summary bounds), it is returned without a search. If the log
+     * no longer reaches back that far, every pair is re-checked instead.
+     * @param previous Result of an earlier search on the two graphs, with the same options.
+     * @param g1_version Version of g1 the previous result was computed on.
+     * @param g2_version Version of g2 the previous result was computed on.
+     */
+    MCISResult update_mapping(const Graph& g1, const Graph& g2, const MCISResult& previous,
+                              int g1_version, int g2_version) {
+        std::vector<GraphEdit> edits1;
+        std::vector<GraphEdit> edits2;
+        const bool known1 = g1.get_edits_since(g1_version, edits1);
+        const bool known2 = g2.get_edits_since(g2_version, edits2);
+        std::shared_ptr<const IndexedGraph> i1 = g1.get_indexed();
+        std::shared_ptr<const IndexedGraph> i2 = g2.get_indexed();
+        MCISResult incumbent;
+        incumbent.mapping =
+            WarmStart::repair_mapping(*i1, *i2, previous.mapping, known1 ? &edits1 : nullptr,
+                                      known2 ? &edits2 : nullptr, options);
+        if (previous.optimal && known1 && known2) {
+            const int bound =
+                WarmStart::edit_bound(*i1, *i2, previous.size(), edits1, edits2, options);
+            if (bound >= 0) {
+                incumbent.upper_bound =
+                    std::min(bound, MCISBounds::upper_bound(g1, g2, options));
+                if (incumbent.size() >= incumbent.upper_bound) {
+                    return incumbent;
+                }
+            }
+        }
+        return improve_mapping(g1, g2, incumbent);
+    }
+
+    virtual std::vector<Graph*> find(const Graph& g1, const Graph& g2) {
+        return {find_mapping(g1, g2).to_graph(g1)};
+    }
+
     virtual ~MCISFinder() {};
 };
 
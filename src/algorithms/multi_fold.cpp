@@ -0,0 +1,155 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "multi_fold.h"
+
+#include "association_graph.h"
+#include "clique_search.h"
+
+MultiFold::MultiFold(const IndexedGraph& base, std::vector<const IndexedGraph*> others,
+                     const MCISOptions& options, int upper_bound, long long node_limit)
+    : base(base),
+      others(std::move(others)),
+      options(options),
+      upper_bound(upper_bound),
+      node_limit(node_limit),
+      best(base.get_num_nodes()) {}
+
+int MultiFold::run(const Bitset* first) {
+    Bitset all(base.get_num_nodes());
+    all.set_all();
+    fold(0, all, first);
+    return best_size;
+}
+
+template <typename Visitor>
+void MultiFold::enumerate(const std::vector<Bitset>& adjacency, std::vector<int>& clique,
+                          Bitset& candidates, Bitset& excluded, Visitor&& visit) {
+    if (done()) {
+        return;
+    }
+    if (++nodes_explored > node_limit) {
+        complete = false;
+        return;
+    }
+    if (!candidates.any()) {
+        if (!excluded.any()) {
+            visit(clique);
+        }
+        return;
+    }
+
+    // Tomita pivot over the candidates and the excluded vertices
+    long pivot = -1;
+    size_t pivot_degree = 0;
+    auto consider = [&](size_t u) {
+        const size_t degree = candidates.and_count(adjacency[u]);
+        if (pivot < 0 || degree > pivot_degree) {
+            pivot = static_cast<long>(u);
+            pivot_degree = degree;
+        }
+    };
+    candidates.for_each(consider);
+    excluded.for_each(consider);
+
+    const size_t n = adjacency.size();
+    Bitset branch = candidates;
+    branch.and_not(adjacency[pivot]);
+    Bitset next_candidates(n);
+    Bitset next_excluded(n);
+    branch.for_each([&](size_t v) {
+        if (done() || static_cast<int>(clique.size() + candidates.count()) <= best_size) {
+            return;
+        }
+        next_candidates.assign_and_count(candidates, adjacency[v]);
+        next_excluded.assign_and_count(excluded, adjacency[v]);
+        clique.push_back(static_cast<int>(v));
+        enumerate(adjacency, clique, next_candidates, next_excluded, visit);
+        clique.pop_back();
+        candidates.reset(v);
+        excluded.set(v);
+    });
+}
+
+void MultiFold::fold(size_t level, const Bitset& nodes, const Bitset* first) {
+    const int size = static_cast<int>(nodes.count());
+    if (size <= best_size || done()) {
+        return;
+    }
+    if (level == others.size()) {
+        best = nodes;
+        best_size = size;
+        return;
+    }
+
+    // Association graph of the state and the next input, on the inputs' own indices
+    const IndexedGraph& next = *others[level];
+    std::vector<std::pair<int, int>> pairs;
+    nodes.for_each([&](size_t u) {
+        for (int v = 0; v < next.get_num_nodes(); ++v) {
+            if (AssociationGraph::admissible(base, next, static_cast<int>(u), v, options)) {
+                pairs.emplace_back(static_cast<int>(u), v);
+            }
+        }
+    });
+    const int n = static_cast<int>(pairs.size());
+    std::vector<Bitset> adjacency(n, Bitset(n));
+    for (int p = 0; p < n; ++p) {
+        for (int q = p + 1; q < n; ++q) {
+            if (AssociationGraph::compatible(base, next, pairs[p].first, pairs[p].second,
+                                             pairs[q].first, pairs[q].second)) {
+                adjacency[p].set(q);
+                adjacency[q].set(p);
+            }
+        }
+    }
+
+    std::vector<Bitset> searched;
+    auto descend = [&](const Bitset& child) {
+        for (const Bitset& known : searched) {
+            Bitset rest = child;
+            rest.and_not(known);
+            if (!rest.any()) {
+                return;
+            }
+        }
+        searched.push_back(child);
+        fold(level + 1, child, nullptr);
+    };
+    auto node_set = [&](const std::vector<int>& clique) {
+        Bitset child(base.get_num_nodes());
+        for (int p : clique) {
+            child.set(pairs[p].first);
+        }
+        return child;
+    };
+
+    // The maximum first; if it does not beat the incumbent, no fold below this state does
+    if (first != nullptr) {
+        descend(*first);
+    } else {
+        Bitset all(n);
+        all.set_all();
+        MaxCliqueSearch<Bitset> search(adjacency.data(), Bitset(n));
+        search.run(all, best_size);
+        nodes_explored += search.get_nodes_explored();
+        if (!search.get_best().any()) {
+            return;
+        }
+        std::vector<int> maximum;
+        search.get_best().for_each([&](size_t p) { maximum.push_back(static_cast<int>(p)); });
+        descend(node_set(maximum));
+    }
+
+    // Then every other maximal mapping that can still beat the incumbent
+    std::vector<int> clique;
+    Bitset candidates(n);
+    candidates.set_all();
+    Bitset excluded(n);
+    enumerate(adjacency, clique, candidates, excluded,
+              [&](const std::vector<int>& maximal) { descend(node_set(maximal)); });
+}
@@ -0,0 +1,113 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef MULTI_FOLD_H
+#define MULTI_FOLD_H
+
+#include <utility>
+#include <vector>
+
+#include "mcis/bitset.h"
+#include "mcis/indexed_graph.h"
+#include "mcis/mcis_options.h"
+
+/**
+ * @class MultiFold
+ *
+ * Branch and bound for the largest induced subgraph of a base graph that embeds in every other
+ * input, folding the other inputs in one at a time. A fold state is a set of base nodes common to
+ * the base and the inputs folded so far. Its children are the node sets of the maximal common
+ * induced subgraphs of the state and the next input. The maximum mapping comes first; it is found
+ * by the clique search with the incumbent as lower bound, so a state none of whose mappings beats
+ * the incumbent is pruned outright. Every other maximal mapping larger than the incumbent follows,
+ * so a pairwise optimum that does not extend to the remaining inputs is backtracked from. Node
+ * sets within one already searched at the same fold are skipped. Pairs are built on the inputs'
+ * own indices, so level-constrained mode compares the levels of the original inputs.
+ */
+class MultiFold {
+private:
+    const IndexedGraph& base;
+    std::vector<const IndexedGraph*> others;
+    MCISOptions options;
+
+    /**
+     * @brief Proven bound on the result; the search stops once the incumbent reaches it.
+     */
+    int upper_bound;
+
+    long long node_limit;
+    long long nodes_explored = 0;
+    bool complete = true;
+
+    Bitset best;
+    int best_size = 0;
+
+    [[nodiscard]]
+    bool done() const {
+        return best_size >= upper_bound || !complete;
+    }
+
+    /**
+     * @brief Searches below a fold state.
+     * @param level Number of other inputs folded into the state.
+     * @param nodes Base nodes of the state.
+     * @param first Optional node set of a known common subgraph of the state and the next input,
+     * searched first in place of the maximum.
+     */
+    void fold(size_t level, const Bitset& nodes, const Bitset* first);
+
+    /**
+     * @brief Bron-Kerbosch enumeration, with pivoting, of the maximal cliques larger than the
+     * incumbent; each one is passed to visit.
+     */
+    template <typename Visitor>
+    void enumerate(const std::vector<Bitset>& adjacency, std::vector<int>& clique,
+                   Bitset& candidates, Bitset& excluded, Visitor&& visit);
+
+public:
+    /**
+     * @brief Prepares the search.
+     * @param base Graph whose induced subgraphs are searched.
+     * @param others Inputs folded in, in this order; tightest first prunes the most.
+     * @param options Matching constraints.
+     * @param upper_bound Proven bound on the result, e.g. the smallest pairwise optimum.
+     * @param node_limit Search nodes allowed over all folds.
+     */
+    MultiFold(const IndexedGraph& base, std::vector<const IndexedGraph*> others,
+              const MCISOptions& options, int upper_bound, long long node_limit);
+
+    /**
+     * @brief Runs the search.
+     * @param first Optional node set of a known common subgraph of the base and the first other
+     * input (e.g. a pairwise result), searched first at the first fold.
+     * @return The size of the best common subgraph found.
+     */
+    int run(const Bitset* first = nullptr);
+
+    /**
+     * @brief Retrieves the base nodes of the best common subgraph found.
+     */
+    [[nodiscard]]
+    const Bitset& get_best() const {
+        return best;
+    }
+
+    /**
+     * @brief Indicates if the search finished within the node limit, so the result is maximum.
+     */
+    [[nodiscard]]
+    bool is_complete() const {
+        return complete;
+    }
+
+    [[nodiscard]]
+    long long get_nodes_explored() const {
+        return nodes_explored;
+    }
+};
+
+#endif  // MULTI_FOLD_H
@@ -0,0 +1,236 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "multilevel_mcis.h"
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "heuristic_mcis.h"
+#include "local_search.h"
+
+namespace {
+
+// Number of distinct neighbors; a 2-cycle counts its partner once
+int num_neighbors(const IndexedGraph& graph, int v) {
+    auto children = graph.get_children(v);
+    auto parents = graph.get_parents(v);
+    int shared = 0;
+    for (int w : children) {
+        shared += std::binary_search(parents.begin(), parents.end(), w) ? 1 : 0;
+    }
+    return static_cast<int>(children.size() + parents.size()) - shared;
+}
+
+int only_neighbor(const IndexedGraph& graph, int v) {
+    auto children = graph.get_children(v);
+    return children.empty() ? graph.get_parents(v)[0] : children[0];
+}
+
+}  // namespace
+
+MultilevelMCIS::Level MultilevelMCIS::coarsen(const Level& fine, SignatureTable& table) {
+    const IndexedGraph& graph = fine.graph;
+    const int n = graph.get_num_nodes();
+    std::vector<int> degree(n);
+    for (int v = 0; v < n; ++v) {
+        degree[v] = num_neighbors(graph, v);
+    }
+
+    // Leaves join their neighbor; of an isolated edge, the source leads (the smaller index for a
+    // 2-cycle)
+    std::vector<int> leader(n);
+    std::iota(leader.begin(), leader.end(), 0);
+    std::vector<bool> grouped(n, false);
+    for (int v = 0; v < n; ++v) {
+        if (degree[v] != 1) {
+            continue;
+        }
+        const int w = only_neighbor(graph, v);
+        const bool led = graph.has_edge(w, v) && !(graph.has_edge(v, w) && v < w);
+        if (degree[w] > 1 || led) {
+            leader[v] = w;
+            grouped[v] = true;
+            grouped[w] = true;
+        }
+    }
+
+    // Remaining single nodes pair with a single neighbor of lowest degree
+    std::vector<int> order;
+    for (int v = 0; v < n; ++v) {
+        if (!grouped[v]) {
+            order.push_back(v);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return std::tie(fine.colours[a], degree[a], a) < std::tie(fine.colours[b], degree[b], b);
+    });
+    for (int v : order) {
+        if (grouped[v]) {
+            continue;
+        }
+        int best = -1;
+        auto consider = [&](int w) {
+            if (!grouped[w] && w != v
+                && (best < 0
+                    || std::tie(degree[w], fine.colours[w], w)
+                           < std::tie(degree[best], fine.colours[best], best))) {
+                best = w;
+            }
+        };
+        for (int w : graph.get_children(v)) {
+            consider(w);
+        }
+        for (int w : graph.get_parents(v)) {
+            consider(w);
+        }
+        if (best >= 0) {
+            // The source of the edge leads the pair
+            if (graph.has_edge(v, best)) {
+                leader[best] = v;
+            } else {
+                leader[v] = best;
+            }
+            grouped[v] = true;
+            grouped[best] = true;
+        }
+    }
+
+    // Coarse nodes in order of their leaders
+    Level coarse;
+    std::vector<int> group(n, -1);
+    for (int v = 0; v < n; ++v) {
+        if (leader[v] == v) {
+            group[v] = static_cast<int>(coarse.members.size());
+            coarse.members.push_back({v});
+        }
+    }
+    for (int v = 0; v < n; ++v) {
+        if (leader[v] != v) {
+            group[v] = group[leader[v]];
+            coarse.members[group[v]].push_back(v);
+        }
+    }
+
+    const int num_groups = static_cast<int>(coarse.members.size());
+    std::vector<std::string> ids(num_groups);
+    std::vector<OpLabel> labels(num_groups);
+    coarse.colours.resize(num_groups);
+    for (int c = 0; c < num_groups; ++c) {
+        std::vector<int>& members = coarse.members[c];
+        const int head = members[0];
+        auto key = [&](int v) {
+            return std::tuple(fine.colours[v], graph.has_edge(head, v) ? 1 : 0, v);
+        };
+        std::sort(members.begin() + 1, members.end(),
+                  [&](int a, int b) { return key(a) < key(b); });
+
+        std::vector<int> signature = {fine.colours[head]};
+        for (size_t i = 1; i < members.size(); ++i) {
+            signature.push_back(fine.colours[members[i]]);
+            signature.push_back(graph.has_edge(head, members[i]) ? 1 : 0);
+        }
+        coarse.colours[c]
+            = table.emplace(std::move(signature), static_cast<int>(table.size())).first->second;
+        ids[c] = std::to_string(c);
+        labels[c] = graph.get_label(head);
+    }
+
+    std::vector<std::tuple<int, int, int>> edges;
+    for (int u = 0; u < n; ++u) {
+        for (int w : graph.get_children(u)) {
+            if (group[u] != group[w]) {
+                edges.emplace_back(group[u], group[w], 0);
+            }
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    coarse.graph = IndexedGraph(std::move(ids), std::move(labels), edges);
+    return coarse;
+}
+
+MCISResult MultilevelMCIS::find_mapping(const Graph& g1, const Graph& g2) {
+    const auto begin = LocalSearch::Clock::now();
+    auto seconds = [](double s) {
+        return std::chrono::duration_cast<LocalSearch::Clock::duration>(
+            std::chrono::duration<double>(s));
+    };
+    const auto deadline = begin + seconds(options.time_limit);
+
+    std::vector<Level> levels1(1);
+    std::vector<Level> levels2(1);
+    levels1[0].graph = IndexedGraph(g1);
+    levels2[0].graph = IndexedGraph(g2);
+    levels1[0].colours = HeuristicMCIS::label_colours(levels1[0].graph);
+    levels2[0].colours = HeuristicMCIS::label_colours(levels2[0].graph);
+    const int upper_bound = LocalSearch::colour_bound(levels1[0].colours, levels2[0].colours);
+
+    while (static_cast<int>(levels1.size()) <= MULTILEVEL_MAX_LEVELS) {
+        const int n1 = levels1.back().graph.get_num_nodes();
+        const int n2 = levels2.back().graph.get_num_nodes();
+        if (std::max(n1, n2) <= MULTILEVEL_COARSEST_SIZE) {
+            break;
+        }
+        SignatureTable table;
+        Level coarse1 = coarsen(levels1.back(), table);
+        Level coarse2 = coarsen(levels2.back(), table);
+        if (coarse1.graph.get_num_nodes() > MULTILEVEL_MIN_REDUCTION * n1
+            && coarse2.graph.get_num_nodes() > MULTILEVEL_MIN_REDUCTION * n2) {
+            break;
+        }
+        levels1.push_back(std::move(coarse1));
+        levels2.push_back(std::move(coarse2));
+    }
+
+    // Solve the coarsest pair, then project and refine level by level
+    MCISResult result;
+    const int depth = static_cast<int>(levels1.size()) - 1;
+    const double coarsest_share = depth == 0 ? 1.0 : MULTILEVEL_COARSEST_SHARE;
+    IndexMapping mapping;
+    for (int level = depth; level >= 0; --level) {
+        const Level& l1 = levels1[level];
+        const Level& l2 = levels2[level];
+        if (level < depth) {
+            IndexMapping projected;
+            for (const auto& [a, b] : mapping) {
+                const auto& members1 = levels1[level + 1].members[a];
+                const auto& members2 = levels2[level + 1].members[b];
+                for (size_t i = 0; i < members1.size() && i < members2.size(); ++i) {
+                    projected.emplace_back(members1[i], members2[i]);
+                }
+            }
+            mapping = std::move(projected);
+        }
+
+        auto level_deadline = deadline;
+        if (level > 0) {
+            const double share = level == depth
+                                     ? coarsest_share
+                                     : coarsest_share + (1.0 - coarsest_share) * (depth - level)
+                                                            / depth;
+            level_deadline = std::min(deadline, begin + seconds(options.time_limit * share));
+        }
+        const int bound = level == 0 ? upper_bound
+                                     : LocalSearch::colour_bound(l1.colours, l2.colours);
+        mapping = LocalSearch::anneal(l1.graph, l2.graph, l1.colours, l2.colours, options, mapping,
+                                      level_deadline, bound, result.nodes_explored);
+    }
+
+    const IndexedGraph& i1 = levels1[0].graph;
+    const IndexedGraph& i2 = levels2[0].graph;
+    for (const auto& [u, v] : mapping) {
+        result.mapping.emplace_back(i1.get_id(u), i2.get_id(v));
+    }
+    result.upper_bound = upper_bound;
+    result.optimal = result.size() == upper_bound;
+    return result;
+}
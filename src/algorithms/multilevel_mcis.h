@@ -0,0 +1,94 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef MULTILEVEL_MCIS_H
+#define MULTILEVEL_MCIS_H
+
+#include <map>
+#include <vector>
+
+#include "mcis/graph.h"
+#include "mcis/indexed_graph.h"
+#include "mcis_finder.h"
+
+/**
+ * @brief Coarsening stops once both graphs have at most this many nodes.
+ */
+constexpr int MULTILEVEL_COARSEST_SIZE = 2000;
+
+/**
+ * @brief Coarsening stops when a round leaves both graphs with more than this fraction of their
+ * nodes.
+ */
+constexpr double MULTILEVEL_MIN_REDUCTION = 0.9;
+
+/**
+ * @brief Largest number of coarse levels built above the input graphs.
+ */
+constexpr int MULTILEVEL_MAX_LEVELS = 32;
+
+/**
+ * @brief Fraction of options.time_limit spent on the coarsest level; the rest is split evenly
+ * among the refinement levels.
+ */
+constexpr double MULTILEVEL_COARSEST_SHARE = 0.5;
+
+/**
+ * @class MultilevelMCIS
+ *
+ * Multilevel MCIS heuristic for graphs with 10^5 nodes and more. Both graphs are coarsened
+ * together, level by level: every node with a single neighbor is absorbed into that neighbor, and
+ * the remaining single nodes are paired along edges, preferring low-degree neighbors. Each coarse
+ * node is coloured by the colours of its members and the directions of the edges joining them,
+ * through a signature table shared by both graphs, so coarse nodes of equal colour have member
+ * lists that line up.
+ *
+ * The coarsest pair is solved with the annealing local search of HeuristicMCIS. The mapping is
+ * then projected one level down (the members of two matched coarse nodes are matched in order)
+ * and refined there: inconsistent projected pairs are dropped, the mapping is extended greedily,
+ * and annealing continues from it. Each level costs time linear in its size plus its share of
+ * options.time_limit. Only the input level enforces edge weights; coarse graphs are unweighted.
+ */
+class MultilevelMCIS : public MCISFinder {
+public:
+    /**
+     * @struct Level
+     * @brief One graph of the hierarchy.
+     */
+    struct Level {
+        IndexedGraph graph;
+
+        /**
+         * @brief Colour of every node; nodes may only be matched to nodes of equal colour.
+         */
+        std::vector<int> colours;
+
+        /**
+         * @brief Nodes of the next finer level grouped in each node, in canonical order; empty
+         * for the input level.
+         */
+        std::vector<std::vector<int>> members;
+    };
+
+    /**
+     * @brief Colours of coarse nodes by signature (member colours and edge directions), shared
+     * by both graphs at one depth.
+     */
+    using SignatureTable = std::map<std::vector<int>, int>;
+
+    /**
+     * @brief Coarsens one level by leaf absorption and edge pairing.
+     * @param fine The level to coarsen.
+     * @param table Signature table of the new depth.
+     * @return The coarse level.
+     */
+    static Level coarsen(const Level& fine, SignatureTable& table);
+
+    MCISResult find_mapping(const Graph& g1, const Graph& g2) override;
+};
+
+#endif  // MULTILEVEL_MCIS_H
@@ -0,0 +1,93 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "orbital_branching.h"
+
+#include <utility>
+
+OrbitalBranching::OrbitalBranching(const AssociationGraph& association, const IndexedGraph& g1,
+                                   const IndexedGraph& g2)
+    : association(association), g1(g1), g2(g2) {
+    Level root;
+    root.group1 = std::make_shared<const AutomorphismGroup>(g1);
+    root.group2 = std::make_shared<const AutomorphismGroup>(g2);
+    enabled = root.group1->is_complete() && root.group2->is_complete()
+              && !(root.group1->is_trivial() && root.group2->is_trivial());
+    if (enabled) {
+        auto orbit = std::make_shared<std::vector<int>>();
+        association.get_pair_orbits(*root.group1, *root.group2, *orbit);
+        root.orbit = std::move(orbit);
+    }
+    levels.push_back(std::move(root));
+}
+
+std::shared_ptr<const AutomorphismGroup> OrbitalBranching::stabilize(
+    const IndexedGraph& graph, const std::shared_ptr<const AutomorphismGroup>& parent,
+    const std::vector<int>& fixed) {
+    // Every automorphism already fixes the new node, so the stabilizer does not shrink
+    if (parent->fixes(fixed.back())) {
+        return parent;
+    }
+    auto group = std::make_shared<const AutomorphismGroup>(graph, fixed,
+                                                           AUTOMORPHISM_SEARCH_LIMIT, parent.get());
+    work += group->get_work() * graph.get_num_nodes() * SYMMETRY_ROUND_COST;
+    return group;
+}
+
+bool OrbitalBranching::get_orbits(const std::vector<int>& clique, std::vector<int>& orbit,
+                                  long long saved) {
+    if (!enabled) {
+        return false;
+    }
+    if (work > SYMMETRY_WORK_BUDGET + saved) {
+        enabled = false;
+        return false;
+    }
+
+    // Keep the stabilizers of the longest prefix shared with the previous clique
+    size_t depth = 0;
+    while (depth < clique.size() && depth + 1 < levels.size()
+           && levels[depth + 1].pair == clique[depth]) {
+        depth++;
+    }
+    levels.resize(depth + 1);
+    levels.reserve(clique.size() + 1);
+
+    std::vector<int> fixed1;
+    std::vector<int> fixed2;
+    for (size_t i = 0; i < depth && depth < clique.size(); ++i) {
+        fixed1.push_back(association.get_pair(clique[i]).first);
+        fixed2.push_back(association.get_pair(clique[i]).second);
+    }
+    for (; depth < clique.size(); ++depth) {
+        const Level& parent = levels[depth];
+        if (!parent.orbit) {
+            return false;
+        }
+        fixed1.push_back(association.get_pair(clique[depth]).first);
+        fixed2.push_back(association.get_pair(clique[depth]).second);
+        Level next;
+        next.pair = clique[depth];
+        next.group1 = stabilize(g1, parent.group1, fixed1);
+        next.group2 = stabilize(g2, parent.group2, fixed2);
+        if (next.group1 == parent.group1 && next.group2 == parent.group2) {
+            next.orbit = parent.orbit;
+        } else if (next.group1->is_complete() && next.group2->is_complete()
+                   && !(next.group1->is_trivial() && next.group2->is_trivial())) {
+            auto pair_orbit = std::make_shared<std::vector<int>>();
+            association.get_pair_orbits(*next.group1, *next.group2, *pair_orbit);
+            next.orbit = std::move(pair_orbit);
+        }
+        levels.push_back(std::move(next));
+    }
+
+    if (!levels.back().orbit) {
+        return false;
+    }
+    orbit = *levels.back().orbit;
+    return true;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef ORBITAL_BRANCHING_H
+#define ORBITAL_BRANCHING_H
+
+#include <memory>
+#include <vector>
+
+#include "association_graph.h"
+#include "mcis/indexed_graph.h"
+#include "mcis/symmetry.h"
+
+/**
+ * @class OrbitalBranching
+ *
+ * Supplies the pair orbits of the clique search's orbit callback. The automorphism groups of both
+ * graphs are computed once; the stabilizer of a clique is derived from the stabilizer of its
+ * parent search node, which is reused as is when the new pair's nodes are fixed points of it.
+ * Stabilizers along the current search path are cached, so sibling search nodes share their
+ * parent's groups. Their refinement rounds, converted to search nodes with SYMMETRY_ROUND_COST,
+ * may exceed the search nodes saved by at most SYMMETRY_WORK_BUDGET; once the work stops paying,
+ * no further orbits are produced.
+ */
+class OrbitalBranching {
+private:
+    /**
+     * @brief Stabilizers of a clique prefix and the pair orbits they induce.
+     */
+    struct Level {
+        int pair = -1;
+        std::shared_ptr<const AutomorphismGroup> group1;
+        std::shared_ptr<const AutomorphismGroup> group2;
+        std::shared_ptr<const std::vector<int>> orbit;
+    };
+
+    const AssociationGraph& association;
+    const IndexedGraph& g1;
+    const IndexedGraph& g2;
+
+    /**
+     * @brief levels[d] holds the stabilizers of the first d vertices of the last clique seen.
+     */
+    std::vector<Level> levels;
+
+    long long work = 0;
+    bool enabled = false;
+
+    /**
+     * @brief Derives the stabilizer of the next node of a clique from the stabilizer of the
+     * previous ones.
+     */
+    std::shared_ptr<const AutomorphismGroup> stabilize(
+        const IndexedGraph& graph, const std::shared_ptr<const AutomorphismGroup>& parent,
+        const std::vector<int>& fixed);
+
+public:
+    /**
+     * @brief Computes the automorphism groups of both graphs.
+     */
+    OrbitalBranching(const AssociationGraph& association, const IndexedGraph& g1,
+                     const IndexedGraph& g2);
+
+    /**
+     * @brief Indicates if the groups are exact and at least one of them is non-trivial, i.e. if
+     * orbital branching can prune anything.
+     */
+    [[nodiscard]]
+    bool applies() const {
+        return enabled;
+    }
+
+    /**
+     * @brief Assigns every pair its orbit under the stabilizers of a clique's nodes.
+     * @param clique Association vertices of the search node.
+     * @param orbit Output orbit ID of every pair.
+     * @param saved Search nodes saved so far by orbital branching, which pay for further
+     * stabilizers.
+     * @return False if there is nothing to prune below the search node, the orbits are not
+     * exact, or the work budget is spent.
+     */
+    bool get_orbits(const std::vector<int>& clique, std::vector<int>& orbit, long long saved);
+
+    /**
+     * @brief Retrieves the cost of the stabilizers derived so far, in search nodes.
+     */
+    [[nodiscard]]
+    long long get_work() const {
+        return work;
+    }
+};
+
+#endif  // ORBITAL_BRANCHING_H
@@ -0,0 +1,476 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef PARALLEL_SEARCH_H
+#define PARALLEL_SEARCH_H
+
+#include <omp.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "checkpoint.h"
+#include "clique_search.h"
+
+/**
+ * @brief Number of subproblems per thread the root of a parallel search is split into before the
+ * workers start.
+ */
+constexpr int PARALLEL_SEARCH_TASKS_PER_THREAD = 16;
+
+/**
+ * @brief Smallest candidate count of a search node handed to an idle worker; smaller nodes are
+ * searched where they are.
+ */
+constexpr size_t PARALLEL_SEARCH_MIN_DONATION = 8;
+
+/**
+ * @class ParallelCliqueSearch
+ *
+ * Parallel driver for the branch-and-bound clique search. The root is split breadth-first, always
+ * expanding the subproblem with the most candidates, into PARALLEL_SEARCH_TASKS_PER_THREAD
+ * subproblems per thread, dealt round-robin into per-worker deques. Each worker runs its own
+ * MaxCliqueSearch on the back of its deque and, once empty, steals from the front of the others',
+ * where the shallowest (largest) subproblems sit. While any worker is idle, busy workers push
+ * their child search nodes onto their own deque instead of descending into them, so unbalanced
+ * trees keep being split as deep as needed. The incumbent size is a single atomic shared by all
+ * searches.
+ *
+ * With checkpointing enabled, a worker that finds the checkpoint interval elapsed raises an
+ * interruption flag. Every worker then pushes the unexplored part of its current subproblem onto
+ * its deque and pauses; the last one to pause writes the deques, the best clique and the
+ * statistics to the checkpoint file, and all workers continue. A final checkpoint with an empty
+ * frontier is written when the search ends.
+ *
+ * @tparam Set Bitset-like vertex set type, as for MaxCliqueSearch.
+ */
+template <typename Set>
+class ParallelCliqueSearch {
+public:
+    using BoundFunction = typename MaxCliqueSearch<Set>::BoundFunction;
+    using BranchFunction = typename MaxCliqueSearch<Set>::BranchFunction;
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Creates a fresh bound for one worker, since bounds may hold scratch state.
+     */
+    using BoundFactory = std::function<BoundFunction()>;
+
+private:
+    struct Task {
+        std::vector<int> clique;
+        Set candidates;
+        size_t count;
+    };
+
+    struct Worker {
+        std::mutex lock;
+        std::deque<Task> tasks;
+        MaxCliqueSearch<Set> search;
+
+        Worker(const Set* adjacency, const Set& empty) : search(adjacency, empty) {}
+    };
+
+    const Set* adjacency;
+    Set empty;
+    BoundFactory bound_factory;
+    BranchFunction branch_function;
+    int num_threads;
+
+    Set best;
+    int best_size = 0;
+    long long nodes_explored = 0;
+    long long steals = 0;
+
+    /**
+     * @brief Checkpoint destination (empty when disabled), interval, and instance identity.
+     */
+    std::string checkpoint_path;
+    double checkpoint_interval = 0.0;
+    uint64_t fingerprint = 0;
+    int num_vertices = 0;
+    int checkpoints_written = 0;
+
+    /**
+     * @brief Replaces a subproblem by its children under Tomita pivoting, as the serial search
+     * would branch; children that cannot beat the incumbent are dropped and leaves recorded.
+     */
+    void split(const Task& task, std::vector<Task>& children) {
+        long pivot = -1;
+        size_t pivot_degree = 0;
+        task.candidates.for_each([&](size_t u) {
+            const size_t degree = task.candidates.and_count(adjacency[u]);
+            if (pivot < 0 || degree > pivot_degree) {
+                pivot = static_cast<long>(u);
+                pivot_degree = degree;
+            }
+        });
+        Set branch = task.candidates;
+        branch.and_not(adjacency[pivot]);
+        Set remaining = task.candidates;
+        while (branch.any()) {
+            const long v = branch.find_first();
+            branch.reset(v);
+            Task child{task.clique, empty, 0};
+            child.clique.push_back(static_cast<int>(v));
+            child.count = child.candidates.assign_and_count(remaining, adjacency[v]);
+            remaining.reset(v);
+            const int size = static_cast<int>(child.clique.size());
+            if (child.count == 0 && size > best_size) {
+                best = to_set(child.clique);
+                best_size = size;
+            }
+            if (child.count > 0 && size + static_cast<int>(child.count) > best_size) {
+                children.push_back(std::move(child));
+            }
+        }
+    }
+
+    Set to_set(const std::vector<int>& vertices) const {
+        Set set = empty;
+        for (int v : vertices) {
+            set.set(v);
+        }
+        return set;
+    }
+
+    static std::vector<int> to_vertices(const Set& set) {
+        std::vector<int> vertices;
+        set.for_each([&](size_t v) { vertices.push_back(static_cast<int>(v)); });
+        return vertices;
+    }
+
+    /**
+     * @brief Writes the frontier held in the deques; the workers must all be paused or finished.
+     */
+    void write_checkpoint(const std::vector<std::unique_ptr<Worker>>& workers, int shared_best) {
+        SearchCheckpoint checkpoint;
+        checkpoint.fingerprint = fingerprint;
+        checkpoint.num_vertices = num_vertices;
+        checkpoint.best_size = shared_best;
+        checkpoint.best = to_vertices(best);
+        checkpoint.nodes_explored = nodes_explored;
+        int recorded = best_size;
+        for (const auto& worker : workers) {
+            checkpoint.nodes_explored += worker->search.get_nodes_explored();
+            const Set& found = worker->search.get_best();
+            if (static_cast<int>(found.count()) > recorded) {
+                recorded = static_cast<int>(found.count());
+                checkpoint.best = to_vertices(found);
+            }
+            std::lock_guard<std::mutex> guard(worker->lock);
+            for (const Task& task : worker->tasks) {
+                checkpoint.frontier.push_back({task.clique, to_vertices(task.candidates)});
+            }
+        }
+        if (checkpoint.save(checkpoint_path)) {
+            checkpoints_written++;
+        }
+    }
+
+    /**
+     * @brief Runs the workers until every task and every task split off from it is searched.
+     */
+    int search(std::vector<Task>& tasks) {
+        const bool checkpointing = !checkpoint_path.empty();
+        if (tasks.empty()) {
+            if (checkpointing) {
+                write_checkpoint({}, best_size);
+            }
+            return best_size;
+        }
+
+        std::vector<std::unique_ptr<Worker>> workers;
+        for (int w = 0; w < num_threads; ++w) {
+            workers.push_back(std::make_unique<Worker>(adjacency, empty));
+        }
+        for (size_t t = 0; t < tasks.size(); ++t) {
+            workers[t % num_threads]->tasks.push_back(std::move(tasks[t]));
+        }
+
+        std::atomic<int> shared_best(best_size);
+        std::atomic<long long> pending(static_cast<long long>(tasks.size()));
+        std::atomic<int> idle(0);
+        std::atomic<long long> stolen(0);
+
+        // Checkpoint rendezvous: workers count themselves in `arrived` when pausing or finishing,
+        // and paused workers wait for `generation` to move on
+        auto seconds = [](double s) {
+            return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(s));
+        };
+        std::atomic<Clock::rep> next_checkpoint(
+            (Clock::now() + seconds(checkpoint_interval)).time_since_epoch().count());
+        std::atomic<bool> interrupt(false);
+        std::atomic<int> arrived(0);
+        std::atomic<int> finished(0);
+        std::atomic<int> generation(0);
+        auto release = [&]() {
+            write_checkpoint(workers, shared_best.load());
+            next_checkpoint.store(
+                (Clock::now() + seconds(checkpoint_interval)).time_since_epoch().count());
+            arrived.store(finished.load());
+            interrupt.store(false);
+            generation++;
+        };
+
+#pragma omp parallel num_threads(num_threads)
+        {
+            const int id = omp_get_thread_num();
+            const int team = omp_get_num_threads();
+            Worker& me = *workers[id];
+            auto push = [&](const std::vector<int>& clique, const Set& next, size_t next_count) {
+                std::lock_guard<std::mutex> guard(me.lock);
+                pending++;
+                me.tasks.push_back({clique, next, next_count});
+            };
+
+            me.search.reset(best_size);
+            me.search.set_shared_best(&shared_best);
+            if (bound_factory) {
+                me.search.set_bound(bound_factory());
+            }
+            if (branch_function) {
+                me.search.set_branching(branch_function);
+            }
+            long long ticks = 0;
+            me.search.set_split([&](const std::vector<int>& clique, const Set& next,
+                                    size_t next_count) {
+                if (checkpointing && ++ticks % CHECKPOINT_CLOCK_STRIDE == 0
+                    && Clock::now().time_since_epoch().count() >= next_checkpoint.load()) {
+                    interrupt.store(true);
+                }
+                if (next_count < PARALLEL_SEARCH_MIN_DONATION || idle.load() == 0) {
+                    return false;
+                }
+                {
+                    std::lock_guard<std::mutex> guard(me.lock);
+                    if (me.tasks.size() >= static_cast<size_t>(idle.load())) {
+                        return false;
+                    }
+                }
+                push(clique, next, next_count);
+                return true;
+            });
+            if (checkpointing) {
+                me.search.set_interrupt(&interrupt, [&](const std::vector<int>& clique,
+                                                        const Set& next, size_t next_count) {
+                    push(clique, next, next_count);
+                    return true;
+                });
+            }
+
+            bool waiting = false;
+            while (true) {
+                if (interrupt.load()) {
+                    const int seen = generation.load();
+                    if (arrived.fetch_add(1) + 1 == team) {
+                        release();
+                    } else {
+                        while (generation.load() == seen) {
+                            std::this_thread::yield();
+                        }
+                    }
+                    continue;
+                }
+
+                Task task;
+                bool found = false;
+                {
+                    std::lock_guard<std::mutex> guard(me.lock);
+                    if (!me.tasks.empty()) {
+                        task = std::move(me.tasks.back());
+                        me.tasks.pop_back();
+                        found = true;
+                    }
+                }
+                for (int k = 1; k < num_threads && !found; ++k) {
+                    Worker& victim = *workers[(id + k) % num_threads];
+                    std::lock_guard<std::mutex> guard(victim.lock);
+                    if (!victim.tasks.empty()) {
+                        task = std::move(victim.tasks.front());
+                        victim.tasks.pop_front();
+                        found = true;
+                        stolen++;
+                    }
+                }
+                if (found) {
+                    if (waiting) {
+                        idle--;
+                        waiting = false;
+                    }
+                    me.search.run_subproblem(task.clique, task.candidates, task.count);
+                    pending--;
+                    continue;
+                }
+                if (pending.load() == 0) {
+                    break;
+                }
+                if (!waiting) {
+                    idle++;
+                    waiting = true;
+                }
+                std::this_thread::yield();
+            }
+            if (waiting) {
+                idle--;
+            }
+
+            // The last worker to arrive serves a checkpoint requested just before the end
+            finished++;
+            if (arrived.fetch_add(1) + 1 == team && interrupt.load()) {
+                release();
+            }
+        }
+
+        for (const auto& worker : workers) {
+            nodes_explored += worker->search.get_nodes_explored();
+            const int size = static_cast<int>(worker->search.get_best().count());
+            if (size > best_size) {
+                best = worker->search.get_best();
+                best_size = size;
+            }
+        }
+        steals = stolen.load();
+        if (checkpointing) {
+            write_checkpoint({}, best_size);
+        }
+        return best_size;
+    }
+
+public:
+    /**
+     * @brief Prepares a search over the given adjacency rows.
+     * @param adjacency Neighborhood set of every vertex; must outlive the search.
+     * @param empty An empty set sized for the vertex count.
+     * @param threads Number of workers; 0 uses the OpenMP default.
+     */
+    ParallelCliqueSearch(const Set* adjacency, const Set& empty, int threads = 0)
+        : adjacency(adjacency), empty(empty),
+          num_threads(threads > 0 ? threads : omp_get_max_threads()), best(empty) {}
+
+    /**
+     * @brief Installs an additional upper bound, created once per worker.
+     */
+    void set_bound(BoundFactory factory) { bound_factory = std::move(factory); }
+
+    /**
+     * @brief Installs a dynamic branching policy, copied to every worker.
+     */
+    void set_branching(BranchFunction branch) { branch_function = std::move(branch); }
+
+    /**
+     * @brief Identifies the instance for resume and enables periodic checkpoints of later runs.
+     * @param path Checkpoint file, overwritten by every checkpoint; empty disables checkpoints.
+     * @param interval Seconds between checkpoints.
+     * @param instance Fingerprint of the instance, stored in the file.
+     * @param vertices Number of vertices of the instance.
+     */
+    void set_checkpoint(std::string path, double interval, uint64_t instance, int vertices) {
+        checkpoint_path = std::move(path);
+        checkpoint_interval = interval;
+        fingerprint = instance;
+        num_vertices = vertices;
+    }
+
+    /**
+     * @brief Finds a maximum clique among the given candidate vertices.
+     * @param candidates Vertices allowed in the clique.
+     * @param lower_bound Size of a clique already known elsewhere; only larger cliques are
+     * recorded, so get_best stays empty if none exists.
+     * @param incumbent Optional clique of size lower_bound, reported by get_best (and stored in
+     * checkpoints) unless a larger one is found.
+     * @return The size of the maximum clique, or lower_bound if no larger clique exists.
+     */
+    int run(const Set& candidates, int lower_bound = 0, const Set* incumbent = nullptr) {
+        best = incumbent ? *incumbent : empty;
+        best_size = lower_bound;
+        nodes_explored = 0;
+        steals = 0;
+
+        std::vector<Task> tasks;
+        const size_t count = candidates.count();
+        if (count > 0 && static_cast<int>(count) > lower_bound) {
+            tasks.push_back({{}, candidates, count});
+        }
+        const size_t target = static_cast<size_t>(num_threads) * PARALLEL_SEARCH_TASKS_PER_THREAD;
+        while (!tasks.empty() && tasks.size() < target) {
+            size_t largest = 0;
+            for (size_t t = 1; t < tasks.size(); ++t) {
+                if (tasks[t].count > tasks[largest].count) {
+                    largest = t;
+                }
+            }
+            std::swap(tasks[largest], tasks.back());
+            Task task = std::move(tasks.back());
+            tasks.pop_back();
+            split(task, tasks);
+            nodes_explored++;
+        }
+        return search(tasks);
+    }
+
+    /**
+     * @brief Continues a search from a checkpoint of the same instance.
+     * @param checkpoint Frontier, best clique and statistics to resume from.
+     * @return The size of the maximum clique, or -1 if the checkpoint belongs to another instance
+     * (nothing is searched then).
+     */
+    int resume(const SearchCheckpoint& checkpoint) {
+        if (checkpoint.fingerprint != fingerprint || checkpoint.num_vertices != num_vertices) {
+            return -1;
+        }
+        best = to_set(checkpoint.best);
+        best_size = checkpoint.best_size;
+        nodes_explored = checkpoint.nodes_explored;
+        steals = 0;
+        std::vector<Task> tasks;
+        for (const SearchCheckpoint::Node& node : checkpoint.frontier) {
+            Set candidates = to_set(node.candidates);
+            tasks.push_back({node.clique, candidates, node.candidates.size()});
+        }
+        return search(tasks);
+    }
+
+    [[nodiscard]]
+    const Set& get_best() const {
+        return best;
+    }
+
+    [[nodiscard]]
+    long long get_nodes_explored() const {
+        return nodes_explored;
+    }
+
+    /**
+     * @brief Retrieves the number of subproblems taken from another worker's deque.
+     */
+    [[nodiscard]]
+    long long get_steals() const {
+        return steals;
+    }
+
+    /**
+     * @brief Retrieves the number of checkpoint files written by the last run, including the
+     * final one.
+     */
+    [[nodiscard]]
+    int get_checkpoints_written() const {
+        return checkpoints_written;
+    }
+};
+
+#endif  // PARALLEL_SEARCH_H
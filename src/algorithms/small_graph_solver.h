@@ -0,0 +1,119 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef SMALL_GRAPH_SOLVER_H
+#define SMALL_GRAPH_SOLVER_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "association_graph.h"
+#include "clique_search.h"
+#include "mcis/bitset.h"
+#include "mcis/graph_reorder.h"
+#include "mcis/indexed_graph.h"
+#include "mcis/mcis_options.h"
+#include "mcis/mcis_result.h"
+#include "vertex_order.h"
+
+/**
+ * @class SmallGraphSolver
+ *
+ * Exact MCIS for instances with at most 64 * N node pairs (n1 * n2); the pair of the i-th g1
+ * node and the j-th g2 node in options.ordering has index i * n2 + j and inadmissible pairs
+ * (different labels, or levels too far apart) are left out of the search.
+ * The node orders, the candidate pairs, the association graph and every search set live in
+ * fixed-size arrays on the stack. With the natural ordering and static branching, the only heap
+ * memory is the clique search's current clique and the result, and the word loops of the clique
+ * search are fully unrolled.
+ *
+ * @tparam N Number of 64-bit words per vertex set.
+ */
+template <size_t N>
+class SmallGraphSolver {
+public:
+    static constexpr size_t MAX_PAIRS = 64 * N;
+
+private:
+    /**
+     * @brief Writes the search order of the nodes of a graph with at most MAX_PAIRS nodes. The
+     * natural order is filled in place; the other orderings need GraphReorder's scratch tables.
+     */
+    static void node_order(const IndexedGraph& graph, const IndexedGraph& other,
+                           VertexOrdering ordering, std::array<int, MAX_PAIRS>& order) {
+        if (ordering == VertexOrdering::NATURAL) {
+            std::iota(order.begin(), order.begin() + graph.get_num_nodes(), 0);
+            return;
+        }
+        const std::vector<int> sorted = GraphReorder::node_order(graph, other, ordering);
+        std::copy(sorted.begin(), sorted.end(), order.begin());
+    }
+
+public:
+
+    /**
+     * @brief Solves MCIS on two indexed graphs with n1 * n2 <= MAX_PAIRS.
+     */
+    static MCISResult solve(const IndexedGraph& g1, const IndexedGraph& g2,
+                            const MCISOptions& options = {}) {
+        const int n1 = g1.get_num_nodes();
+        const int n2 = g2.get_num_nodes();
+        const int n = n1 * n2;
+        MCISResult result;
+        if (n == 0) {
+            return result;
+        }
+
+        // Vertex p stands for the (p / n2)-th g1 node and (p % n2)-th g2 node in search order
+        std::array<int, MAX_PAIRS> order1;
+        std::array<int, MAX_PAIRS> order2;
+        node_order(g1, g2, options.ordering, order1);
+        node_order(g2, g1, options.ordering, order2);
+        std::array<std::pair<int, int>, MAX_PAIRS> pairs;
+        for (int p = 0; p < n; ++p) {
+            pairs[p] = {order1[p / n2], order2[p % n2]};
+        }
+
+        std::array<FixedBitset<N>, MAX_PAIRS> adjacency{};
+        FixedBitset<N> all;
+        for (int p = 0; p < n; ++p) {
+            const auto [u1, v1] = pairs[p];
+            if (!AssociationGraph::admissible(g1, g2, u1, v1, options)) {
+                continue;
+            }
+            all.set(p);
+            for (int q = p + 1; q < n; ++q) {
+                const auto [u2, v2] = pairs[q];
+                if (AssociationGraph::admissible(g1, g2, u2, v2, options)
+                    && AssociationGraph::compatible(g1, g2, u1, v1, u2, v2)) {
+                    adjacency[p].set(q);
+                    adjacency[q].set(p);
+                }
+            }
+        }
+
+        MaxCliqueSearch<FixedBitset<N>> search(adjacency.data(), FixedBitset<N>());
+        if (options.branching == BranchingPolicy::SMALLEST_DOMAIN) {
+            search.set_branching(VertexOrder::smallest_domain(
+                std::vector<std::pair<int, int>>(pairs.begin(), pairs.begin() + n), n1, n2,
+                FixedBitset<N>()));
+        }
+        search.run(all);
+
+        search.get_best().for_each([&](size_t p) {
+            result.mapping.emplace_back(g1.get_id(pairs[p].first), g2.get_id(pairs[p].second));
+        });
+        result.nodes_explored = search.get_nodes_explored();
+        return result;
+    }
+};
+
+#endif  // SMALL_GRAPH_SOLVER_H
@@ -0,0 +1,138 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "mcis/structural_hash.h"
+
+#include <algorithm>
+#include <tuple>
+#include <unordered_map>
+
+namespace {
+
+// SplitMix64 finalizer
+uint64_t mix(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+uint64_t label_hash(OpLabel label) { return mix(static_cast<uint64_t>(label)); }
+
+// (operand hash, edge weight, operand class); sorting by hash first keeps the order independent of
+// node indices, so equal expressions get equal operand lists
+using Operand = std::tuple<uint64_t, int, int>;
+
+}  // namespace
+
+StructuralHash::StructuralHash(const IndexedGraph& graph) {
+    const int n = graph.get_num_nodes();
+    classes.resize(n);
+    hashes.resize(n);
+    if (!graph.is_dag()) {
+        for (int v = 0; v < n; ++v) {
+            classes[v] = v;
+            hashes[v] = label_hash(graph.get_label(v));
+        }
+        num_classes = n;
+        return;
+    }
+
+    // Counting sort by level keeps indices ascending within a level
+    const int num_levels = graph.get_num_levels();
+    std::vector<int> level_offsets(num_levels + 1, 0);
+    for (int v = 0; v < n; ++v) {
+        level_offsets[graph.get_level(v) + 1]++;
+    }
+    for (int l = 0; l < num_levels; ++l) {
+        level_offsets[l + 1] += level_offsets[l];
+    }
+    std::vector<int> order(n);
+    std::vector<int> fill(level_offsets.begin(), level_offsets.end() - 1);
+    for (int v = 0; v < n; ++v) {
+        order[fill[graph.get_level(v)]++] = v;
+    }
+
+    std::vector<std::vector<Operand>> operands(n);
+    std::unordered_map<uint64_t, std::vector<int>> buckets;
+    for (int l = 0; l < num_levels; ++l) {
+        const int begin = level_offsets[l];
+        const int end = level_offsets[l + 1];
+
+        // Operands all lie on lower levels, which are final
+#pragma omp parallel for schedule(dynamic, 64) if (end - begin >= STRUCTURAL_HASH_PARALLEL_LEVEL)
+        for (int i = begin; i < end; ++i) {
+            const int v = order[i];
+            std::vector<Operand>& ops = operands[v];
+            for (int parent : graph.get_parents(v)) {
+                const int weight = graph.is_weighted() ? graph.get_edge_weight(parent, v) : 0;
+                ops.emplace_back(hashes[parent], weight, classes[parent]);
+            }
+            std::sort(ops.begin(), ops.end());
+            uint64_t hash = label_hash(graph.get_label(v));
+            for (const auto& [operand, weight, cls] : ops) {
+                const uint64_t weighted = static_cast<uint64_t>(static_cast<int64_t>(weight));
+                hash = mix(hash ^ mix(operand + weighted));
+            }
+            hashes[v] = hash;
+        }
+
+        // Classes of a level never span other levels, since the level is the expression depth
+        for (int i = begin; i < end; ++i) {
+            const int v = order[i];
+            std::vector<int>& bucket = buckets[hashes[v]];
+            classes[v] = v;
+            for (int rep : bucket) {
+                if (graph.get_label(rep) == graph.get_label(v) && operands[rep] == operands[v]) {
+                    classes[v] = rep;
+                    break;
+                }
+            }
+            if (classes[v] == v) {
+                bucket.push_back(v);
+                num_classes++;
+            }
+        }
+    }
+}
+
+std::vector<std::vector<int>> StructuralHash::get_repeated() const {
+    const int n = static_cast<int>(classes.size());
+    std::vector<int> size(n, 0);
+    for (int v = 0; v < n; ++v) {
+        size[classes[v]]++;
+    }
+    std::vector<std::vector<int>> groups;
+    std::vector<int> slot(n, -1);
+    for (int v = 0; v < n; ++v) {
+        const int rep = classes[v];
+        if (size[rep] < 2) {
+            continue;
+        }
+        if (slot[rep] < 0) {
+            slot[rep] = static_cast<int>(groups.size());
+            groups.emplace_back();
+        }
+        groups[slot[rep]].push_back(v);
+    }
+    return groups;
+}
+
+std::vector<std::vector<std::string>> StructuralHash::find_repeated_subdags(const Graph& graph) {
+    IndexedGraph indexed(graph);
+    StructuralHash hash(indexed);
+
+    // Indices follow ID order, so every group is sorted and groups are ordered by smallest ID
+    std::vector<std::vector<std::string>> groups;
+    for (const auto& group : hash.get_repeated()) {
+        std::vector<std::string>& ids = groups.emplace_back();
+        for (int v : group) {
+            ids.push_back(indexed.get_id(v));
+        }
+    }
+    return groups;
+}
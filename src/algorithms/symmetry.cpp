@@ -0,0 +1,270 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "mcis/symmetry.h"
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+
+namespace {
+
+int find_root(std::vector<int>& parent, int v) {
+    while (parent[v] != v) {
+        parent[v] = parent[parent[v]];
+        v = parent[v];
+    }
+    return v;
+}
+
+// Union by smaller index, so every root is the smallest index of its set
+void unite(std::vector<int>& parent, int a, int b) {
+    a = find_root(parent, a);
+    b = find_root(parent, b);
+    if (a < b) {
+        parent[b] = a;
+    } else if (b < a) {
+        parent[a] = b;
+    }
+}
+
+}  // namespace
+
+int AutomorphismGroup::refine(const IndexedGraph& graph, std::vector<int>& colours) {
+    const int n = graph.get_num_nodes();
+    const int total = static_cast<int>(colours.size());
+    if (n == 0 || total == 0) {
+        return 0;
+    }
+
+    std::vector<std::vector<int>> signatures(total);
+    std::vector<int> order(total);
+    int num_colours = -1;
+    while (true) {
+        // Signature: own colour, then the sorted (colour, weight) multisets of children and parents
+#pragma omp parallel for schedule(static) if (total >= 4096)
+        for (int x = 0; x < total; ++x) {
+            const int offset = (x / n) * n;
+            const int v = x % n;
+            std::vector<std::pair<int, int>> neighbors;
+            auto children = graph.get_children(v);
+            auto weights = graph.get_child_weights(v);
+            for (size_t i = 0; i < children.size(); ++i) {
+                neighbors.emplace_back(colours[offset + children[i]], weights[i]);
+            }
+            std::sort(neighbors.begin(), neighbors.end());
+            const size_t out = neighbors.size();
+            for (int parent : graph.get_parents(v)) {
+                const int weight = graph.is_weighted() ? graph.get_edge_weight(parent, v) : 0;
+                neighbors.emplace_back(colours[offset + parent], weight);
+            }
+            std::sort(neighbors.begin() + static_cast<long>(out), neighbors.end());
+
+            std::vector<int>& signature = signatures[x];
+            signature.clear();
+            signature.push_back(colours[x]);
+            signature.push_back(static_cast<int>(out));
+            for (const auto& [colour, weight] : neighbors) {
+                signature.push_back(colour);
+                signature.push_back(weight);
+            }
+        }
+
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(),
+                  [&](int a, int b) { return signatures[a] < signatures[b]; });
+        int rank = 0;
+        for (int i = 0; i < total; ++i) {
+            if (i > 0 && signatures[order[i]] != signatures[order[i - 1]]) {
+                rank++;
+            }
+            colours[order[i]] = rank;
+        }
+
+        // Refinement only splits cells, so an unchanged count means the colouring is stable
+        if (rank + 1 == num_colours) {
+            break;
+        }
+        num_colours = rank + 1;
+    }
+    return num_colours;
+}
+
+bool AutomorphismGroup::extend(const IndexedGraph& graph, std::vector<int>& colours,
+                               std::vector<int>& permutation, long long& budget) {
+    if (budget-- <= 0) {
+        return false;
+    }
+    const int n = graph.get_num_nodes();
+    const int num_colours = refine(graph, colours);
+
+    // Both copies must have the same cell sizes
+    std::vector<int> cell_size(num_colours, 0);
+    for (int x = 0; x < n; ++x) {
+        cell_size[colours[x]]++;
+    }
+    for (int y = n; y < 2 * n; ++y) {
+        if (--cell_size[colours[y]] < 0) {
+            return false;
+        }
+    }
+
+    if (num_colours == n) {
+        std::vector<int> node_of(num_colours);
+        for (int y = 0; y < n; ++y) {
+            node_of[colours[n + y]] = y;
+        }
+        for (int x = 0; x < n; ++x) {
+            permutation[x] = node_of[colours[x]];
+        }
+        for (int u = 0; u < n; ++u) {
+            auto children = graph.get_children(u);
+            auto weights = graph.get_child_weights(u);
+            for (size_t i = 0; i < children.size(); ++i) {
+                const int pu = permutation[u];
+                const int pc = permutation[children[i]];
+                if (!graph.has_edge(pu, pc) || graph.get_edge_weight(pu, pc) != weights[i]) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Individualize the first node of the smallest non-singleton cell of copy A against every
+    // node of the same cell in copy B
+    std::vector<int> first(num_colours, -1);
+    std::vector<int> count(num_colours, 0);
+    for (int x = 0; x < n; ++x) {
+        if (first[colours[x]] < 0) {
+            first[colours[x]] = x;
+        }
+        count[colours[x]]++;
+    }
+    int cell = -1;
+    for (int c = 0; c < num_colours; ++c) {
+        if (count[c] >= 2 && (cell < 0 || count[c] < count[cell])) {
+            cell = c;
+        }
+    }
+    const int x = first[cell];
+    for (int y = n; y < 2 * n && budget > 0; ++y) {
+        if (colours[y] != cell) {
+            continue;
+        }
+        std::vector<int> next = colours;
+        next[x] = num_colours;
+        next[y] = num_colours;
+        if (extend(graph, next, permutation, budget)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+AutomorphismGroup::AutomorphismGroup(const IndexedGraph& graph, const std::vector<int>& fixed,
+                                     long long search_limit, const AutomorphismGroup* supergroup) {
+    const int n = graph.get_num_nodes();
+    std::vector<int> colours(n);
+    for (int v = 0; v < n; ++v) {
+        colours[v] = static_cast<int>(graph.get_label(v));
+    }
+    for (size_t i = 0; i < fixed.size(); ++i) {
+        colours[fixed[i]] = NUM_OP_LABELS + static_cast<int>(i);
+    }
+    const int num_colours = refine(graph, colours);
+    work = 1;
+
+    // Nodes in different orbits of a supergroup never share an orbit of one of its subgroups
+    std::vector<std::vector<int>> cells(supergroup ? 0 : num_colours);
+    std::unordered_map<long long, int> cell_of;
+    for (int v = 0; v < n; ++v) {
+        if (!supergroup) {
+            cells[colours[v]].push_back(v);
+            continue;
+        }
+        const long long key = (static_cast<long long>(colours[v]) << 32) | supergroup->orbit[v];
+        const int cell = cell_of.emplace(key, static_cast<int>(cell_of.size())).first->second;
+        if (cell == static_cast<int>(cells.size())) {
+            cells.emplace_back();
+        }
+        cells[cell].push_back(v);
+    }
+
+    std::vector<int> parent(n);
+    std::iota(parent.begin(), parent.end(), 0);
+    std::vector<int> permutation(n);
+    for (const auto& cell : cells) {
+        // Representatives of the orbits found so far in this cell
+        std::vector<int> representatives;
+        for (int v : cell) {
+            bool merged = false;
+            for (int r : representatives) {
+                if (find_root(parent, r) == find_root(parent, v)) {
+                    merged = true;
+                    break;
+                }
+            }
+            for (size_t i = 0; i < representatives.size() && !merged; ++i) {
+                const int r = representatives[i];
+                std::vector<int> joint(colours);
+                joint.insert(joint.end(), colours.begin(), colours.end());
+                joint[r] = num_colours;
+                joint[n + v] = num_colours;
+                long long budget = search_limit;
+                const bool found = extend(graph, joint, permutation, budget);
+                work += search_limit - std::max(budget, 0LL);
+                if (found) {
+                    generators.push_back(permutation);
+                    for (int x = 0; x < n; ++x) {
+                        unite(parent, x, permutation[x]);
+                    }
+                    merged = true;
+                } else if (budget <= 0) {
+                    complete = false;
+                }
+            }
+            if (!merged) {
+                representatives.push_back(v);
+            }
+        }
+    }
+
+    orbit.resize(n);
+    for (int v = 0; v < n; ++v) {
+        orbit[v] = find_root(parent, v);
+        num_orbits += orbit[v] == v ? 1 : 0;
+    }
+}
+
+bool AutomorphismGroup::fixes(int v) const {
+    for (const auto& generator : generators) {
+        if (generator[v] != v) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::vector<std::string>> AutomorphismGroup::find_orbits(const Graph& graph) {
+    IndexedGraph indexed(graph);
+    AutomorphismGroup group(indexed);
+
+    // Indices follow ID order, so grouping by representative keeps every orbit sorted
+    std::vector<std::vector<std::string>> orbits;
+    std::vector<int> slot(indexed.get_num_nodes(), -1);
+    for (int v = 0; v < indexed.get_num_nodes(); ++v) {
+        const int rep = group.get_orbit(v);
+        if (slot[rep] < 0) {
+            slot[rep] = static_cast<int>(orbits.size());
+            orbits.emplace_back();
+        }
+        orbits[slot[rep]].push_back(indexed.get_id(v));
+    }
+    return orbits;
+}
@@ -0,0 +1,245 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "tree_mcis.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "assignment.h"
+#include "association_graph.h"
+#include "component_mcis.h"
+
+TreeMCIS::Forest::Forest(const IndexedGraph& graph) : graph(graph) {
+    const int n = graph.get_num_nodes();
+    arc_offsets.assign(n + 1, 0);
+    for (int v = 0; v < n; ++v) {
+        arc_offsets[v + 1] = arc_offsets[v] + graph.get_out_degree(v) + graph.get_in_degree(v);
+    }
+    const int num_arcs = arc_offsets[n];
+    arc_heads.resize(num_arcs);
+    arc_forward.resize(num_arcs);
+    arc_weights.resize(num_arcs);
+    reverse_arc.resize(num_arcs);
+
+    for (int v = 0; v < n; ++v) {
+        int a = arc_offsets[v];
+        auto children = graph.get_children(v);
+        auto weights = graph.get_child_weights(v);
+        for (size_t i = 0; i < children.size(); ++i, ++a) {
+            arc_heads[a] = children[i];
+            arc_forward[a] = 1;
+            arc_weights[a] = weights[i];
+        }
+        for (int parent : graph.get_parents(v)) {
+            arc_heads[a] = parent;
+            arc_forward[a] = 0;
+            arc_weights[a] = graph.is_weighted() ? graph.get_edge_weight(parent, v) : 0;
+            ++a;
+        }
+    }
+    // A forest has no parallel edges, so each arc has exactly one arc back
+    for (int v = 0; v < n; ++v) {
+        for (int a = arc_offsets[v]; a < arc_offsets[v + 1]; ++a) {
+            const int w = arc_heads[a];
+            for (int b = arc_offsets[w]; b < arc_offsets[w + 1]; ++b) {
+                if (arc_heads[b] == v) {
+                    reverse_arc[a] = b;
+                    break;
+                }
+            }
+        }
+    }
+
+    component.assign(n, -1);
+    std::vector<int> stack;
+    for (int root = 0; root < n; ++root) {
+        if (component[root] >= 0) {
+            continue;
+        }
+        component[root] = num_components;
+        stack.push_back(root);
+        while (!stack.empty()) {
+            const int v = stack.back();
+            stack.pop_back();
+            for (int a = arc_offsets[v]; a < arc_offsets[v + 1]; ++a) {
+                if (component[arc_heads[a]] < 0) {
+                    component[arc_heads[a]] = num_components;
+                    stack.push_back(arc_heads[a]);
+                }
+            }
+        }
+        num_components++;
+    }
+}
+
+bool TreeMCIS::arcs_match(int arc1, int arc2) const {
+    if (f1->arc_forward[arc1] != f2->arc_forward[arc2]) {
+        return false;
+    }
+    if (compare_weights && f1->arc_weights[arc1] != f2->arc_weights[arc2]) {
+        return false;
+    }
+    return AssociationGraph::admissible(f1->graph, f2->graph, f1->arc_heads[arc1],
+                                        f2->arc_heads[arc2], options);
+}
+
+int TreeMCIS::match_children(int u, int skip1, int v, int skip2,
+                             std::vector<std::pair<int, int>>* matched) {
+    std::vector<int> rows;
+    std::vector<int> cols;
+    for (int a = f1->arc_offsets[u]; a < f1->arc_offsets[u + 1]; ++a) {
+        if (a != skip1) {
+            rows.push_back(a);
+        }
+    }
+    for (int b = f2->arc_offsets[v]; b < f2->arc_offsets[v + 1]; ++b) {
+        if (b != skip2) {
+            cols.push_back(b);
+        }
+    }
+    if (rows.empty() || cols.empty()) {
+        return 0;
+    }
+
+    std::vector<std::vector<long long>> weights(rows.size(), std::vector<long long>(cols.size()));
+    bool any = false;
+    for (size_t i = 0; i < rows.size(); ++i) {
+        for (size_t j = 0; j < cols.size(); ++j) {
+            weights[i][j] = arcs_match(rows[i], cols[j]) ? below(rows[i], cols[j]) : 0;
+            any = any || weights[i][j] > 0;
+        }
+    }
+    if (!any) {
+        return 0;
+    }
+
+    // Matched subtrees lie in different branches of u and v, which are never adjacent in a forest,
+    // so any set of matched branches forms an induced common subtree
+    std::vector<int> assignment = HungarianAssignment::solve(weights);
+    int total = 0;
+    for (size_t i = 0; i < rows.size(); ++i) {
+        if (assignment[i] >= 0 && weights[i][assignment[i]] > 0) {
+            total += static_cast<int>(weights[i][assignment[i]]);
+            if (matched != nullptr) {
+                matched->emplace_back(rows[i], cols[assignment[i]]);
+            }
+        }
+    }
+    return total;
+}
+
+int TreeMCIS::below(int arc1, int arc2) {
+    const size_t key = static_cast<size_t>(arc1) * f2->get_num_arcs() + arc2;
+    if (memo[key] < 0) {
+        states++;
+        memo[key] = 1
+                    + match_children(f1->arc_heads[arc1], f1->reverse_arc[arc1],
+                                     f2->arc_heads[arc2], f2->reverse_arc[arc2], nullptr);
+    }
+    return memo[key];
+}
+
+void TreeMCIS::collect(int u, int skip1, int v, int skip2, NodeMapping& mapping) {
+    mapping.emplace_back(f1->graph.get_id(u), f2->graph.get_id(v));
+    std::vector<std::pair<int, int>> matched;
+    match_children(u, skip1, v, skip2, &matched);
+    for (const auto& [a, b] : matched) {
+        collect(f1->arc_heads[a], f1->reverse_arc[a], f2->arc_heads[b], f2->reverse_arc[b],
+                mapping);
+    }
+}
+
+MCISResult TreeMCIS::solve(const Graph& g1, const Graph& g2, bool connected) {
+    IndexedGraph i1(g1);
+    IndexedGraph i2(g2);
+    Forest forest1(i1);
+    Forest forest2(i2);
+    f1 = &forest1;
+    f2 = &forest2;
+    compare_weights = i1.is_weighted() || i2.is_weighted();
+    memo.assign(static_cast<size_t>(forest1.get_num_arcs()) * forest2.get_num_arcs(), -1);
+    states = 0;
+
+    // Best subtree root pair of every pair of components
+    const int c1 = forest1.num_components;
+    const int c2 = forest2.num_components;
+    std::vector<int> best_size(static_cast<size_t>(c1) * c2, 0);
+    std::vector<std::pair<int, int>> best_root(best_size.size(), {-1, -1});
+    for (int u = 0; u < i1.get_num_nodes(); ++u) {
+        for (int v = 0; v < i2.get_num_nodes(); ++v) {
+            if (!AssociationGraph::admissible(i1, i2, u, v, options)) {
+                continue;
+            }
+            const size_t cell = static_cast<size_t>(forest1.component[u]) * c2
+                                + forest2.component[v];
+            const int size = 1 + match_children(u, -1, v, -1, nullptr);
+            if (size > best_size[cell]) {
+                best_size[cell] = size;
+                best_root[cell] = {u, v};
+            }
+        }
+    }
+
+    std::vector<std::pair<int, int>> roots;
+    if (connected) {
+        auto best = std::max_element(best_size.begin(), best_size.end());
+        if (best != best_size.end() && *best > 0) {
+            roots.push_back(best_root[best - best_size.begin()]);
+        }
+    } else if (c1 > 0 && c2 > 0) {
+        std::vector<std::vector<long long>> weights(c1, std::vector<long long>(c2));
+        for (int a = 0; a < c1; ++a) {
+            for (int b = 0; b < c2; ++b) {
+                weights[a][b] = best_size[static_cast<size_t>(a) * c2 + b];
+            }
+        }
+        std::vector<int> assignment = HungarianAssignment::solve(weights);
+        for (int a = 0; a < c1; ++a) {
+            if (assignment[a] >= 0 && weights[a][assignment[a]] > 0) {
+                roots.push_back(best_root[static_cast<size_t>(a) * c2 + assignment[a]]);
+            }
+        }
+    }
+
+    MCISResult result;
+    for (const auto& [u, v] : roots) {
+        collect(u, -1, v, -1, result.mapping);
+    }
+    result.nodes_explored = states;
+    f1 = nullptr;
+    f2 = nullptr;
+    memo.clear();
+    return result;
+}
+
+bool TreeMCIS::applies(const Graph& g1, const Graph& g2) {
+    // A forest has fewer edges than nodes, hence fewer than 2n arcs
+    const long long arcs1 = 2LL * g1.get_num_nodes();
+    const long long arcs2 = 2LL * g2.get_num_nodes();
+    return arcs1 * arcs2 <= TREE_DP_MAX_STATES && g1.is_forest() && g2.is_forest();
+}
+
+MCISResult TreeMCIS::find_mapping(const Graph& g1, const Graph& g2) {
+    if (!applies(g1, g2)) {
+        return ComponentMCIS::solve_pair(g1, g2, options);
+    }
+    MCISResult result = solve(g1, g2, false);
+    result.optimal = result.size() == std::min(g1.get_num_nodes(), g2.get_num_nodes());
+    return result;
+}
+
+MCISResult TreeMCIS::find_connected(const Graph& g1, const Graph& g2) {
+    if (!applies(g1, g2)) {
+        MCISResult result;
+        result.optimal = false;
+        return result;
+    }
+    MCISResult result = solve(g1, g2, true);
+    result.optimal = true;
+    return result;
+}
@@ -0,0 +1,140 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef TREE_MCIS_H
+#define TREE_MCIS_H
+
+#include <utility>
+#include <vector>
+
+#include "mcis/graph.h"
+#include "mcis/indexed_graph.h"
+#include "mcis_finder.h"
+
+/**
+ * @brief Largest number of (g1 arc, g2 arc) DP states the tree solver allocates; larger forests
+ * are left to the general solvers.
+ */
+constexpr long long TREE_DP_MAX_STATES = 1LL << 24;
+
+/**
+ * @class TreeMCIS
+ *
+ * Polynomial solver for forests (graphs whose underlying undirected graph is acyclic). The
+ * maximum common connected induced subtree of two trees is found by dynamic programming over
+ * pairs of arcs: the best subtree hanging below arc (a -> b) in g1 matched to arc (x -> y) in g2
+ * is 1 plus a maximum-weight bipartite matching between the other neighbors of b and of y, where
+ * matched edges must agree on direction and weight and matched nodes on labels (and levels in
+ * level-constrained mode). Each pair of roots closes the DP with one more matching.
+ *
+ * find_mapping combines the best subtree of every pair of components with a maximum-weight
+ * assignment. Since a common induced subgraph may also be disconnected inside one component,
+ * that combination is a lower bound; it is reported as optimal only when it covers the smaller
+ * graph. find_connected returns the exact maximum common connected induced subgraph. Inputs that
+ * are not forests, or too large for the DP table, are handed to the general pair solver by
+ * find_mapping and yield an empty, non-optimal result from find_connected.
+ */
+class TreeMCIS : public MCISFinder {
+private:
+    /**
+     * @brief Undirected view of a forest. The arcs leaving node v are arc_offsets[v] to
+     * arc_offsets[v + 1] - 1; arc a leads to arc_heads[a] along an edge pointing away from v if
+     * arc_forward[a], with weight arc_weights[a], and reverse_arc[a] is the arc back.
+     */
+    struct Forest {
+        const IndexedGraph& graph;
+        std::vector<int> arc_offsets;
+        std::vector<int> arc_heads;
+        std::vector<char> arc_forward;
+        std::vector<int> arc_weights;
+        std::vector<int> reverse_arc;
+        std::vector<int> component;
+        int num_components = 0;
+
+        explicit Forest(const IndexedGraph& graph);
+
+        [[nodiscard]]
+        int get_num_arcs() const {
+            return static_cast<int>(arc_heads.size());
+        }
+    };
+
+    /**
+     * @brief Forests of the instance being solved.
+     */
+    const Forest* f1 = nullptr;
+    const Forest* f2 = nullptr;
+
+    /**
+     * @brief Indicates if edge weights must agree, i.e. either input graph is weighted.
+     */
+    bool compare_weights = false;
+
+    /**
+     * @brief Size of the best common subtree on the head side of each (g1 arc, g2 arc) pair, or
+     * -1 if not computed yet.
+     */
+    std::vector<int> memo;
+
+    /**
+     * @brief Number of DP states computed.
+     */
+    long long states = 0;
+
+    /**
+     * @brief Checks if two arcs can be matched: same direction, same weight and admissible heads.
+     */
+    [[nodiscard]]
+    bool arcs_match(int arc1, int arc2) const;
+
+    /**
+     * @brief Matches the arcs leaving u to the arcs leaving v, except skip1 and skip2 (-1 for
+     * none), maximizing the total size of the subtrees below them.
+     * @param matched If non-null, receives the matched (g1 arc, g2 arc) pairs.
+     * @return The total size of the matched subtrees.
+     */
+    int match_children(int u, int skip1, int v, int skip2,
+                       std::vector<std::pair<int, int>>* matched);
+
+    /**
+     * @brief Size of the best common subtree below two matching arcs.
+     */
+    int below(int arc1, int arc2);
+
+    /**
+     * @brief Appends the node pairs of the best common subtree containing (u, v) and avoiding the
+     * arcs skip1 and skip2.
+     */
+    void collect(int u, int skip1, int v, int skip2, NodeMapping& mapping);
+
+    /**
+     * @brief Runs the DP on two forests.
+     * @param connected If true, only the best common subtree overall is returned; otherwise the
+     * best subtrees of all component pairs are combined by a maximum-weight assignment.
+     */
+    MCISResult solve(const Graph& g1, const Graph& g2, bool connected);
+
+public:
+    /**
+     * @brief Checks whether a pair of graphs fits the tree solver: both are forests and the DP
+     * table stays within TREE_DP_MAX_STATES.
+     */
+    static bool applies(const Graph& g1, const Graph& g2);
+
+    MCISResult find_mapping(const Graph& g1, const Graph& g2) override;
+
+    /**
+     * @brief Finds the maximum common connected induced subgraph of two forests exactly.
+     * @param g1 First forest.
+     * @param g2 Second forest.
+     * @return The mapping of the largest common subtree, or an empty non-optimal result if the
+     * inputs do not fit the tree solver.
+     */
+    MCISResult find_connected(const Graph& g1, const Graph& g2);
+};
+
+#endif  // TREE_MCIS_H
@@ -0,0 +1,67 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef VERTEX_ORDER_H
+#define VERTEX_ORDER_H
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * @class VertexOrder
+ *
+ * Search-order strategies shared by the exact finders. Static orderings number the nodes of each
+ * graph before the candidate pairs are built (GraphReorder::node_order); the smallest-domain
+ * policy is a branching callback for MaxCliqueSearch that is re-evaluated at every search node.
+ */
+class VertexOrder {
+public:
+    /**
+     * @brief Builds the smallest-domain-first branching policy: among the branch set, take the
+     * pair whose g1 node has the fewest partners left among the candidates, then the one whose g2
+     * node has, then the lowest-numbered one.
+     * @tparam Set Vertex set type of the clique search.
+     * @param pairs (g1 node, g2 node) of every search vertex.
+     * @param n1 Number of g1 nodes.
+     * @param n2 Number of g2 nodes.
+     * @param empty An empty set sized for the vertex count.
+     * @return Callback for MaxCliqueSearch::set_branching.
+     */
+    template <typename Set>
+    static std::function<long(const Set&, const Set&)> smallest_domain(
+        const std::vector<std::pair<int, int>>& pairs, int n1, int n2, const Set& empty) {
+        std::vector<Set> by_u(n1, empty);
+        std::vector<Set> by_v(n2, empty);
+        for (size_t p = 0; p < pairs.size(); ++p) {
+            by_u[pairs[p].first].set(p);
+            by_v[pairs[p].second].set(p);
+        }
+        return [pairs, by_u = std::move(by_u), by_v = std::move(by_v)](const Set& branch,
+                                                                       const Set& candidates) {
+            long best = -1;
+            size_t best_u = 0;
+            size_t best_v = 0;
+            branch.for_each([&](size_t p) {
+                const size_t domain_u = candidates.and_count(by_u[pairs[p].first]);
+                if (best >= 0 && domain_u > best_u) {
+                    return;
+                }
+                const size_t domain_v = candidates.and_count(by_v[pairs[p].second]);
+                if (best < 0 || domain_u < best_u || domain_v < best_v) {
+                    best = static_cast<long>(p);
+                    best_u = domain_u;
+                    best_v = domain_v;
+                }
+            });
+            return best;
+        };
+    }
+};
+
+#endif  // VERTEX_ORDER_H
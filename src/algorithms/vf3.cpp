@@ -0,0 +1,446 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "mcis/vf3.h"
+
+#include <algorithm>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+/**
+ * @brief Looks up the edge u->v in an indexed graph.
+ * @return The position of v in u's child list, or -1 if the edge does not exist.
+ */
+int find_edge(const IndexedGraph& graph, int u, int v) {
+    auto children = graph.get_children(u);
+    auto it = std::lower_bound(children.begin(), children.end(), v);
+    if (it == children.end() || *it != v) {
+        return -1;
+    }
+    return static_cast<int>(it - children.begin());
+}
+
+}  // namespace
+
+VF3Matcher::VF3Matcher(const Graph& pattern, const Graph& target)
+    : owned_pattern(std::in_place, pattern), owned_target(std::in_place, target) {
+    this->pattern = &*owned_pattern;
+    this->target = &*owned_target;
+    compare_weights = this->pattern->is_weighted() || this->target->is_weighted();
+    compute_order();
+}
+
+VF3Matcher::VF3Matcher(const IndexedGraph& pattern, const IndexedGraph& target)
+    : pattern(&pattern),
+      target(&target),
+      compare_weights(pattern.is_weighted() || target.is_weighted()) {
+    compute_order();
+}
+
+void VF3Matcher::compute_order() {
+    const int n_p = pattern->get_num_nodes();
+    const int n_t = target->get_num_nodes();
+
+    // Probability that a random target node can host u, estimated from the label and in/out degree
+    // distributions of the target (rarer nodes are explored first).
+    int max_degree = 0;
+    for (int v = 0; v < n_t; ++v) {
+        max_degree = std::max({max_degree, target->get_in_degree(v), target->get_out_degree(v)});
+    }
+    std::vector<int> at_least_in(max_degree + 2, 0);
+    std::vector<int> at_least_out(max_degree + 2, 0);
+    for (int v = 0; v < n_t; ++v) {
+        at_least_in[target->get_in_degree(v)]++;
+        at_least_out[target->get_out_degree(v)]++;
+    }
+    for (int k = max_degree; k >= 0; --k) {
+        at_least_in[k] += at_least_in[k + 1];
+        at_least_out[k] += at_least_out[k + 1];
+    }
+    std::vector<int> label_count(NUM_OP_LABELS, 0);
+    for (int v = 0; v < n_t; ++v) {
+        label_count[static_cast<int>(target->get_label(v))]++;
+    }
+    auto probability = [&](int u) {
+        int in = pattern->get_in_degree(u);
+        int out = pattern->get_out_degree(u);
+        if (n_t == 0 || in > max_degree || out > max_degree) {
+            return 0.0;
+        }
+        return (static_cast<double>(label_count[static_cast<int>(pattern->get_label(u))]) / n_t)
+               * (static_cast<double>(at_least_in[in]) / n_t)
+               * (static_cast<double>(at_least_out[out]) / n_t);
+    };
+
+    // Static rank: least probable first, then highest degree
+    std::vector<int> by_rank(n_p);
+    std::vector<double> prob(n_p);
+    for (int u = 0; u < n_p; ++u) {
+        by_rank[u] = u;
+        prob[u] = probability(u);
+    }
+    auto degree = [&](int u) { return pattern->get_in_degree(u) + pattern->get_out_degree(u); };
+    std::sort(by_rank.begin(), by_rank.end(), [&](int a, int b) {
+        return std::make_tuple(prob[a], -degree(a), a) < std::make_tuple(prob[b], -degree(b), b);
+    });
+    std::vector<int> rank(n_p);
+    for (int r = 0; r < n_p; ++r) {
+        rank[by_rank[r]] = r;
+    }
+
+    // Greatest-constraint-first: repeatedly take the node with the most edges into the ordered
+    // prefix, breaking ties by static rank. Stale queue entries are skipped lazily.
+    order.clear();
+    order.reserve(n_p);
+    position.assign(n_p, -1);
+    std::vector<int> connections(n_p, 0);
+    std::priority_queue<std::pair<int, int>> queue;  // (connections, -rank)
+    int next_unranked = 0;
+
+    auto visit_neighbor = [&](int w) {
+        if (position[w] < 0) {
+            connections[w]++;
+            queue.emplace(connections[w], -rank[w]);
+        }
+    };
+
+    while (static_cast<int>(order.size()) < n_p) {
+        int u = -1;
+        while (!queue.empty()) {
+            auto [conn, neg_rank] = queue.top();
+            queue.pop();
+            int w = by_rank[-neg_rank];
+            if (position[w] < 0 && connections[w] == conn) {
+                u = w;
+                break;
+            }
+        }
+        if (u < 0) {
+            while (position[by_rank[next_unranked]] >= 0) {
+                ++next_unranked;
+            }
+            u = by_rank[next_unranked];
+        }
+        position[u] = static_cast<int>(order.size());
+        order.push_back(u);
+        for (int w : pattern->get_children(u)) {
+            visit_neighbor(w);
+        }
+        for (int w : pattern->get_parents(u)) {
+            visit_neighbor(w);
+        }
+    }
+
+    // Candidate anchors and terminal-set entry depths
+    anchor.assign(n_p, -1);
+    anchor_is_parent.assign(n_p, false);
+    first_neighbor_position.assign(n_p, n_p);
+    for (int u = 0; u < n_p; ++u) {
+        const int d = position[u];
+        int best = n_p;
+        for (int w : pattern->get_parents(u)) {
+            first_neighbor_position[u] = std::min(first_neighbor_position[u], position[w]);
+            if (position[w] < d && position[w] < best) {
+                best = position[w];
+                anchor[d] = w;
+                anchor_is_parent[d] = true;
+            }
+        }
+        for (int w : pattern->get_children(u)) {
+            first_neighbor_position[u] = std::min(first_neighbor_position[u], position[w]);
+            if (position[w] < d && position[w] < best) {
+                best = position[w];
+                anchor[d] = w;
+                anchor_is_parent[d] = false;
+            }
+        }
+    }
+}
+
+template <typename Visitor>
+void VF3Matcher::search(Visitor&& visit) {
+    const int n_p = pattern->get_num_nodes();
+    const int n_t = target->get_num_nodes();
+    states_explored = 0;
+    limit_hit = false;
+
+    if (n_p > n_t || pattern->get_num_edges() > target->get_num_edges()) {
+        return;
+    }
+    std::vector<int> core_p(n_p, -1);
+    if (n_p == 0) {
+        visit(core_p);
+        return;
+    }
+
+    // Per-depth pattern counts: edges into the mapped prefix and look-ahead terminal/new counts
+    struct DepthCounts {
+        int mapped_out = 0, mapped_in = 0;
+        int term_out = 0, term_in = 0;
+        int new_out = 0, new_in = 0;
+    };
+    std::vector<DepthCounts> counts(n_p);
+    for (int d = 0; d < n_p; ++d) {
+        const int u = order[d];
+        DepthCounts& c = counts[d];
+        for (int w : pattern->get_children(u)) {
+            if (position[w] < d) {
+                c.mapped_out++;
+            } else if (first_neighbor_position[w] < d) {
+                c.term_out++;
+            } else {
+                c.new_out++;
+            }
+        }
+        for (int w : pattern->get_parents(u)) {
+            if (position[w] < d) {
+                c.mapped_in++;
+            } else if (first_neighbor_position[w] < d) {
+                c.term_in++;
+            } else {
+                c.new_in++;
+            }
+        }
+    }
+
+    std::vector<int> core_t(n_t, -1);
+    std::vector<int> t_term(n_t, 0);
+
+    auto feasible = [&](int u, int t, int d) {
+        if (core_t[t] >= 0 || target->get_label(t) != pattern->get_label(u)
+            || target->get_out_degree(t) < pattern->get_out_degree(u)
+            || target->get_in_degree(t) < pattern->get_in_degree(u)) {
+            return false;
+        }
+        const DepthCounts& c = counts[d];
+
+        // Every pattern edge into the mapped prefix must exist in the target
+        auto p_children = pattern->get_children(u);
+        auto p_weights = pattern->get_child_weights(u);
+        for (size_t i = 0; i < p_children.size(); ++i) {
+            const int w = p_children[i];
+            if (position[w] >= d) {
+                continue;
+            }
+            const int e = find_edge(*target, t, core_p[w]);
+            if (e < 0 || (compare_weights && target->get_child_weights(t)[e] != p_weights[i])) {
+                return false;
+            }
+        }
+        for (int w : pattern->get_parents(u)) {
+            if (position[w] >= d) {
+                continue;
+            }
+            const int e = find_edge(*target, core_p[w], t);
+            if (e < 0
+                || (compare_weights
+                    && target->get_child_weights(core_p[w])[e]
+                           != pattern->get_edge_weight(w, u))) {
+                return false;
+            }
+        }
+
+        // ...and the target must have no extra edges into the mapped prefix (inducedness), plus
+        // enough terminal and unexplored neighbors to host u's remaining neighbors.
+        int mapped_out = 0, term_out = 0, new_out = 0;
+        for (int x : target->get_children(t)) {
+            if (core_t[x] >= 0) {
+                mapped_out++;
+            } else if (t_term[x] > 0) {
+                term_out++;
+            } else {
+                new_out++;
+            }
+        }
+        if (mapped_out != c.mapped_out || term_out < c.term_out || new_out < c.new_out) {
+            return false;
+        }
+        int mapped_in = 0, term_in = 0, new_in = 0;
+        for (int x : target->get_parents(t)) {
+            if (core_t[x] >= 0) {
+                mapped_in++;
+            } else if (t_term[x] > 0) {
+                term_in++;
+            } else {
+                new_in++;
+            }
+        }
+        return mapped_in == c.mapped_in && term_in >= c.term_in && new_in >= c.new_in;
+    };
+
+    auto apply = [&](int u, int t, int delta) {
+        if (delta > 0) {
+            core_p[u] = t;
+            core_t[t] = u;
+        } else {
+            core_p[u] = -1;
+            core_t[t] = -1;
+        }
+        for (int x : target->get_children(t)) {
+            t_term[x] += delta;
+        }
+        for (int x : target->get_parents(t)) {
+            t_term[x] += delta;
+        }
+    };
+
+    std::vector<int> cursor(n_p, 0);
+    int d = 0;
+    while (true) {
+        const int u = order[d];
+        std::span<const int> candidates;
+        if (anchor[d] >= 0) {
+            const int mapped_anchor = core_p[anchor[d]];
+            candidates = anchor_is_parent[d] ? target->get_children(mapped_anchor)
+                                             : target->get_parents(mapped_anchor);
+        }
+        const int num_candidates
+            = anchor[d] >= 0 ? static_cast<int>(candidates.size()) : n_t;
+
+        bool advanced = false;
+        while (cursor[d] < num_candidates) {
+            const int t = anchor[d] >= 0 ? candidates[cursor[d]] : cursor[d];
+            cursor[d]++;
+            if (feasible(u, t, d)) {
+                if (state_limit >= 0 && states_explored >= state_limit) {
+                    limit_hit = true;
+                    return;
+                }
+                states_explored++;
+                apply(u, t, 1);
+                advanced = true;
+                break;
+            }
+        }
+
+        if (advanced) {
+            if (d + 1 == n_p) {
+                bool keep_going = visit(core_p);
+                apply(u, core_p[u], -1);
+                if (!keep_going) {
+                    return;
+                }
+            } else {
+                cursor[++d] = 0;
+            }
+        } else {
+            if (d == 0) {
+                return;
+            }
+            --d;
+            apply(order[d], core_p[order[d]], -1);
+        }
+    }
+}
+
+bool VF3Matcher::find_first(std::vector<int>& mapping) {
+    bool found = false;
+    search([&](const std::vector<int>& core) {
+        mapping = core;
+        found = true;
+        return false;
+    });
+    return found;
+}
+
+std::optional<NodeMapping> VF3Matcher::find() {
+    std::vector<int> mapping;
+    if (!find_first(mapping)) {
+        return std::nullopt;
+    }
+    NodeMapping result;
+    result.reserve(mapping.size());
+    for (size_t u = 0; u < mapping.size(); ++u) {
+        result.emplace_back(pattern->get_id(static_cast<int>(u)), target->get_id(mapping[u]));
+    }
+    return result;
+}
+
+std::vector<std::vector<int>> VF3Matcher::find_all(size_t limit) {
+    std::vector<std::vector<int>> results;
+    search([&](const std::vector<int>& core) {
+        results.push_back(core);
+        return limit == 0 || results.size() < limit;
+    });
+    return results;
+}
+
+bool VF3Matcher::is_induced_subgraph(const Graph& pattern, const Graph& target,
+                                     long long state_limit) {
+    if (pattern.get_num_nodes() > target.get_num_nodes()) {
+        return false;
+    }
+    VF3Matcher matcher(pattern, target);
+    matcher.set_state_limit(state_limit);
+    std::vector<int> mapping;
+    return matcher.find_first(mapping);
+}
+
+bool VF3Matcher::is_isomorphic(const Graph& g1, const Graph& g2) {
+    if (g1.get_num_nodes() != g2.get_num_nodes()) {
+        return false;
+    }
+    IndexedGraph i1(g1);
+    IndexedGraph i2(g2);
+    if (i1.get_num_edges() != i2.get_num_edges()) {
+        return false;
+    }
+    VF3Matcher matcher(i1, i2);
+    std::vector<int> mapping;
+    return matcher.find_first(mapping);
+}
+
+bool VF3Matcher::verify_mapping(const Graph& g1, const Graph& g2, const NodeMapping& mapping) {
+    std::unordered_map<const Node*, const Node*> forward;
+    std::unordered_set<const Node*> image;
+    forward.reserve(mapping.size());
+    image.reserve(mapping.size());
+    for (const auto& [id1, id2] : mapping) {
+        const Node* a = g1.get_node(id1);
+        const Node* b = g2.get_node(id2);
+        if (!a || !b || a->get_label() != b->get_label() || !forward.emplace(a, b).second
+            || !image.insert(b).second) {
+            return false;
+        }
+    }
+
+    // Each mapped g1 edge must exist in g2 with the same weight, and each mapped node must have
+    // the same number of edges into the mapped set on both sides; together this covers every edge
+    // between mapped nodes in both directions.
+    for (const auto& [a, b] : forward) {
+        int mapped_children = 0;
+        for (const auto& [child, weight] : a->get_children()) {
+            auto it = forward.find(child);
+            if (it == forward.end()) {
+                continue;
+            }
+            mapped_children++;
+            const auto& b_children = b->get_children();
+            auto edge = b_children.find(const_cast<Node*>(it->second));
+            if (edge == b_children.end() || edge->second != weight) {
+                return false;
+            }
+        }
+        int image_children = 0;
+        for (const auto& [child, _] : b->get_children()) {
+            image_children += image.count(child) ? 1 : 0;
+        }
+        if (mapped_children != image_children) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool VF3Matcher::is_common_induced_subgraph(const Graph& common, const Graph& g1,
+                                            const Graph& g2) {
+    return is_induced_subgraph(common, g1) && is_induced_subgraph(common, g2);
+}
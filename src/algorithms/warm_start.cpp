@@ -0,0 +1,224 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include "warm_start.h"
+
+#include <algorithm>
+#include <span>
+#include <string>
+
+#include "association_graph.h"
+
+namespace {
+
+/**
+ * @brief Marks the existing endpoints of a graph's edits, or every node if the edits are unknown.
+ */
+std::vector<char> touched_nodes(const IndexedGraph& graph, const std::vector<GraphEdit>* edits) {
+    std::vector<char> touched(graph.get_num_nodes(), edits ? 0 : 1);
+    if (edits) {
+        for (const GraphEdit& edit : *edits) {
+            for (const std::string* id : {&edit.from, &edit.to}) {
+                const int v = id->empty() ? -1 : graph.get_index(*id);
+                if (v >= 0) {
+                    touched[v] = 1;
+                }
+            }
+        }
+    }
+    return touched;
+}
+
+/**
+ * @brief Greedily covers a graph's edits by existing nodes: a node edit by its node, an edge edit
+ * by its source unless an endpoint is already covered. Edits involving removed nodes need no
+ * cover, as the relations of the remaining nodes are unchanged by them.
+ */
+int cover_size(const IndexedGraph& graph, const std::vector<GraphEdit>& edits) {
+    std::vector<char> covered(graph.get_num_nodes(), 0);
+    int size = 0;
+    for (const GraphEdit& edit : edits) {
+        const int from = graph.get_index(edit.from);
+        const int to = edit.to.empty() ? from : graph.get_index(edit.to);
+        if (from < 0 || to < 0 || covered[from] || covered[to]) {
+            continue;
+        }
+        covered[from] = 1;
+        size++;
+    }
+    return size;
+}
+
+}  // namespace
+
+NodeMapping WarmStart::repair_mapping(const IndexedGraph& g1, const IndexedGraph& g2,
+                                      const NodeMapping& mapping,
+                                      const std::vector<GraphEdit>* edits1,
+                                      const std::vector<GraphEdit>* edits2,
+                                      const MCISOptions& options) {
+    const int n1 = g1.get_num_nodes();
+    const int n2 = g2.get_num_nodes();
+
+    // Pair slot of every matched node, -1 if unmatched
+    std::vector<int> slot1(n1, -1);
+    std::vector<int> slot2(n2, -1);
+    std::vector<std::pair<int, int>> pairs;
+    pairs.reserve(mapping.size());
+    for (const auto& [id1, id2] : mapping) {
+        const int u = g1.get_index(id1);
+        const int v = g2.get_index(id2);
+        if (u < 0 || v < 0 || slot1[u] >= 0 || slot2[v] >= 0
+            || !AssociationGraph::admissible(g1, g2, u, v, options)) {
+            continue;
+        }
+        slot1[u] = slot2[v] = static_cast<int>(pairs.size());
+        pairs.emplace_back(u, v);
+    }
+
+    // Only the matched neighbors of u and v can disagree with the pair (u, v)
+    std::vector<int> partners;
+    auto collect_partners = [&](int u, int v) {
+        partners.clear();
+        for (std::span<const int> row : {g1.get_children(u), g1.get_parents(u)}) {
+            for (int w : row) {
+                if (slot1[w] >= 0) {
+                    partners.push_back(slot1[w]);
+                }
+            }
+        }
+        for (std::span<const int> row : {g2.get_children(v), g2.get_parents(v)}) {
+            for (int w : row) {
+                if (slot2[w] >= 0) {
+                    partners.push_back(slot2[w]);
+                }
+            }
+        }
+        std::sort(partners.begin(), partners.end());
+        partners.erase(std::unique(partners.begin(), partners.end()), partners.end());
+    };
+
+    const std::vector<char> touched1 = touched_nodes(g1, edits1);
+    const std::vector<char> touched2 = touched_nodes(g2, edits2);
+    const int k = static_cast<int>(pairs.size());
+    std::vector<char> suspect(k, 0);
+    for (int p = 0; p < k; ++p) {
+        suspect[p] = touched1[pairs[p].first] || touched2[pairs[p].second];
+    }
+
+    // Conflicts between two suspect pairs are found from both sides; keep one copy
+    std::vector<std::vector<int>> conflicts(k);
+    for (int p = 0; p < k; ++p) {
+        if (!suspect[p]) {
+            continue;
+        }
+        const auto [u, v] = pairs[p];
+        collect_partners(u, v);
+        for (int q : partners) {
+            if ((suspect[q] && q < p) || q == p) {
+                continue;
+            }
+            const auto [w, x] = pairs[q];
+            if (!AssociationGraph::compatible(g1, g2, u, v, w, x)) {
+                conflicts[p].push_back(q);
+                conflicts[q].push_back(p);
+            }
+        }
+    }
+
+    // Greedily drop the pair with the most remaining conflicts, preferring edited pairs on ties
+    std::vector<int> remaining(k);
+    for (int p = 0; p < k; ++p) {
+        remaining[p] = static_cast<int>(conflicts[p].size());
+    }
+    std::vector<char> dropped(k, 0);
+    std::vector<int> freed1;
+    std::vector<int> freed2;
+    while (true) {
+        int worst = -1;
+        for (int p = 0; p < k; ++p) {
+            if (dropped[p] || remaining[p] == 0) {
+                continue;
+            }
+            if (worst < 0 || remaining[p] > remaining[worst]
+                || (remaining[p] == remaining[worst] && suspect[p] && !suspect[worst])) {
+                worst = p;
+            }
+        }
+        if (worst < 0) {
+            break;
+        }
+        dropped[worst] = 1;
+        for (int q : conflicts[worst]) {
+            remaining[q] -= dropped[q] ? 0 : 1;
+        }
+        const auto [u, v] = pairs[worst];
+        slot1[u] = slot2[v] = -1;
+        freed1.push_back(u);
+        freed2.push_back(v);
+    }
+
+    NodeMapping repaired;
+    repaired.reserve(mapping.size() + freed1.size());
+    for (int p = 0; p < k; ++p) {
+        if (!dropped[p]) {
+            repaired.emplace_back(g1.get_id(pairs[p].first), g2.get_id(pairs[p].second));
+        }
+    }
+
+    // Touched and freed nodes may fit somewhere new (e.g. added nodes next to the mapping)
+    auto fits = [&](int u, int v) {
+        if (!AssociationGraph::admissible(g1, g2, u, v, options)) {
+            return false;
+        }
+        collect_partners(u, v);
+        for (int q : partners) {
+            if (!AssociationGraph::compatible(g1, g2, u, v, pairs[q].first, pairs[q].second)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    auto match = [&](int u, int v) {
+        slot1[u] = slot2[v] = static_cast<int>(pairs.size());
+        pairs.emplace_back(u, v);
+        repaired.emplace_back(g1.get_id(u), g2.get_id(v));
+    };
+    for (int u = 0; u < n1; ++u) {
+        if (edits1 && touched1[u]) {
+            freed1.push_back(u);
+        }
+    }
+    for (int v = 0; v < n2; ++v) {
+        if (edits2 && touched2[v]) {
+            freed2.push_back(v);
+        }
+    }
+    for (int u : freed1) {
+        for (int v = 0; v < n2 && slot1[u] < 0; ++v) {
+            if (slot2[v] < 0 && fits(u, v)) {
+                match(u, v);
+            }
+        }
+    }
+    for (int v : freed2) {
+        for (int u = 0; u < n1 && slot2[v] < 0; ++u) {
+            if (slot1[u] < 0 && fits(u, v)) {
+                match(u, v);
+            }
+        }
+    }
+    return repaired;
+}
+
+int WarmStart::edit_bound(const IndexedGraph& g1, const IndexedGraph& g2, int previous_size,
+                          const std::vector<GraphEdit>& edits1,
+                          const std::vector<GraphEdit>& edits2, const MCISOptions& options) {
+    if (options.level_constrained) {
+        return -1;
+    }
+    return previous_size + cover_size(g1, edits1) + cover_size(g2, edits2);
+}
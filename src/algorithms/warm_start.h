@@ -0,0 +1,64 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#ifndef WARM_START_H
+#define WARM_START_H
+
+#include <vector>
+
+#include "mcis/graph.h"
+#include "mcis/indexed_graph.h"
+#include "mcis/mcis_options.h"
+#include "mcis/mcis_result.h"
+
+/**
+ * @class WarmStart
+ * @brief Carries a mapping over to edited versions of its two graphs, so a search after small
+ * edits starts from the previous result instead of from scratch.
+ */
+class WarmStart {
+public:
+    /**
+     * @brief Repairs a mapping computed on earlier versions of two graphs into a common induced
+     * subgraph of their current versions. Pairs whose nodes were removed or are no longer
+     * admissible (labels, levels) are dropped. Only pairs with a node touched by an edit can have
+     * become inconsistent with the rest of the mapping; each is checked against the matched
+     * neighbors of its two nodes, and the pair with the most conflicts is dropped until none
+     * remain. Touched and freed nodes are then greedily matched again where they fit.
+     * @param g1 Current version of the first graph.
+     * @param g2 Current version of the second graph.
+     * @param mapping Mapping computed on the earlier versions.
+     * @param edits1 Edits of g1 since the mapping was computed (see Graph::get_edits_since), or
+     * null if they are unknown; every pair is then re-checked.
+     * @param edits2 Edits of g2, likewise.
+     * @param options Options of the search the mapping is meant for.
+     * @return A valid mapping between the current graphs.
+     */
+    static NodeMapping repair_mapping(const IndexedGraph& g1, const IndexedGraph& g2,
+                                      const NodeMapping& mapping,
+                                      const std::vector<GraphEdit>* edits1,
+                                      const std::vector<GraphEdit>* edits2,
+                                      const MCISOptions& options);
+
+    /**
+     * @brief Bounds the MCIS size after edits, given the maximum size before them. Every edit
+     * only changes the relations of one existing node (an edge edit is covered by either
+     * endpoint), so dropping the pairs of a cover of the edits from a common subgraph of the
+     * current graphs leaves a common subgraph of the earlier ones; the bound is the earlier size
+     * plus the sizes of greedy covers on both sides. Level-constrained searches get no bound, as
+     * an edit can shift the levels of untouched nodes.
+     * @param previous_size Maximum common subgraph size before the edits.
+     * @param edits1 Edits of g1 since then.
+     * @param edits2 Edits of g2 since then.
+     * @return The bound, or -1 if there is none.
+     */
+    static int edit_bound(const IndexedGraph& g1, const IndexedGraph& g2, int previous_size,
+                          const std::vector<GraphEdit>& edits1,
+                          const std::vector<GraphEdit>& edits2, const MCISOptions& options);
+};
+
+#endif  // WARM_START_H
@@ -0,0 +1,523 @@
+#include <mcis/bitset.h>
+
+#include <algorithm>
+#include <bit>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MCIS_BITSET_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// ---------------------------------------------------------------------------------------------
+// Scalar kernels
+// ---------------------------------------------------------------------------------------------
+
+size_t count_scalar(const uint64_t* a, size_t n) {
+    size_t total = 0;
+    for (size_t i = 0; i < n; ++i) {
+        total += std::popcount(a[i]);
+    }
+    return total;
+}
+
+size_t and_count_scalar(const uint64_t* a, const uint64_t* b, size_t n) {
+    size_t total = 0;
+    for (size_t i = 0; i < n; ++i) {
+        total += std::popcount(a[i] & b[i]);
+    }
+    return total;
+}
+
+size_t andnot_count_scalar(const uint64_t* a, const uint64_t* b, size_t n) {
+    size_t total = 0;
+    for (size_t i = 0; i < n; ++i) {
+        total += std::popcount(a[i] & ~b[i]);
+    }
+    return total;
+}
+
+void and_into_scalar(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = a[i] & b[i];
+    }
+}
+
+void andnot_into_scalar(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = a[i] & ~b[i];
+    }
+}
+
+void or_into_scalar(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = a[i] | b[i];
+    }
+}
+
+size_t and_into_count_scalar(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t n) {
+    size_t total = 0;
+    for (size_t i = 0; i < n; ++i) {
+        dst[i] = a[i] & b[i];
+        total += std::popcount(dst[i]);
+    }
+    return total;
+}
+
+bool intersects_scalar(const uint64_t* a, const uint64_t* b, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        if (a[i] & b[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+long find_first_scalar(const uint64_t* a, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        if (a[i]) {
+            return static_cast<long>(i * 64 + std::countr_zero(a[i]));
+        }
+    }
+    return -1;
+}
+
+long find_first_and_scalar(const uint64_t* a, const uint64_t* b, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t word = a[i] & b[i];
+        if (word) {
+            return static_cast<long>(i * 64 + std::countr_zero(word));
+        }
+    }
+    return -1;
+}
+
+#ifdef MCIS_BITSET_X86
+
+// ---------------------------------------------------------------------------------------------
+// AVX2 kernels: 4 words per step, popcount via the nibble lookup (vpshufb) + vpsadbw method
+// ---------------------------------------------------------------------------------------------
+
+__attribute__((target("avx2"))) inline __m256i popcount_avx2(__m256i v) {
+    const __m256i lookup
+        = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3,
+                           1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    const __m256i lo = _mm256_and_si256(v, low_mask);
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+    const __m256i counts
+        = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+    return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+}
+
+__attribute__((target("avx2"))) inline size_t horizontal_sum_avx2(__m256i v) {
+    return static_cast<size_t>(_mm256_extract_epi64(v, 0) + _mm256_extract_epi64(v, 1)
+                               + _mm256_extract_epi64(v, 2) + _mm256_extract_epi64(v, 3));
+}
+
+__attribute__((target("avx2"))) size_t count_avx2(const uint64_t* a, size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        acc = _mm256_add_epi64(acc, popcount_avx2(va));
+    }
+    return horizontal_sum_avx2(acc) + count_scalar(a + i, n - i);
+}
+
+__attribute__((target("avx2"))) size_t and_count_avx2(const uint64_t* a, const uint64_t* b,
+                                                      size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        acc = _mm256_add_epi64(acc, popcount_avx2(_mm256_and_si256(va, vb)));
+    }
+    return horizontal_sum_avx2(acc) + and_count_scalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2"))) size_t andnot_count_avx2(const uint64_t* a, const uint64_t* b,
+                                                         size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        acc = _mm256_add_epi64(acc, popcount_avx2(_mm256_andnot_si256(vb, va)));
+    }
+    return horizontal_sum_avx2(acc) + andnot_count_scalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2"))) void and_into_avx2(uint64_t* dst, const uint64_t* a,
+                                                   const uint64_t* b, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_and_si256(va, vb));
+    }
+    and_into_scalar(dst + i, a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2"))) void andnot_into_avx2(uint64_t* dst, const uint64_t* a,
+                                                      const uint64_t* b, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_andnot_si256(vb, va));
+    }
+    andnot_into_scalar(dst + i, a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2"))) void or_into_avx2(uint64_t* dst, const uint64_t* a,
+                                                  const uint64_t* b, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_or_si256(va, vb));
+    }
+    or_into_scalar(dst + i, a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2"))) size_t and_into_count_avx2(uint64_t* dst, const uint64_t* a,
+                                                           const uint64_t* b, size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i vand = _mm256_and_si256(va, vb);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), vand);
+        acc = _mm256_add_epi64(acc, popcount_avx2(vand));
+    }
+    return horizontal_sum_avx2(acc) + and_into_count_scalar(dst + i, a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2"))) bool intersects_avx2(const uint64_t* a, const uint64_t* b,
+                                                     size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        if (!_mm256_testz_si256(va, vb)) {
+            return true;
+        }
+    }
+    return intersects_scalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2"))) long find_first_avx2(const uint64_t* a, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        if (!_mm256_testz_si256(va, va)) {
+            break;
+        }
+    }
+    const long rest = find_first_scalar(a + i, n - i);
+    return rest < 0 ? -1 : static_cast<long>(i * 64) + rest;
+}
+
+__attribute__((target("avx2"))) long find_first_and_avx2(const uint64_t* a, const uint64_t* b,
+                                                         size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        if (!_mm256_testz_si256(va, vb)) {
+            break;
+        }
+    }
+    const long rest = find_first_and_scalar(a + i, b + i, n - i);
+    return rest < 0 ? -1 : static_cast<long>(i * 64) + rest;
+}
+
+// ---------------------------------------------------------------------------------------------
+// AVX-512 kernels (F + VPOPCNTDQ): 8 words per step, native 64-bit lane popcount, masked tails
+// ---------------------------------------------------------------------------------------------
+
+#define MCIS_AVX512 __attribute__((target("avx512f,avx512vpopcntdq")))
+
+MCIS_AVX512 size_t count_avx512(const uint64_t* a, size_t n) {
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(_mm512_loadu_si512(a + i)));
+    }
+    if (i < n) {
+        const __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1);
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(_mm512_maskz_loadu_epi64(mask, a + i)));
+    }
+    return static_cast<size_t>(_mm512_reduce_add_epi64(acc));
+}
+
+MCIS_AVX512 size_t and_count_avx512(const uint64_t* a, const uint64_t* b, size_t n) {
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i v = _mm512_and_si512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i));
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+    }
+    if (i < n) {
+        const __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1);
+        const __m512i v = _mm512_and_si512(_mm512_maskz_loadu_epi64(mask, a + i),
+                                           _mm512_maskz_loadu_epi64(mask, b + i));
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+    }
+    return static_cast<size_t>(_mm512_reduce_add_epi64(acc));
+}
+
+MCIS_AVX512 size_t andnot_count_avx512(const uint64_t* a, const uint64_t* b, size_t n) {
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i v
+            = _mm512_andnot_si512(_mm512_loadu_si512(b + i), _mm512_loadu_si512(a + i));
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+    }
+    if (i < n) {
+        const __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1);
+        const __m512i v = _mm512_andnot_si512(_mm512_maskz_loadu_epi64(mask, b + i),
+                                              _mm512_maskz_loadu_epi64(mask, a + i));
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+    }
+    return static_cast<size_t>(_mm512_reduce_add_epi64(acc));
+}
+
+MCIS_AVX512 void and_into_avx512(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_si512(dst + i,
+                            _mm512_and_si512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+    }
+    and_into_scalar(dst + i, a + i, b + i, n - i);
+}
+
+MCIS_AVX512 void andnot_into_avx512(uint64_t* dst, const uint64_t* a, const uint64_t* b,
+                                    size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_si512(
+            dst + i, _mm512_andnot_si512(_mm512_loadu_si512(b + i), _mm512_loadu_si512(a + i)));
+    }
+    andnot_into_scalar(dst + i, a + i, b + i, n - i);
+}
+
+MCIS_AVX512 void or_into_avx512(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_si512(dst + i,
+                            _mm512_or_si512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i)));
+    }
+    or_into_scalar(dst + i, a + i, b + i, n - i);
+}
+
+MCIS_AVX512 size_t and_into_count_avx512(uint64_t* dst, const uint64_t* a, const uint64_t* b,
+                                         size_t n) {
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i v = _mm512_and_si512(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i));
+        _mm512_storeu_si512(dst + i, v);
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(v));
+    }
+    return static_cast<size_t>(_mm512_reduce_add_epi64(acc))
+           + and_into_count_scalar(dst + i, a + i, b + i, n - i);
+}
+
+MCIS_AVX512 bool intersects_avx512(const uint64_t* a, const uint64_t* b, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        if (_mm512_test_epi64_mask(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i))) {
+            return true;
+        }
+    }
+    return intersects_scalar(a + i, b + i, n - i);
+}
+
+MCIS_AVX512 long find_first_avx512(const uint64_t* a, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512i v = _mm512_loadu_si512(a + i);
+        if (_mm512_test_epi64_mask(v, v)) {
+            break;
+        }
+    }
+    const long rest = find_first_scalar(a + i, n - i);
+    return rest < 0 ? -1 : static_cast<long>(i * 64) + rest;
+}
+
+MCIS_AVX512 long find_first_and_avx512(const uint64_t* a, const uint64_t* b, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        if (_mm512_test_epi64_mask(_mm512_loadu_si512(a + i), _mm512_loadu_si512(b + i))) {
+            break;
+        }
+    }
+    const long rest = find_first_and_scalar(a + i, b + i, n - i);
+    return rest < 0 ? -1 : static_cast<long>(i * 64) + rest;
+}
+
+#undef MCIS_AVX512
+
+#endif  // MCIS_BITSET_X86
+
+/**
+ * @brief Function table for one SIMD level.
+ */
+struct KernelTable {
+    SimdLevel level;
+    size_t (*count)(const uint64_t*, size_t);
+    size_t (*and_count)(const uint64_t*, const uint64_t*, size_t);
+    size_t (*andnot_count)(const uint64_t*, const uint64_t*, size_t);
+    void (*and_into)(uint64_t*, const uint64_t*, const uint64_t*, size_t);
+    void (*andnot_into)(uint64_t*, const uint64_t*, const uint64_t*, size_t);
+    void (*or_into)(uint64_t*, const uint64_t*, const uint64_t*, size_t);
+    size_t (*and_into_count)(uint64_t*, const uint64_t*, const uint64_t*, size_t);
+    bool (*intersects)(const uint64_t*, const uint64_t*, size_t);
+    long (*find_first)(const uint64_t*, size_t);
+    long (*find_first_and)(const uint64_t*, const uint64_t*, size_t);
+};
+
+constexpr KernelTable SCALAR_KERNELS = {
+    SimdLevel::SCALAR,  count_scalar,      and_count_scalar,      andnot_count_scalar,
+    and_into_scalar,    andnot_into_scalar, or_into_scalar,       and_into_count_scalar,
+    intersects_scalar,  find_first_scalar, find_first_and_scalar,
+};
+
+#ifdef MCIS_BITSET_X86
+constexpr KernelTable AVX2_KERNELS = {
+    SimdLevel::AVX2, count_avx2,       and_count_avx2,      andnot_count_avx2,
+    and_into_avx2,   andnot_into_avx2, or_into_avx2,        and_into_count_avx2,
+    intersects_avx2, find_first_avx2,  find_first_and_avx2,
+};
+
+constexpr KernelTable AVX512_KERNELS = {
+    SimdLevel::AVX512, count_avx512,       and_count_avx512,      andnot_count_avx512,
+    and_into_avx512,   andnot_into_avx512, or_into_avx512,        and_into_count_avx512,
+    intersects_avx512, find_first_avx512,  find_first_and_avx512,
+};
+#endif
+
+const KernelTable* table_for(SimdLevel level) {
+#ifdef MCIS_BITSET_X86
+    switch (level) {
+        case SimdLevel::AVX512:
+            return &AVX512_KERNELS;
+        case SimdLevel::AVX2:
+            return &AVX2_KERNELS;
+        default:
+            break;
+    }
+#endif
+    (void)level;
+    return &SCALAR_KERNELS;
+}
+
+/**
+ * @brief Active kernel table, resolved from CPUID on first use.
+ */
+const KernelTable*& active_table() {
+    static const KernelTable* table = table_for(BitsetKernels::detect_simd_level());
+    return table;
+}
+
+}  // namespace
+
+SimdLevel BitsetKernels::detect_simd_level() {
+#ifdef MCIS_BITSET_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vpopcntdq")) {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+#endif
+    return SimdLevel::SCALAR;
+}
+
+SimdLevel BitsetKernels::get_simd_level() { return active_table()->level; }
+
+SimdLevel BitsetKernels::set_simd_level(SimdLevel level) {
+    const SimdLevel supported = detect_simd_level();
+    const bool available = static_cast<int>(level) <= static_cast<int>(supported);
+    active_table() = table_for(available ? level : supported);
+    return active_table()->level;
+}
+
+size_t BitsetKernels::count(const uint64_t* a, size_t n) {
+    return active_table()->count(a, n);
+}
+
+size_t BitsetKernels::and_count(const uint64_t* a, const uint64_t* b, size_t n) {
+    return active_table()->and_count(a, b, n);
+}
+
+size_t BitsetKernels::andnot_count(const uint64_t* a, const uint64_t* b, size_t n) {
+    return active_table()->andnot_count(a, b, n);
+}
+
+void BitsetKernels::and_into(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t n) {
+    active_table()->and_into(dst, a, b, n);
+}
+
+void BitsetKernels::andnot_into(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t n) {
+    active_table()->andnot_into(dst, a, b, n);
+}
+
+void BitsetKernels::or_into(uint64_t* dst, const uint64_t* a, const uint64_t* b, size_t n) {
+    active_table()->or_into(dst, a, b, n);
+}
+
+size_t BitsetKernels::and_into_count(uint64_t* dst, const uint64_t* a, const uint64_t* b,
+                                     size_t n) {
+    return active_table()->and_into_count(dst, a, b, n);
+}
+
+bool BitsetKernels::intersects(const uint64_t* a, const uint64_t* b, size_t n) {
+    return active_table()->intersects(a, b, n);
+}
+
+long BitsetKernels::find_first(const uint64_t* a, size_t n) {
+    return active_table()->find_first(a, n);
+}
+
+long BitsetKernels::find_first_and(const uint64_t* a, const uint64_t* b, size_t n) {
+    return active_table()->find_first_and(a, b, n);
+}
+
+void Bitset::set_all() {
+    std::fill(words.begin(), words.end(), ~uint64_t{0});
+    if (num_bits % 64 != 0) {
+        words.back() = (uint64_t{1} << (num_bits % 64)) - 1;
+    }
+}
+
+void Bitset::clear() { std::fill(words.begin(), words.end(), 0); }
+
+bool Bitset::any() const { return BitsetKernels::find_first(words.data(), words.size()) >= 0; }
+
+long Bitset::find_next(size_t i) const {
+    size_t start = i + 1;
+    if (start >= num_bits) {
+        return -1;
+    }
+    size_t w = start >> 6;
+    const uint64_t first = words[w] & (~uint64_t{0} << (start & 63));
+    if (first) {
+        return static_cast<long>(w * 64 + std::countr_zero(first));
+    }
+    ++w;
+    const long rest = BitsetKernels::find_first(words.data() + w, words.size() - w);
+    return rest < 0 ? -1 : static_cast<long>(w * 64) + rest;
+}
+
+size_t Bitset::assign_and_count(const Bitset& a, const Bitset& b) {
+    return BitsetKernels::and_into_count(words.data(), a.words.data(), b.words.data(),
+                                         words.size());
+}
@@ -0,0 +1,191 @@
+#include <mcis/graph.h>
+
+#include <algorithm>
+
+Graph::BatchEdit::BatchEdit(Graph& graph) : graph(graph) {}
+
+Graph::BatchEdit::~BatchEdit() { commit(); }
+
+void Graph::BatchEdit::reserve(size_t num_nodes, size_t num_edges) {
+    ids.reserve(ids.size() + num_nodes);
+    handle_nodes.reserve(handle_nodes.size() + num_nodes);
+    new_labels.reserve(new_labels.size() + num_nodes);
+    is_new.reserve(is_new.size() + num_nodes);
+    handles.reserve(handles.size() + num_nodes);
+    edge_operations.reserve(edge_operations.size() + num_edges);
+}
+
+int Graph::BatchEdit::add_node(const std::string& id, OpLabel label) {
+    if (graph.nodes.find(id) != graph.nodes.end()) {
+        return -1;
+    }
+    const int handle = static_cast<int>(ids.size());
+    if (!handles.emplace(id, handle).second) {
+        return -1;
+    }
+    ids.push_back(id);
+    handle_nodes.push_back(nullptr);
+    new_labels.push_back(label);
+    is_new.push_back(true);
+    return handle;
+}
+
+int Graph::BatchEdit::node(const std::string& id) {
+    auto it = handles.find(id);
+    if (it != handles.end()) {
+        return it->second;
+    }
+    auto existing = graph.nodes.find(id);
+    if (existing == graph.nodes.end()) {
+        return -1;
+    }
+    const int handle = static_cast<int>(ids.size());
+    handles.emplace(id, handle);
+    ids.push_back(id);
+    handle_nodes.push_back(existing->second);
+    new_labels.push_back(OpLabel::NONE);
+    is_new.push_back(false);
+    return handle;
+}
+
+bool Graph::BatchEdit::add_edge(int from, int to, int weight) {
+    if (!valid(from) || !valid(to) || from == to) {
+        return false;
+    }
+    edge_operations.push_back({from, to, weight, false});
+    return true;
+}
+
+bool Graph::BatchEdit::add_edge(const std::string& from_id, const std::string& to_id, int weight) {
+    return add_edge(node(from_id), node(to_id), weight);
+}
+
+bool Graph::BatchEdit::remove_edge(int from, int to) {
+    if (!valid(from) || !valid(to)) {
+        return false;
+    }
+    edge_operations.push_back({from, to, 0, true});
+    return true;
+}
+
+bool Graph::BatchEdit::remove_node(int handle) {
+    if (!valid(handle)) {
+        return false;
+    }
+    removed_nodes.push_back(handle);
+    return true;
+}
+
+int Graph::BatchEdit::commit() {
+    int changes = 0;
+    bool reweighted = false;
+
+    // Bulk loads (generators, reads) are not worth logging edge by edge
+    const bool logged =
+        ids.size() + edge_operations.size() + removed_nodes.size() <= GRAPH_EDIT_LOG_LIMIT;
+    auto record = [&](GraphEditKind kind, int from, int to) {
+        if (logged) {
+            graph.record_edit(kind, ids[from], to < 0 ? std::string() : ids[to]);
+        }
+    };
+
+    size_t num_new = 0;
+    for (bool created : is_new) {
+        num_new += created ? 1 : 0;
+    }
+    graph.nodes.reserve(graph.nodes.size() + num_new);
+    for (size_t h = 0; h < ids.size(); ++h) {
+        if (is_new[h]) {
+            handle_nodes[h] = new Node(ids[h], new_labels[h]);
+            graph.nodes.emplace(ids[h], handle_nodes[h]);
+            record(GraphEditKind::ADD_NODE, static_cast<int>(h), -1);
+            changes++;
+        }
+    }
+
+    // Stable, so the operations on each edge stay in the order they were queued
+    std::stable_sort(edge_operations.begin(), edge_operations.end(),
+                     [](const EdgeOperation& a, const EdgeOperation& b) {
+                         return a.from != b.from ? a.from < b.from : a.to < b.to;
+                     });
+    size_t source_end = 0;
+    for (size_t begin = 0; begin < edge_operations.size();) {
+        const int from = edge_operations[begin].from;
+        const int to = edge_operations[begin].to;
+        Node* source = handle_nodes[from];
+        Node* target = handle_nodes[to];
+        if (begin >= source_end) {
+            size_t additions = 0;
+            for (source_end = begin;
+                 source_end < edge_operations.size() && edge_operations[source_end].from == from;
+                 ++source_end) {
+                additions += edge_operations[source_end].remove ? 0 : 1;
+            }
+            source->reserve_children(source->get_children().size() + additions);
+        }
+        size_t end = begin;
+        while (end < edge_operations.size() && edge_operations[end].from == from
+               && edge_operations[end].to == to) {
+            ++end;
+        }
+
+        // Net effect: after the last removal (or from the start), the first addition wins
+        size_t first_add = end;
+        bool removed = false;
+        for (size_t i = begin; i < end; ++i) {
+            if (edge_operations[i].remove) {
+                removed = true;
+                first_add = end;
+            } else if (first_add == end) {
+                first_add = i;
+            }
+        }
+        const bool existed = source->contains_edge(target);
+        if (first_add == end) {
+            if (removed && source->remove_edge(target)) {
+                record(GraphEditKind::REMOVE_EDGE, from, to);
+                changes++;
+            }
+        } else if (!existed) {
+            const int weight = edge_operations[first_add].weight;
+            source->add_edge(target, weight);
+            graph.is_weighted = graph.is_weighted || (weight != 0);
+            record(GraphEditKind::ADD_EDGE, from, to);
+            changes++;
+        } else if (removed
+                   && source->get_children().at(target) != edge_operations[first_add].weight) {
+            const int weight = edge_operations[first_add].weight;
+            source->change_edge_weight(target, weight);
+            graph.is_weighted = graph.is_weighted || (weight != 0);
+            record(GraphEditKind::CHANGE_WEIGHT, from, to);
+            reweighted = true;
+        }
+        begin = end;
+    }
+
+    std::unordered_set<Node*> removal_set;
+    for (int handle : removed_nodes) {
+        if (removal_set.insert(handle_nodes[handle]).second) {
+            record(GraphEditKind::REMOVE_NODE, handle, -1);
+        }
+    }
+    if (!removal_set.empty()) {
+        graph.erase_nodes(removal_set);
+        changes += static_cast<int>(removal_set.size());
+    }
+
+    if (changes > 0 || reweighted) {
+        graph.invalidate_caches();
+        if (!logged) {
+            graph.reset_edit_log();
+        }
+    }
+    ids.clear();
+    handle_nodes.clear();
+    new_labels.clear();
+    is_new.clear();
+    handles.clear();
+    edge_operations.clear();
+    removed_nodes.clear();
+    return changes;
+}
@@ -0,0 +1,208 @@
+#include <mcis/compressed_graph.h>
+#include <mcis/indexed_graph.h>
+
+#include <algorithm>
+#include <string_view>
+
+namespace {
+
+void write_varint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+uint64_t zigzag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+}  // namespace
+
+CompressedGraph::CompressedGraph(const Graph& graph) {
+    const IndexedGraph indexed(graph);
+    num_nodes = indexed.get_num_nodes();
+    num_edges = indexed.get_num_edges();
+    for (int v = 0; v < num_nodes && !weighted; ++v) {
+        for (int weight : indexed.get_child_weights(v)) {
+            weighted = weighted || weight != 0;
+        }
+    }
+
+    labels.reserve(num_nodes);
+    adjacency.reserve(static_cast<size_t>(num_edges) * 2 + num_nodes);
+    const int num_blocks = (num_nodes + COMPRESSED_BLOCK_NODES - 1) / COMPRESSED_BLOCK_NODES;
+    adjacency_blocks.reserve(num_blocks);
+    id_blocks.reserve(num_blocks);
+
+    int64_t anchor = 0;
+    for (int v = 0; v < num_nodes; ++v) {
+        labels.push_back(indexed.get_label(v));
+        const std::string& id = indexed.get_id(v);
+        if (v % COMPRESSED_BLOCK_NODES == 0) {
+            adjacency_blocks.push_back(adjacency.size());
+            id_blocks.push_back(id_bytes.size());
+            anchor = v;
+            write_varint(id_bytes, id.size());
+            id_bytes.insert(id_bytes.end(), id.begin(), id.end());
+        } else {
+            const std::string& previous = indexed.get_id(v - 1);
+            const size_t limit = std::min(previous.size(), id.size());
+            size_t prefix = 0;
+            while (prefix < limit && previous[prefix] == id[prefix]) {
+                ++prefix;
+            }
+            write_varint(id_bytes, prefix);
+            write_varint(id_bytes, id.size() - prefix);
+            id_bytes.insert(id_bytes.end(), id.begin() + static_cast<long>(prefix), id.end());
+        }
+
+        const std::span<const int> children = indexed.get_children(v);
+        const std::span<const int> weights = indexed.get_child_weights(v);
+        write_varint(adjacency, children.size());
+        for (size_t i = 0; i < children.size(); ++i) {
+            if (i == 0) {
+                write_varint(adjacency, zigzag(children[0] - anchor));
+                anchor = children[0];
+            } else {
+                write_varint(adjacency, static_cast<uint64_t>(children[i] - children[i - 1] - 1));
+            }
+            if (weighted) {
+                write_varint(adjacency, zigzag(weights[i]));
+            }
+        }
+    }
+    adjacency.shrink_to_fit();
+    id_bytes.shrink_to_fit();
+}
+
+const uint8_t* CompressedGraph::seek(int v, int64_t& anchor) const {
+    const int block = v / COMPRESSED_BLOCK_NODES;
+    const uint8_t* p = adjacency.data() + adjacency_blocks[block];
+    anchor = static_cast<int64_t>(block) * COMPRESSED_BLOCK_NODES;
+    for (int u = block * COMPRESSED_BLOCK_NODES; u < v; ++u) {
+        decode(p, anchor, [](int, int) {});
+    }
+    return p;
+}
+
+std::string CompressedGraph::get_id(int v) const {
+    const int block = v / COMPRESSED_BLOCK_NODES;
+    const uint8_t* p = id_bytes.data() + id_blocks[block];
+    const size_t length = read_varint(p);
+    std::string id(reinterpret_cast<const char*>(p), length);
+    p += length;
+    for (int u = block * COMPRESSED_BLOCK_NODES + 1; u <= v; ++u) {
+        const size_t prefix = read_varint(p);
+        const size_t suffix = read_varint(p);
+        id.resize(prefix);
+        id.append(reinterpret_cast<const char*>(p), suffix);
+        p += suffix;
+    }
+    return id;
+}
+
+int CompressedGraph::get_index(const std::string& id) const {
+    // Last block whose first ID is not greater than id
+    int low = 0;
+    int high = static_cast<int>(id_blocks.size()) - 1;
+    int block = -1;
+    while (low <= high) {
+        const int mid = low + (high - low) / 2;
+        const uint8_t* p = id_bytes.data() + id_blocks[mid];
+        const size_t length = read_varint(p);
+        const std::string_view first(reinterpret_cast<const char*>(p), length);
+        if (first <= id) {
+            block = mid;
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    if (block < 0) {
+        return -1;
+    }
+
+    const int end = std::min(num_nodes, (block + 1) * COMPRESSED_BLOCK_NODES);
+    const uint8_t* p = id_bytes.data() + id_blocks[block];
+    const size_t length = read_varint(p);
+    std::string current(reinterpret_cast<const char*>(p), length);
+    p += length;
+    for (int u = block * COMPRESSED_BLOCK_NODES;; ++u) {
+        if (current == id) {
+            return u;
+        }
+        if (current > id || u + 1 == end) {
+            return -1;
+        }
+        const size_t prefix = read_varint(p);
+        const size_t suffix = read_varint(p);
+        current.resize(prefix);
+        current.append(reinterpret_cast<const char*>(p), suffix);
+        p += suffix;
+    }
+}
+
+int CompressedGraph::get_out_degree(int v) const {
+    int64_t anchor = 0;
+    const uint8_t* p = seek(v, anchor);
+    return static_cast<int>(read_varint(p));
+}
+
+std::vector<int> CompressedGraph::get_in_degrees() const {
+    std::vector<int> in_degrees(num_nodes, 0);
+    for_each_edge([&](int, int child, int) { ++in_degrees[child]; });
+    return in_degrees;
+}
+
+bool CompressedGraph::compute_levels(std::vector<int>& levels) const {
+    std::vector<int> in_degrees = get_in_degrees();
+    levels.assign(num_nodes, 0);
+    std::vector<int> queue;
+    queue.reserve(num_nodes);
+    for (int v = 0; v < num_nodes; ++v) {
+        if (in_degrees[v] == 0) {
+            queue.push_back(v);
+        }
+    }
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const int v = queue[head];
+        for_each_child(v, [&](int child, int) {
+            levels[child] = std::max(levels[child], levels[v] + 1);
+            if (--in_degrees[child] == 0) {
+                queue.push_back(child);
+            }
+        });
+    }
+    if (static_cast<int>(queue.size()) != num_nodes) {
+        levels.clear();
+        return false;
+    }
+    return true;
+}
+
+Graph CompressedGraph::to_graph() const {
+    Graph graph;
+    {
+        // Committed when the batch goes out of scope
+        Graph::BatchEdit batch(graph);
+        batch.reserve(num_nodes, num_edges);
+        const uint8_t* p = id_bytes.data();
+        std::string id;
+        for (int v = 0; v < num_nodes; ++v) {
+            if (v % COMPRESSED_BLOCK_NODES == 0) {
+                id.clear();
+            } else {
+                id.resize(read_varint(p));
+            }
+            const size_t suffix = read_varint(p);
+            id.append(reinterpret_cast<const char*>(p), suffix);
+            p += suffix;
+            batch.add_node(id, labels[v]);
+        }
+        // Handles follow the order of add_node, which is the node order
+        for_each_edge([&](int from, int to, int weight) { batch.add_edge(from, to, weight); });
+    }
+    return graph;
+}
@@ -1 +1,55 @@
 #include <mcis/graph.h>
+
+Graph Graph::create_dwt_graph(int n, int levels) {
+    Graph graph;
+    if (n <= 0 || levels <= 0 || levels >= 31 || n % (1 << levels) != 0) {
+        return graph;
+    }
+
+    // Reserve space: inputs, four filter taps, and per output pair four products and two sums,
+    // with three edges per product
+    BatchEdit batch(graph);
+    batch.reserve(n + 4 + 3 * n, 6 * n);
+
+    // Filter taps shared by every level: low-pass (h0, h1) and high-pass (g0, g1)
+    const std::string tap_ids[2][2] = {{"h0", "h1"}, {"g0", "g1"}};
+    int taps[2][2];
+    for (int f = 0; f < 2; ++f) {
+        taps[f][0] = batch.add_node(tap_ids[f][0], OpLabel::COEFF);
+        taps[f][1] = batch.add_node(tap_ids[f][1], OpLabel::COEFF);
+    }
+
+    std::vector<int> approximation(n);
+    for (int i = 0; i < n; ++i) {
+        approximation[i] = batch.add_node("x" + std::to_string(i), OpLabel::INPUT);
+    }
+
+    // Level l: a[i] = h0 * a'[2i] + h1 * a'[2i+1], d[i] = g0 * a'[2i] + g1 * a'[2i+1]
+    for (int level = 1; level <= levels; ++level) {
+        const int half = static_cast<int>(approximation.size()) / 2;
+        const std::string prefix = "l" + std::to_string(level) + ",";
+        std::vector<int> next(half);
+        for (int i = 0; i < half; ++i) {
+            for (int f = 0; f < 2; ++f) {
+                const std::string band = f == 0 ? "a" : "d";
+                const int sum_node =
+                    batch.add_node(prefix + band + std::to_string(i), OpLabel::ADD);
+                for (int tap = 0; tap < 2; ++tap) {
+                    const int mul_node = batch.add_node(
+                        prefix + band + "mul" + std::to_string(i) + "," + std::to_string(tap),
+                        OpLabel::MUL);
+                    batch.add_edge(approximation[2 * i + tap], mul_node, 0);
+                    batch.add_edge(taps[f][tap], mul_node, 0);
+                    batch.add_edge(mul_node, sum_node, 0);
+                }
+                if (f == 0) {
+                    next[i] = sum_node;
+                }
+            }
+        }
+        approximation.swap(next);
+    }
+    batch.commit();
+
+    return graph;
+}
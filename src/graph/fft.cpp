@@ -1 +1,67 @@
 #include <mcis/graph.h>
+
+Graph Graph::create_fft_graph(int n) {
+    Graph graph;
+    if (n < 2 || (n & (n - 1)) != 0) {
+        return graph;
+    }
+    int stages = 0;
+    while ((1 << stages) < n) {
+        ++stages;
+    }
+
+    // Reserve space: inputs, twiddles, and one mul/add/sub triple per butterfly with six edges
+    const int butterflies = stages * (n / 2);
+    BatchEdit batch(graph);
+    batch.reserve(n + n / 2 + butterflies * 3, butterflies * 6);
+
+    // Inputs in bit-reversed order, so butterflies read from contiguous halves
+    std::vector<int> current(n);
+    for (int i = 0; i < n; ++i) {
+        int reversed = 0;
+        for (int b = 0; b < stages; ++b) {
+            reversed |= ((i >> b) & 1) << (stages - 1 - b);
+        }
+        current[i] = batch.add_node("x" + std::to_string(reversed), OpLabel::INPUT);
+    }
+
+    std::vector<int> twiddles(n / 2);
+    for (int k = 0; k < n / 2; ++k) {
+        twiddles[k] = batch.add_node("w" + std::to_string(k), OpLabel::TWIDDLE);
+    }
+
+    // Stage s combines blocks of size 2^(s+1): b' = b * w, top = a + b', bottom = a - b'
+    std::vector<int> next(n);
+    for (int s = 0; s < stages; ++s) {
+        const int half = 1 << s;
+        const int stride = n / (2 * half);
+        const std::string stage = "s" + std::to_string(s) + ",";
+        for (int block = 0; block < n; block += 2 * half) {
+            for (int j = 0; j < half; ++j) {
+                const int top = block + j;
+                const int bottom = top + half;
+                const int twiddle = twiddles[j * stride];
+                const int mul_node =
+                    batch.add_node(stage + "mul" + std::to_string(bottom), OpLabel::MUL);
+                const int add_node =
+                    batch.add_node(stage + "add" + std::to_string(top), OpLabel::ADD);
+                const int sub_node =
+                    batch.add_node(stage + "sub" + std::to_string(bottom), OpLabel::SUB);
+
+                batch.add_edge(current[bottom], mul_node, 0);
+                batch.add_edge(twiddle, mul_node, 0);
+                batch.add_edge(current[top], add_node, 0);
+                batch.add_edge(mul_node, add_node, 0);
+                batch.add_edge(current[top], sub_node, 0);
+                batch.add_edge(mul_node, sub_node, 0);
+
+                next[top] = add_node;
+                next[bottom] = sub_node;
+            }
+        }
+        current.swap(next);
+    }
+    batch.commit();
+
+    return graph;
+}
@@ -1,20 +1,49 @@
+#include <mcis/bitset.h>
 #include <mcis/graph.h>
+#include <mcis/graph_summary.h>
+#include <mcis/indexed_graph.h>
+
+#include <algorithm>
 
 #include "time.h"
 
+namespace {
+
+/**
+ * @brief Marks the nodes matching a predicate. Each thread fills whole words of the bit vector,
+ * so no two threads write the same word.
+ */
+Bitset mark_nodes(const std::vector<Node*>& nodes,
+                  const std::function<bool(const Node&)>& predicate) {
+    const int n = static_cast<int>(nodes.size());
+    Bitset marked(n);
+    uint64_t* words = marked.data();
+    const int num_words = static_cast<int>(marked.num_words());
+#pragma omp parallel for schedule(static) if (n >= FILTER_PARALLEL_THRESHOLD)
+    for (int w = 0; w < num_words; ++w) {
+        uint64_t word = 0;
+        const int end = std::min(n, (w + 1) * 64);
+        for (int v = w * 64; v < end; ++v) {
+            if (predicate(*nodes[v])) {
+                word |= uint64_t{1} << (v & 63);
+            }
+        }
+        words[w] = word;
+    }
+    return marked;
+}
+
+}  // namespace
+
 Graph::Graph() = default;
 
 Graph::Graph(const std::vector<Node>& node_list) {
     for (const auto& node : node_list) {
-        add_node(node.get_id());
+        add_node(node.get_id(), node.get_label());
     }
 }
 
-Graph::Graph(const Graph& other) {
-    for (const auto& pair : other.nodes) {
-        nodes[pair.first] = new Node(*pair.second);
-    }
-}
+Graph::Graph(const Graph& other) { copy_from(other); }
 
 Graph& Graph::operator=(const Graph& other) {
     if (this != &other) {
@@ -22,14 +51,34 @@ Graph& Graph::operator=(const Graph& other) {
             delete pair.second;
         }
         nodes.clear();
-        for (const auto& pair : other.nodes) {
-            nodes[pair.first] = new Node(*pair.second);
-        }
+        copy_from(other);
+        invalidate_caches();
+        reset_edit_log();
     }
     return *this;
 }
 
-Graph::Graph(Graph&& other) noexcept : nodes(std::move(other.nodes)) { other.nodes.clear(); }
+void Graph::copy_from(const Graph& other) {
+    nodes.reserve(other.nodes.size());
+    for (const auto& [id, node] : other.nodes) {
+        nodes[id] = new Node(id, node->get_label());
+    }
+    for (const auto& [id, node] : other.nodes) {
+        Node* copy = nodes.at(id);
+        copy->reserve_children(node->get_children().size());
+        for (const auto& [child, weight] : node->get_children()) {
+            copy->add_edge(nodes.at(child->get_id()), weight);
+        }
+    }
+    is_weighted = other.is_weighted;
+}
+
+Graph::Graph(Graph&& other) noexcept
+    : nodes(std::move(other.nodes)), is_weighted(other.is_weighted) {
+    other.nodes.clear();
+    other.invalidate_caches();
+    other.reset_edit_log();
+}
 
 Graph& Graph::operator=(Graph&& other) noexcept {
     if (this != &other) {
@@ -37,7 +86,12 @@ Graph& Graph::operator=(Graph&& other) noexcept {
             delete pair.second;
         }
         nodes = std::move(other.nodes);
+        is_weighted = other.is_weighted;
         other.nodes.clear();
+        invalidate_caches();
+        other.invalidate_caches();
+        reset_edit_log();
+        other.reset_edit_log();
     }
     return *this;
 }
@@ -48,56 +102,35 @@ Graph::~Graph() {
     }
 }
 
-bool Graph::is_dag() {
-    if (dag_cache_valid) {
-        return dag_cache_result;
-    }
-
-    // Kahn's algorithm for cycle detection
-    std::unordered_map<std::string, int> in_degree;
-    in_degree.reserve(nodes.size());
-
-    for (const auto& pair : nodes) {
-        in_degree[pair.first] = pair.second->get_num_parents();
-    }
-
-    std::vector<std::string> zero_in_degree;
-    zero_in_degree.reserve(nodes.size() / 4);
-
-    for (const auto& pair : in_degree) {
-        if (pair.second == 0) {
-            zero_in_degree.push_back(pair.first);
-        }
-    }
-
-    int visited_count = 0;
-    const int total_nodes = static_cast<int>(nodes.size());
-
-    while (!zero_in_degree.empty()) {
-        std::string node_id = zero_in_degree.back();
-        zero_in_degree.pop_back();
-        visited_count++;
-
-        // early termination
-        if (visited_count == total_nodes) {
-            dag_cache_result = true;
-            dag_cache_valid = true;
-            return true;
+bool Graph::is_dag() const {
+    std::shared_ptr<DerivedCache> current = derived();
+    std::call_once(current->dag_once, [&]() {
+        // Kahn's algorithm for cycle detection
+        std::unordered_map<const Node*, int> in_degree;
+        in_degree.reserve(nodes.size());
+        std::vector<const Node*> zero_in_degree;
+        zero_in_degree.reserve(nodes.size() / 4);
+        for (const auto& [_, node] : nodes) {
+            in_degree[node] = node->get_num_parents();
+            if (node->get_num_parents() == 0) {
+                zero_in_degree.push_back(node);
+            }
         }
 
-        Node* node = nodes[node_id];
-        for (const auto& child_pair : node->get_children()) {
-            Node* child = child_pair.first;
-            in_degree[child->get_id()]--;
-            if (in_degree[child->get_id()] == 0) {
-                zero_in_degree.push_back(child->get_id());
+        size_t visited_count = 0;
+        while (!zero_in_degree.empty()) {
+            const Node* node = zero_in_degree.back();
+            zero_in_degree.pop_back();
+            visited_count++;
+            for (const auto& [child, _] : node->get_children()) {
+                if (--in_degree[child] == 0) {
+                    zero_in_degree.push_back(child);
+                }
             }
         }
-    }
-
-    dag_cache_result = (visited_count == total_nodes);
-    dag_cache_valid = true;
-    return dag_cache_result;
+        current->dag = visited_count == nodes.size();
+    });
+    return current->dag;
 }
 
 void Graph::print_graph() const {
@@ -116,22 +149,24 @@ void Graph::print_graph() const {
     }
 }
 
-bool Graph::add_node(const std::string& id) {
+bool Graph::add_node(const std::string& id, OpLabel label) {
     if (nodes.find(id) != nodes.end()) {
         return false;
     }
-    nodes[id] = new Node(id);
+    nodes[id] = new Node(id, label);
+    record_edit(GraphEditKind::ADD_NODE, id);
     invalidate_caches();
     return true;
 }
 
-bool Graph::add_node_set(const std::vector<std::string>& ids) {
+bool Graph::add_node_set(const std::vector<std::string>& ids, OpLabel label) {
     bool all_added = true;
     bool any_added = false;
 
     for (const std::string& id : ids) {
         if (nodes.find(id) == nodes.end()) {
-            nodes[id] = new Node(id);
+            nodes[id] = new Node(id, label);
+            record_edit(GraphEditKind::ADD_NODE, id);
             any_added = true;
         } else {
             all_added = false;
@@ -144,6 +179,17 @@ bool Graph::add_node_set(const std::vector<std::string>& ids) {
     return all_added;
 }
 
+bool Graph::set_node_label(const std::string& id, OpLabel label) {
+    auto it = nodes.find(id);
+    if (it == nodes.end()) {
+        return false;
+    }
+    it->second->set_label(label);
+    record_edit(GraphEditKind::SET_LABEL, id);
+    invalidate_caches();
+    return true;
+}
+
 bool Graph::remove_node(const std::string& id) {
     auto it = nodes.find(id);
     if (it == nodes.end()) {
@@ -169,6 +215,7 @@ bool Graph::remove_node(const std::string& id) {
 
     delete node_to_remove;
     nodes.erase(it);
+    record_edit(GraphEditKind::REMOVE_NODE, id);
     invalidate_caches();
     return true;
 }
@@ -180,8 +227,10 @@ bool Graph::add_edge(const std::string& from_id, const std::string& to_id, int w
         return false;
     }
     is_weighted = is_weighted || (weight != 0);
+    const bool existed = from_it->second->contains_edge(to_it->second);
     bool result = from_it->second->add_edge(to_it->second, weight);
-    if (result) {
+    if (result && !existed) {
+        record_edit(GraphEditKind::ADD_EDGE, from_id, to_id);
         invalidate_caches();
     }
     return result;
@@ -201,8 +250,12 @@ bool Graph::add_edge_set(const std::string& from_id, const std::vector<std::stri
     for (size_t i = 0; i < to_ids.size(); ++i) {
         int weight = use_zero_weights ? 0 : weights[i];
         auto to_it = nodes.find(to_ids[i]);
+        const bool existed = to_it != nodes.end() && from_it->second->contains_edge(to_it->second);
         if (to_it != nodes.end() && from_it->second->add_edge(to_it->second, weight)) {
-            any_added = true;
+            if (!existed) {
+                record_edit(GraphEditKind::ADD_EDGE, from_id, to_ids[i]);
+                any_added = true;
+            }
         } else {
             all_added = false;
         }
@@ -222,6 +275,7 @@ bool Graph::remove_edge(const std::string& from_id, const std::string& to_id) {
     }
     bool result = from_it->second->remove_edge(to_it->second);
     if (result) {
+        record_edit(GraphEditKind::REMOVE_EDGE, from_id, to_id);
         invalidate_caches();
     }
     return result;
@@ -235,6 +289,11 @@ bool Graph::change_edge_weight(const std::string& from_id, const std::string& to
         return false;
     }
     bool result = from_it->second->change_edge_weight(to_it->second, new_weight);
+    if (result) {
+        is_weighted = is_weighted || (new_weight != 0);
+        record_edit(GraphEditKind::CHANGE_WEIGHT, from_id, to_id);
+        invalidate_caches();
+    }
     return result;
 }
 
@@ -290,6 +349,12 @@ void Graph::generate_diagram_file(const std::string& graph_name) const {
     std::ofstream outputFile(dotpath);
 
     outputFile << "digraph G {\n";
+    for (const auto& [id, node] : nodes) {
+        if (node->get_label() != OpLabel::NONE) {
+            outputFile << "    " << std::quoted(id) << " [label=\"" << id << "\\n"
+                       << op_label_name(node->get_label()) << "\"];\n";
+        }
+    }
     if (!is_weighted) {
         for (const auto& [_, node] : nodes) {
             for (const auto& [child, weight] : node->get_children()) {
@@ -316,6 +381,21 @@ int Graph::remove_nodes_bulk(const std::vector<std::string>& node_ids) {
         return 0;
     }
 
+    // With a snapshot at hand, the removal is one pass over its rows
+    if (std::shared_ptr<const IndexedGraph> indexed = get_cached_indexed()) {
+        Bitset marked(indexed->get_num_nodes());
+        for (const std::string& id : node_ids) {
+            const int v = indexed->get_index(id);
+            if (v >= 0) {
+                marked.set(v);
+            }
+        }
+        if (!marked.any()) {
+            return 0;
+        }
+        return erase_marked(*indexed, get_indexed_nodes(*indexed), marked);
+    }
+
     std::vector<Node*> nodes_to_remove;
     nodes_to_remove.reserve(node_ids.size());
 
@@ -329,8 +409,79 @@ int Graph::remove_nodes_bulk(const std::vector<std::string>& node_ids) {
     if (nodes_to_remove.empty()) return 0;
 
     std::unordered_set<Node*> removal_set(nodes_to_remove.begin(), nodes_to_remove.end());
+    for (Node* node : removal_set) {
+        record_edit(GraphEditKind::REMOVE_NODE, node->get_id());
+    }
+    erase_nodes(removal_set);
+
+    invalidate_caches();
+    return static_cast<int>(removal_set.size());
+}
+
+int Graph::remove_nodes_if(const std::function<bool(const Node&)>& remove) {
+    std::shared_ptr<const IndexedGraph> indexed = get_cached_indexed();
+    if (!indexed) {
+        // Building a snapshot costs more than the hash-set removal it would replace
+        std::vector<std::string> node_ids;
+        for (const auto& [id, node] : nodes) {
+            if (remove(*node)) {
+                node_ids.push_back(id);
+            }
+        }
+        return remove_nodes_bulk(node_ids);
+    }
+    const std::vector<Node*> indexed_nodes = get_indexed_nodes(*indexed);
+    const Bitset marked = mark_nodes(indexed_nodes, remove);
+    if (!marked.any()) {
+        return 0;
+    }
+    return erase_marked(*indexed, indexed_nodes, marked);
+}
+
+std::vector<Node*> Graph::get_indexed_nodes(const IndexedGraph& indexed) const {
+    const int n = indexed.get_num_nodes();
+    std::vector<Node*> result(n);
+#pragma omp parallel for schedule(static) if (n >= FILTER_PARALLEL_THRESHOLD)
+    for (int v = 0; v < n; ++v) {
+        result[v] = nodes.at(indexed.get_id(v));
+    }
+    return result;
+}
+
+int Graph::erase_marked(const IndexedGraph& indexed, const std::vector<Node*>& indexed_nodes,
+                        const Bitset& marked) {
+    const int n = indexed.get_num_nodes();
+#pragma omp parallel for schedule(dynamic, 256) if (n >= FILTER_PARALLEL_THRESHOLD)
+    for (int v = 0; v < n; ++v) {
+        if (marked.test(v)) {
+            continue;
+        }
+        Node* node = indexed_nodes[v];
+        for (int child : indexed.get_children(v)) {
+            if (marked.test(child)) {
+                node->children.erase(indexed_nodes[child]);
+            }
+        }
+        int parents = 0;
+        for (int parent : indexed.get_parents(v)) {
+            parents += marked.test(parent) ? 0 : 1;
+        }
+        node->num_parents = parents;
+    }
+
+    int removed = 0;
+    marked.for_each([&](size_t v) {
+        record_edit(GraphEditKind::REMOVE_NODE, indexed.get_id(static_cast<int>(v)));
+        nodes.erase(indexed.get_id(static_cast<int>(v)));
+        delete indexed_nodes[v];
+        removed++;
+    });
+    invalidate_caches();
+    return removed;
+}
 
-    for (Node* node_to_remove : nodes_to_remove) {
+void Graph::erase_nodes(const std::unordered_set<Node*>& removal_set) {
+    for (Node* node_to_remove : removal_set) {
         auto children_copy = node_to_remove->get_children();
         for (const auto& [child, weight] : children_copy) {
             node_to_remove->remove_edge(child);
@@ -351,18 +502,214 @@ int Graph::remove_nodes_bulk(const std::vector<std::string>& node_ids) {
         }
     }
 
-    for (Node* node_to_remove : nodes_to_remove) {
+    for (Node* node_to_remove : removal_set) {
         nodes.erase(node_to_remove->get_id());
         delete node_to_remove;
     }
+}
 
-    invalidate_caches();
-    return static_cast<int>(nodes_to_remove.size());
+Graph Graph::filter_nodes(const std::function<bool(const Node&)>& keep) const {
+    std::shared_ptr<const IndexedGraph> indexed = get_indexed();
+    const int n = indexed->get_num_nodes();
+    const std::vector<Node*> indexed_nodes = get_indexed_nodes(*indexed);
+    const Bitset kept = mark_nodes(indexed_nodes, keep);
+
+    // Fresh nodes are allocated in parallel, then registered in index order
+    std::vector<Node*> copies(n, nullptr);
+#pragma omp parallel for schedule(static) if (n >= FILTER_PARALLEL_THRESHOLD)
+    for (int v = 0; v < n; ++v) {
+        if (kept.test(v)) {
+            copies[v] = new Node(indexed->get_id(v), indexed->get_label(v));
+        }
+    }
+    Graph subgraph;
+    subgraph.nodes.reserve(kept.count());
+    kept.for_each([&](size_t v) { subgraph.nodes.emplace(indexed->get_id(v), copies[v]); });
+
+    // Every node fills its own children and parent count, so threads never share a node
+    bool weighted = false;
+#pragma omp parallel for schedule(dynamic, 256) reduction(|| : weighted) \
+    if (n >= FILTER_PARALLEL_THRESHOLD)
+    for (int v = 0; v < n; ++v) {
+        if (!kept.test(v)) {
+            continue;
+        }
+        const std::span<const int> children = indexed->get_children(v);
+        const std::span<const int> weights = indexed->get_child_weights(v);
+        Node* copy = copies[v];
+        copy->children.reserve(std::count_if(children.begin(), children.end(),
+                                             [&](int child) { return kept.test(child); }));
+        for (size_t i = 0; i < children.size(); ++i) {
+            if (kept.test(children[i])) {
+                copy->children.insert(copies[children[i]], weights[i]);
+                weighted = weighted || (weights[i] != 0);
+            }
+        }
+        int parents = 0;
+        for (int parent : indexed->get_parents(v)) {
+            parents += kept.test(parent) ? 1 : 0;
+        }
+        copy->num_parents = parents;
+    }
+    subgraph.is_weighted = weighted;
+    return subgraph;
+}
+
+Graph Graph::induced_subgraph(const std::vector<std::string>& node_ids) const {
+    Graph subgraph;
+    subgraph.reserve_nodes(node_ids.size());
+    for (const std::string& id : node_ids) {
+        auto it = nodes.find(id);
+        if (it != nodes.end()) {
+            subgraph.add_node(id, it->second->get_label());
+        }
+    }
+    for (const auto& [id, sub_node] : subgraph.nodes) {
+        for (const auto& [child, weight] : nodes.at(id)->get_children()) {
+            auto it = subgraph.nodes.find(child->get_id());
+            if (it != subgraph.nodes.end()) {
+                subgraph.is_weighted = subgraph.is_weighted || (weight != 0);
+                sub_node->add_edge(it->second, weight);
+            }
+        }
+    }
+    subgraph.invalidate_caches();
+    return subgraph;
+}
+
+std::vector<std::vector<std::string>> Graph::get_weakly_connected_components() const {
+    std::vector<std::string> ids;
+    ids.reserve(nodes.size());
+    for (const auto& [id, _] : nodes) {
+        ids.push_back(id);
+    }
+    std::sort(ids.begin(), ids.end());
+
+    std::unordered_map<const Node*, int> index;
+    index.reserve(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        index[nodes.at(ids[i])] = static_cast<int>(i);
+    }
+
+    // Union-find over edges; roots are kept at the smallest index so components come out ordered
+    std::vector<int> parent(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        parent[i] = static_cast<int>(i);
+    }
+    auto find = [&](int v) {
+        while (parent[v] != v) {
+            parent[v] = parent[parent[v]];
+            v = parent[v];
+        }
+        return v;
+    };
+    for (size_t i = 0; i < ids.size(); ++i) {
+        for (const auto& [child, _] : nodes.at(ids[i])->get_children()) {
+            auto it = index.find(child);
+            if (it == index.end()) {
+                continue;
+            }
+            const int a = find(static_cast<int>(i));
+            const int b = find(it->second);
+            parent[std::max(a, b)] = std::min(a, b);
+        }
+    }
+
+    std::vector<std::vector<std::string>> components;
+    std::vector<int> slot(ids.size(), -1);
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const int root = find(static_cast<int>(i));
+        if (slot[root] < 0) {
+            slot[root] = static_cast<int>(components.size());
+            components.emplace_back();
+        }
+        components[slot[root]].push_back(ids[i]);
+    }
+    return components;
+}
+
+bool Graph::is_forest() const {
+    // A graph is a forest exactly when it has one edge fewer than nodes per component
+    size_t edges = 0;
+    for (const auto& [_, node] : nodes) {
+        edges += node->get_children().size();
+    }
+    return edges + get_weakly_connected_components().size() == nodes.size();
 }
 
 void Graph::reserve_nodes(size_t expected_size) { nodes.reserve(expected_size); }
 
+std::shared_ptr<Graph::DerivedCache> Graph::derived() const {
+    std::shared_ptr<DerivedCache> current = cache.load(std::memory_order_acquire);
+    if (!current) {
+        auto fresh = std::make_shared<DerivedCache>();
+        current = cache.compare_exchange_strong(current, fresh, std::memory_order_acq_rel)
+                      ? fresh
+                      : current;
+    }
+    return current;
+}
+
+const GraphSummary& Graph::get_summary() const {
+    std::shared_ptr<DerivedCache> current = derived();
+    std::call_once(current->summary_once, [&]() {
+        current->summary = std::make_shared<const GraphSummary>(*get_indexed());
+    });
+    return *current->summary;
+}
+
+std::shared_ptr<const IndexedGraph> Graph::get_indexed() const {
+    std::shared_ptr<DerivedCache> current = derived();
+    std::call_once(current->indexed_once,
+                   [&]() { current->indexed = std::make_shared<const IndexedGraph>(*this); });
+    return current->indexed;
+}
+
+std::shared_ptr<const IndexedGraph> Graph::get_cached_indexed() const {
+    std::shared_ptr<DerivedCache> current = cache.load(std::memory_order_acquire);
+    return current ? current->indexed : nullptr;
+}
+
+std::shared_ptr<const Graph> Graph::snapshot() const {
+    std::shared_ptr<DerivedCache> current = derived();
+    std::call_once(current->snapshot_once,
+                   [&]() { current->snapshot = std::make_shared<const Graph>(*this); });
+    return current->snapshot;
+}
+
 void Graph::invalidate_caches() const {
-    dag_cache_valid = false;
+    cache.store(nullptr, std::memory_order_release);
     ++version;
 }
+
+void Graph::record_edit(GraphEditKind kind, const std::string& from, const std::string& to) {
+    edit_log.push_back({kind, from, to, version});
+    if (edit_log.size() <= GRAPH_EDIT_LOG_LIMIT) {
+        return;
+    }
+
+    // Drop the older half, keeping the edits of each version together
+    size_t cut = edit_log.size() / 2;
+    const int dropped = edit_log[cut - 1].version;
+    while (cut < edit_log.size() && edit_log[cut].version == dropped) {
+        ++cut;
+    }
+    edit_log.erase(edit_log.begin(), edit_log.begin() + static_cast<std::ptrdiff_t>(cut));
+    edit_log_floor = dropped + 1;
+}
+
+void Graph::reset_edit_log() {
+    edit_log.clear();
+    edit_log_floor = version;
+}
+
+bool Graph::get_edits_since(int since, std::vector<GraphEdit>& edits) const {
+    edits.clear();
+    if (since < edit_log_floor) {
+        return false;
+    }
+    auto first = std::lower_bound(edit_log.begin(), edit_log.end(), since,
+                                  [](const GraphEdit& edit, int v) { return edit.version < v; });
+    edits.assign(first, edit_log.end());
+    return true;
+}
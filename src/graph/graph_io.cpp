@@ -0,0 +1,125 @@
+#include <mcis/graph.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+const char GRAPH_MAGIC[8] = {'M', 'C', 'I', 'S', 'G', 'R', 'F', '1'};
+
+// Longest accepted node ID, so corrupt lengths fail instead of allocating
+constexpr uint32_t MAX_ID_LENGTH = 1 << 20;
+
+void write_u32(std::ostream& out, uint32_t value) {
+    char bytes[4];
+    for (int i = 0; i < 4; ++i) {
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+    out.write(bytes, 4);
+}
+
+bool read_u32(std::istream& in, uint32_t& value) {
+    unsigned char bytes[4];
+    if (!in.read(reinterpret_cast<char*>(bytes), 4)) {
+        return false;
+    }
+    value = 0;
+    for (int i = 0; i < 4; ++i) {
+        value |= static_cast<uint32_t>(bytes[i]) << (8 * i);
+    }
+    return true;
+}
+
+}  // namespace
+
+bool Graph::write_binary(std::ostream& out) const {
+    std::vector<const Node*> order;
+    order.reserve(nodes.size());
+    for (const auto& [_, node] : nodes) {
+        order.push_back(node);
+    }
+    std::sort(order.begin(), order.end(),
+              [](const Node* a, const Node* b) { return a->get_id() < b->get_id(); });
+    std::unordered_map<const Node*, uint32_t> position;
+    size_t num_edges = 0;
+    for (size_t i = 0; i < order.size(); ++i) {
+        position[order[i]] = static_cast<uint32_t>(i);
+        num_edges += order[i]->get_children().size();
+    }
+
+    out.write(GRAPH_MAGIC, sizeof(GRAPH_MAGIC));
+    write_u32(out, static_cast<uint32_t>(order.size()));
+    for (const Node* node : order) {
+        const std::string id = node->get_id();
+        write_u32(out, static_cast<uint32_t>(id.size()));
+        out.write(id.data(), static_cast<std::streamsize>(id.size()));
+        out.put(static_cast<char>(node->get_label()));
+    }
+
+    // Edges in source order, each source's children by position
+    write_u32(out, static_cast<uint32_t>(num_edges));
+    std::vector<std::pair<uint32_t, int>> children;
+    for (size_t i = 0; i < order.size(); ++i) {
+        children.clear();
+        for (const auto& [child, weight] : order[i]->get_children()) {
+            children.emplace_back(position[child], weight);
+        }
+        std::sort(children.begin(), children.end());
+        for (const auto& [child, weight] : children) {
+            write_u32(out, static_cast<uint32_t>(i));
+            write_u32(out, child);
+            write_u32(out, static_cast<uint32_t>(weight));
+        }
+    }
+    return static_cast<bool>(out);
+}
+
+bool Graph::read_binary(std::istream& in) {
+    *this = Graph();
+    char magic[sizeof(GRAPH_MAGIC)];
+    uint32_t num_nodes = 0;
+    if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), GRAPH_MAGIC)
+        || !read_u32(in, num_nodes)) {
+        return false;
+    }
+
+    // Nodes and edges are bulk-loaded; on failure the batch is flushed before clearing the graph
+    BatchEdit batch(*this);
+    auto fail = [&]() {
+        batch.commit();
+        *this = Graph();
+        return false;
+    };
+    for (uint32_t i = 0; i < num_nodes; ++i) {
+        uint32_t length = 0;
+        if (!read_u32(in, length) || length > MAX_ID_LENGTH) {
+            return fail();
+        }
+        std::string id(length, '\0');
+        in.read(id.data(), length);
+        const int label = in.get();
+        if (!in || label >= NUM_OP_LABELS
+            || batch.add_node(id, static_cast<OpLabel>(label)) != static_cast<int>(i)) {
+            return fail();
+        }
+    }
+
+    uint32_t num_edges = 0;
+    if (!read_u32(in, num_edges)) {
+        return fail();
+    }
+    for (uint32_t e = 0; e < num_edges; ++e) {
+        uint32_t from = 0;
+        uint32_t to = 0;
+        uint32_t weight = 0;
+        if (!read_u32(in, from) || !read_u32(in, to) || !read_u32(in, weight)
+            || from >= num_nodes || to >= num_nodes
+            || !batch.add_edge(static_cast<int>(from), static_cast<int>(to),
+                               static_cast<int>(weight))) {
+            return fail();
+        }
+    }
+    batch.commit();
+    reset_edit_log();
+    return true;
+}
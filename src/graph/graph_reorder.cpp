@@ -0,0 +1,205 @@
+#include <mcis/graph_reorder.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <numeric>
+
+namespace {
+
+// Distinct neighbors of every node, children and parents merged, without self-loops
+std::vector<std::vector<int>> neighbor_lists(const IndexedGraph& graph) {
+    const int n = graph.get_num_nodes();
+    std::vector<std::vector<int>> neighbors(n);
+    for (int v = 0; v < n; ++v) {
+        auto children = graph.get_children(v);
+        auto parents = graph.get_parents(v);
+        std::vector<int>& list = neighbors[v];
+        std::set_union(children.begin(), children.end(), parents.begin(), parents.end(),
+                       std::back_inserter(list));
+        list.erase(std::remove(list.begin(), list.end(), v), list.end());
+    }
+    return neighbors;
+}
+
+// Removes a node of minimum remaining degree until none is left, with buckets of nodes per degree
+std::vector<int> degeneracy_removal(const std::vector<std::vector<int>>& neighbors) {
+    const int n = static_cast<int>(neighbors.size());
+    std::vector<int> degree(n);
+    int max_degree = 0;
+    for (int v = 0; v < n; ++v) {
+        degree[v] = static_cast<int>(neighbors[v].size());
+        max_degree = std::max(max_degree, degree[v]);
+    }
+    std::vector<std::vector<int>> buckets(max_degree + 1);
+    for (int v = n - 1; v >= 0; --v) {
+        buckets[degree[v]].push_back(v);
+    }
+
+    std::vector<int> removal;
+    std::vector<bool> removed(n, false);
+    int d = 0;
+    while (static_cast<int>(removal.size()) < n) {
+        // Stale bucket entries (nodes whose degree dropped since) are skipped
+        while (buckets[d].empty()) {
+            d++;
+        }
+        const int v = buckets[d].back();
+        buckets[d].pop_back();
+        if (removed[v] || degree[v] != d) {
+            continue;
+        }
+        removed[v] = true;
+        removal.push_back(v);
+        for (int w : neighbors[v]) {
+            if (!removed[w]) {
+                buckets[--degree[w]].push_back(w);
+            }
+        }
+        d = std::max(d - 1, 0);
+    }
+    return removal;
+}
+
+int degree(const IndexedGraph& graph, int v) {
+    return graph.get_out_degree(v) + graph.get_in_degree(v);
+}
+
+/**
+ * @brief Breadth-first search over both edge directions, visiting neighbors by increasing
+ * degree. Appends the reached nodes to order.
+ * @return The lowest-degree node of the last layer, a start far from the others.
+ */
+int cuthill_mckee(const IndexedGraph& graph, int start, std::vector<char>& visited,
+                  std::vector<int>& order) {
+    std::vector<int> neighbors;
+    visited[start] = 1;
+    size_t layer_begin = order.size();
+    order.push_back(start);
+    size_t layer_end = order.size();
+    for (size_t head = layer_begin; head < order.size(); ++head) {
+        if (head == layer_end) {
+            layer_begin = layer_end;
+            layer_end = order.size();
+        }
+        const int v = order[head];
+        neighbors.clear();
+        for (int w : graph.get_children(v)) {
+            neighbors.push_back(w);
+        }
+        for (int w : graph.get_parents(v)) {
+            neighbors.push_back(w);
+        }
+        std::stable_sort(neighbors.begin(), neighbors.end(),
+                         [&](int a, int b) { return degree(graph, a) < degree(graph, b); });
+        for (int w : neighbors) {
+            if (!visited[w]) {
+                visited[w] = 1;
+                order.push_back(w);
+            }
+        }
+    }
+    return *std::min_element(order.begin() + static_cast<long>(layer_begin), order.end(),
+                             [&](int a, int b) { return degree(graph, a) < degree(graph, b); });
+}
+
+std::vector<int> reverse_cuthill_mckee(const IndexedGraph& graph) {
+    const int n = graph.get_num_nodes();
+    std::vector<int> by_degree(n);
+    std::iota(by_degree.begin(), by_degree.end(), 0);
+    std::stable_sort(by_degree.begin(), by_degree.end(),
+                     [&](int a, int b) { return degree(graph, a) < degree(graph, b); });
+
+    std::vector<int> order;
+    order.reserve(n);
+    std::vector<char> visited(n, 0);
+    std::vector<char> probe(n, 0);
+    std::vector<int> scratch;
+    for (int start : by_degree) {
+        if (visited[start]) {
+            continue;
+        }
+        // One pass from the lowest-degree node finds a far (pseudo-peripheral) start
+        scratch.clear();
+        const int peripheral = cuthill_mckee(graph, start, probe, scratch);
+        cuthill_mckee(graph, peripheral, visited, order);
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+}  // namespace
+
+std::vector<int> GraphReorder::node_order(const IndexedGraph& graph, const IndexedGraph& other,
+                                          VertexOrdering ordering) {
+    const int n = graph.get_num_nodes();
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    auto sort_by = [&](auto key) {
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return key(a) < key(b); });
+    };
+
+    switch (ordering) {
+        case VertexOrdering::NATURAL:
+            break;
+        case VertexOrdering::DEGREE: {
+            const auto neighbors = neighbor_lists(graph);
+            sort_by([&](int v) { return -static_cast<int>(neighbors[v].size()); });
+            break;
+        }
+        case VertexOrdering::DEGENERACY:
+            order = degeneracy_removal(neighbor_lists(graph));
+            std::reverse(order.begin(), order.end());
+            break;
+        case VertexOrdering::LEVEL:
+            if (graph.is_dag()) {
+                sort_by([&](int v) { return graph.get_level(v); });
+            }
+            break;
+        case VertexOrdering::LABEL_RARITY: {
+            std::array<long long, NUM_OP_LABELS> count{};
+            std::array<long long, NUM_OP_LABELS> other_count{};
+            for (int v = 0; v < n; ++v) {
+                count[static_cast<int>(graph.get_label(v))]++;
+            }
+            for (int v = 0; v < other.get_num_nodes(); ++v) {
+                other_count[static_cast<int>(other.get_label(v))]++;
+            }
+            sort_by([&](int v) {
+                const int label = static_cast<int>(graph.get_label(v));
+                return std::pair(count[label] * other_count[label], label);
+            });
+            break;
+        }
+        case VertexOrdering::RCM:
+            order = reverse_cuthill_mckee(graph);
+            break;
+    }
+    return order;
+}
+
+std::vector<int> GraphReorder::invert(const std::vector<int>& order) {
+    std::vector<int> rank(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        rank[order[i]] = static_cast<int>(i);
+    }
+    return rank;
+}
+
+std::vector<int> GraphReorder::remap(const std::vector<int>& mapping,
+                                     const std::vector<int>& rank1,
+                                     const std::vector<int>& rank2) {
+    std::vector<int> result(mapping.size(), -1);
+    for (size_t u = 0; u < mapping.size(); ++u) {
+        result[rank1[u]] = mapping[u] < 0 ? -1 : rank2[mapping[u]];
+    }
+    return result;
+}
+
+void GraphReorder::remap(std::vector<std::pair<int, int>>& pairs, const std::vector<int>& rank1,
+                         const std::vector<int>& rank2) {
+    for (auto& [u, v] : pairs) {
+        u = rank1[u];
+        v = rank2[v];
+    }
+}
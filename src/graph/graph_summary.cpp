@@ -0,0 +1,45 @@
+#include <mcis/graph_summary.h>
+
+#include <algorithm>
+#include <map>
+
+GraphSummary::GraphSummary(const IndexedGraph& graph)
+    : num_nodes(graph.get_num_nodes()), num_edges(graph.get_num_edges()), dag(graph.is_dag()) {
+    std::array<std::map<int, int>, NUM_OP_LABELS> degrees;
+    if (dag) {
+        for (auto& histogram : level_histograms) {
+            histogram.assign(graph.get_num_levels(), 0);
+        }
+    }
+    for (int v = 0; v < num_nodes; ++v) {
+        const int label = static_cast<int>(graph.get_label(v));
+        label_counts[label]++;
+
+        // Children and parents are sorted, so shared neighbors are counted by merging
+        auto children = graph.get_children(v);
+        auto parents = graph.get_parents(v);
+        int neighbors = static_cast<int>(children.size() + parents.size());
+        size_t i = 0;
+        size_t j = 0;
+        while (i < children.size() && j < parents.size()) {
+            if (children[i] < parents[j]) {
+                i++;
+            } else if (parents[j] < children[i]) {
+                j++;
+            } else {
+                neighbors--;
+                i++;
+                j++;
+            }
+        }
+        neighbors -= graph.has_edge(v, v) ? 1 : 0;
+        degrees[label][neighbors]++;
+
+        if (dag) {
+            level_histograms[label][graph.get_level(v)]++;
+        }
+    }
+    for (int label = 0; label < NUM_OP_LABELS; ++label) {
+        degree_histograms[label].assign(degrees[label].begin(), degrees[label].end());
+    }
+}
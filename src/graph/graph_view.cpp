@@ -0,0 +1,231 @@
+#include <mcis/graph_view.h>
+
+#include <climits>
+
+MVMView::MVMView(int m, int n) {
+    if (m <= 0 || n <= 0) {
+        return;
+    }
+    const long long cells = static_cast<long long>(m) * n;
+    const long long nodes = 3 * cells + n - m;
+    const long long edges = 2 * cells + (n >= 2 ? cells + static_cast<long long>(m) * (n - 2) : 0);
+    if (nodes > INT_MAX || edges > INT_MAX) {
+        return;
+    }
+    this->m = m;
+    this->n = n;
+}
+
+int MVMView::get_num_nodes() const { return m == 0 ? 0 : acc_base() + m * (n - 1); }
+
+int MVMView::get_num_edges() const {
+    return m == 0 ? 0 : 2 * m * n + (n >= 2 ? m * n + m * (n - 2) : 0);
+}
+
+std::string MVMView::get_id(int v) const {
+    if (v < vec_base()) {
+        return "m" + std::to_string(v / n) + "," + std::to_string(v % n);
+    }
+    if (v < product_base()) {
+        return "v" + std::to_string(v - vec_base());
+    }
+    if (v < acc_base()) {
+        const int p = v - product_base();
+        return "p" + std::to_string(p / n) + "," + std::to_string(p % n);
+    }
+    const int a = v - acc_base();
+    return "acc" + std::to_string(3 + a / m) + "," + std::to_string(a % m);
+}
+
+OpLabel MVMView::get_label(int v) const {
+    if (v < product_base()) {
+        return OpLabel::INPUT;
+    }
+    return v < acc_base() ? OpLabel::MUL : OpLabel::ADD;
+}
+
+int MVMView::get_out_degree(int v) const {
+    if (v < vec_base()) {
+        return 1;
+    }
+    if (v < product_base()) {
+        return m;
+    }
+    if (v < acc_base()) {
+        return n >= 2 ? 1 : 0;
+    }
+    return v + m < get_num_nodes() ? 1 : 0;
+}
+
+int MVMView::get_in_degree(int v) const {
+    if (v < product_base()) {
+        return 0;
+    }
+    if (v < acc_base()) {
+        return 2;
+    }
+    return v < acc_base() + m ? n : 1;
+}
+
+int MVMView::get_level(int v) const {
+    if (v < product_base()) {
+        return 0;
+    }
+    // Accumulator set S_k (k >= 3) sits at level k - 1
+    return v < acc_base() ? 1 : 2 + (v - acc_base()) / m;
+}
+
+FFTView::FFTView(int n) {
+    if (n < 2 || (n & (n - 1)) != 0) {
+        return;
+    }
+    int stages = 0;
+    while ((1 << stages) < n) {
+        ++stages;
+    }
+    const long long butterflies = static_cast<long long>(stages) * (n / 2);
+    if (n + n / 2 + 3 * butterflies > INT_MAX || 6 * butterflies > INT_MAX) {
+        return;
+    }
+    this->n = n;
+    this->stages = stages;
+}
+
+std::string FFTView::get_id(int v) const {
+    if (v < n) {
+        int reversed = 0;
+        for (int b = 0; b < stages; ++b) {
+            reversed |= ((v >> b) & 1) << (stages - 1 - b);
+        }
+        return "x" + std::to_string(reversed);
+    }
+    if (v < n + half_n()) {
+        return "w" + std::to_string(v - n);
+    }
+    const int s = (v - stage_base(0)) / (3 * half_n());
+    const int b = (v - stage_base(s)) / 3;
+    const int t = top(s, b);
+    const std::string stage = "s" + std::to_string(s) + ",";
+    switch ((v - stage_base(s)) % 3) {
+        case 0:
+            return stage + "mul" + std::to_string(t + (1 << s));
+        case 1:
+            return stage + "add" + std::to_string(t);
+        default:
+            return stage + "sub" + std::to_string(t + (1 << s));
+    }
+}
+
+OpLabel FFTView::get_label(int v) const {
+    if (v < n) {
+        return OpLabel::INPUT;
+    }
+    if (v < n + half_n()) {
+        return OpLabel::TWIDDLE;
+    }
+    static constexpr OpLabel parts[3] = {OpLabel::MUL, OpLabel::ADD, OpLabel::SUB};
+    return parts[(v - stage_base(0)) % 3];
+}
+
+int FFTView::get_out_degree(int v) const {
+    if (v < n) {
+        return (v & 1) ? 1 : 2;
+    }
+    if (v < n + half_n()) {
+        const int k = v - n;
+        int degree = 0;
+        for (int s = 0; s < stages; ++s) {
+            degree += k % (half_n() >> s) == 0 ? half_n() >> s : 0;
+        }
+        return degree;
+    }
+    const int s = (v - stage_base(0)) / (3 * half_n());
+    const int part = (v - stage_base(s)) % 3;
+    if (part == 0) {
+        return 2;
+    }
+    if (s + 1 == stages) {
+        return 0;
+    }
+    const int position = top(s, (v - stage_base(s)) / 3) + (part == 2 ? 1 << s : 0);
+    return (position >> (s + 1)) & 1 ? 1 : 2;
+}
+
+int FFTView::get_level(int v) const {
+    if (v < n + half_n()) {
+        return 0;
+    }
+    const int s = (v - stage_base(0)) / (3 * half_n());
+    return (v - stage_base(s)) % 3 == 0 ? 2 * s + 1 : 2 * s + 2;
+}
+
+DWTView::DWTView(int n, int levels) {
+    if (n <= 0 || levels <= 0 || levels >= 31 || n % (1 << levels) != 0) {
+        return;
+    }
+    const long long outputs = n - (n >> levels);
+    if (4 + n + 6 * outputs > INT_MAX || 12 * outputs > INT_MAX) {
+        return;
+    }
+    this->n = n;
+    this->levels = levels;
+}
+
+std::string DWTView::get_id(int v) const {
+    static const char* const taps[4] = {"h0", "h1", "g0", "g1"};
+    if (v < 4) {
+        return taps[v];
+    }
+    if (v < 4 + n) {
+        return "x" + std::to_string(v - 4);
+    }
+    int level = 0;
+    int offset = 0;
+    locate(v, level, offset);
+    const std::string band = (offset % 6) / 3 == 0 ? "a" : "d";
+    const std::string prefix = "l" + std::to_string(level) + "," + band;
+    const int part = offset % 3;
+    if (part == 0) {
+        return prefix + std::to_string(offset / 6);
+    }
+    return prefix + "mul" + std::to_string(offset / 6) + "," + std::to_string(part - 1);
+}
+
+OpLabel DWTView::get_label(int v) const {
+    if (v < 4) {
+        return OpLabel::COEFF;
+    }
+    if (v < 4 + n) {
+        return OpLabel::INPUT;
+    }
+    int level = 0;
+    int offset = 0;
+    locate(v, level, offset);
+    return offset % 3 == 0 ? OpLabel::ADD : OpLabel::MUL;
+}
+
+int DWTView::get_out_degree(int v) const {
+    if (v < 4) {
+        return n - (n >> levels);
+    }
+    if (v < 4 + n) {
+        return 2;
+    }
+    int level = 0;
+    int offset = 0;
+    locate(v, level, offset);
+    if (offset % 3 != 0) {
+        return 1;
+    }
+    return offset % 6 == 0 && level < levels ? 2 : 0;
+}
+
+int DWTView::get_level(int v) const {
+    if (v < 4 + n) {
+        return 0;
+    }
+    int level = 0;
+    int offset = 0;
+    locate(v, level, offset);
+    return offset % 3 == 0 ? 2 * level : 2 * level - 1;
+}
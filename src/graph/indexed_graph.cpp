@@ -0,0 +1,164 @@
+#include <mcis/indexed_graph.h>
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+IndexedGraph::IndexedGraph(const Graph& graph) {
+    const auto& nodes = graph.get_nodes();
+    const int n = static_cast<int>(nodes.size());
+
+    // Sorted by ID through pointers, so neither IDs nor nodes are looked up again by string
+    std::vector<std::pair<const std::string*, const Node*>> sorted;
+    sorted.reserve(n);
+    for (const auto& [id, node] : nodes) {
+        sorted.emplace_back(&id, node);
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const auto& a, const auto& b) { return *a.first < *b.first; });
+
+    ids.reserve(n);
+    index.reserve(n);
+    labels.resize(n);
+    std::unordered_map<const Node*, int> position;
+    position.reserve(n);
+    for (int v = 0; v < n; ++v) {
+        ids.push_back(*sorted[v].first);
+        index.emplace(ids[v], v);
+        labels[v] = sorted[v].second->get_label();
+        position.emplace(sorted[v].second, v);
+    }
+
+    // Outgoing rows, sorted by child index in build
+    std::vector<std::vector<std::pair<int, int>>> rows(n);
+    for (int v = 0; v < n; ++v) {
+        const ChildList& children = sorted[v].second->get_children();
+        rows[v].reserve(children.size());
+        for (const auto& [child, weight] : children) {
+            rows[v].emplace_back(position.at(child), weight);
+        }
+    }
+    build(rows);
+}
+
+IndexedGraph::IndexedGraph(std::vector<std::string> node_ids, std::vector<OpLabel> node_labels,
+                           const std::vector<std::tuple<int, int, int>>& edges)
+    : ids(std::move(node_ids)), labels(std::move(node_labels)) {
+    const int n = static_cast<int>(ids.size());
+    index.reserve(n);
+    for (int v = 0; v < n; ++v) {
+        index[ids[v]] = v;
+    }
+    std::vector<std::vector<std::pair<int, int>>> rows(n);
+    for (const auto& [source, target, weight] : edges) {
+        rows[source].emplace_back(target, weight);
+    }
+    build(rows);
+}
+
+void IndexedGraph::build(std::vector<std::vector<std::pair<int, int>>>& rows) {
+    const int n = static_cast<int>(rows.size());
+    size_t num_edges = 0;
+    for (const auto& row : rows) {
+        num_edges += row.size();
+    }
+    out_targets.reserve(num_edges);
+    out_weights.reserve(num_edges);
+    out_offsets.assign(n + 1, 0);
+    for (int v = 0; v < n; ++v) {
+        std::sort(rows[v].begin(), rows[v].end());
+        for (const auto& [child, weight] : rows[v]) {
+            out_targets.push_back(child);
+            out_weights.push_back(weight);
+            weighted = weighted || (weight != 0);
+        }
+        out_offsets[v + 1] = static_cast<int>(out_targets.size());
+    }
+
+    // Incoming rows by counting sort; sources come out ascending because rows are scanned in order
+    in_offsets.assign(n + 1, 0);
+    for (int target : out_targets) {
+        in_offsets[target + 1]++;
+    }
+    for (int v = 0; v < n; ++v) {
+        in_offsets[v + 1] += in_offsets[v];
+    }
+    in_sources.resize(out_targets.size());
+    std::vector<int> cursor(in_offsets.begin(), in_offsets.end() - 1);
+    for (int u = 0; u < n; ++u) {
+        for (int e = out_offsets[u]; e < out_offsets[u + 1]; ++e) {
+            in_sources[cursor[out_targets[e]]++] = u;
+        }
+    }
+
+    // Longest-path levels with Kahn's algorithm; a leftover node means a cycle
+    std::vector<int> pending(n);
+    std::vector<int> queue;
+    std::vector<int> level(n, 0);
+    queue.reserve(n);
+    for (int v = 0; v < n; ++v) {
+        pending[v] = get_in_degree(v);
+        if (pending[v] == 0) {
+            queue.push_back(v);
+        }
+    }
+    for (size_t head = 0; head < queue.size(); ++head) {
+        const int u = queue[head];
+        num_levels = std::max(num_levels, level[u] + 1);
+        for (int child : get_children(u)) {
+            level[child] = std::max(level[child], level[u] + 1);
+            if (--pending[child] == 0) {
+                queue.push_back(child);
+            }
+        }
+    }
+    if (static_cast<int>(queue.size()) == n) {
+        levels = std::move(level);
+    } else {
+        num_levels = 0;
+    }
+}
+
+IndexedGraph IndexedGraph::reordered(const std::vector<int>& order) const {
+    const int n = get_num_nodes();
+    std::vector<int> rank(n);
+    for (int i = 0; i < n; ++i) {
+        rank[order[i]] = i;
+    }
+
+    IndexedGraph result;
+    result.ids.reserve(n);
+    result.labels.reserve(n);
+    result.index.reserve(n);
+    std::vector<std::vector<std::pair<int, int>>> rows(n);
+    for (int i = 0; i < n; ++i) {
+        const int v = order[i];
+        result.ids.push_back(ids[v]);
+        result.index.emplace(ids[v], i);
+        result.labels.push_back(labels[v]);
+        rows[i].reserve(get_out_degree(v));
+        for_each_child(v,
+                       [&](int child, int weight) { rows[i].emplace_back(rank[child], weight); });
+    }
+    result.build(rows);
+    return result;
+}
+
+int IndexedGraph::get_index(const std::string& id) const {
+    auto it = index.find(id);
+    return it == index.end() ? -1 : it->second;
+}
+
+bool IndexedGraph::has_edge(int u, int v) const {
+    auto children = get_children(u);
+    return std::binary_search(children.begin(), children.end(), v);
+}
+
+int IndexedGraph::get_edge_weight(int u, int v) const {
+    auto children = get_children(u);
+    auto it = std::lower_bound(children.begin(), children.end(), v);
+    if (it == children.end() || *it != v) {
+        return 0;
+    }
+    return out_weights[out_offsets[u] + (it - children.begin())];
+}
@@ -9,63 +9,71 @@ Graph Graph::create_mvm_graph_from_mat_vec(const std::vector<std::vector<std::st
         return graph;
     }
 
-    // Reserve space for better performance
-    graph.reserve_nodes(m * n + n + m * n + m * (n - 1));
+    // Reserve space: inputs, products and accumulators, with three edges per product and one per
+    // accumulation step
+    BatchEdit batch(graph);
+    batch.reserve(m * n + n + m * n + m * (n - 1), 3 * m * n + m * (n - 1));
+
+    // Caller-supplied IDs may repeat, in which case they name the same node
+    auto add = [&](const std::string& id, OpLabel label) {
+        const int handle = batch.add_node(id, label);
+        return handle >= 0 ? handle : batch.node(id);
+    };
 
     // S1: Add input nodes (matrix elements and vector elements)
+    std::vector<std::vector<int>> mat_nodes(m, std::vector<int>(n));
+    std::vector<int> vec_nodes(n);
     for (int i = 0; i < m; ++i) {
         for (int j = 0; j < n; ++j) {
-            graph.add_node(mat[i][j]);
+            mat_nodes[i][j] = add(mat[i][j], OpLabel::INPUT);
         }
     }
     for (int j = 0; j < n; ++j) {
-        graph.add_node(vec[j]);
+        vec_nodes[j] = add(vec[j], OpLabel::INPUT);
     }
 
     // S2: Add product nodes
+    std::vector<std::vector<int>> product_nodes(m, std::vector<int>(n));
     for (int i = 0; i < m; ++i) {
         for (int j = 0; j < n; ++j) {
-            std::string product_node = "p" + std::to_string(i) + "," + std::to_string(j);
-            graph.add_node(product_node);
+            product_nodes[i][j] =
+                add("p" + std::to_string(i) + "," + std::to_string(j), OpLabel::MUL);
         }
     }
 
-    // S3 to S_{n+1}: Add accumulation nodes
+    // S3 to S_{n+1}: Add accumulation nodes (none if n = 1, leaving invalid handles)
+    std::vector<std::vector<int>> acc_nodes(n + 3, std::vector<int>(m, -1));
     for (int set = 3; set <= n + 1; ++set) {
         for (int i = 0; i < m; ++i) {
-            std::string acc_node = "acc" + std::to_string(set) + "," + std::to_string(i);
-            graph.add_node(acc_node);
+            acc_nodes[set][i] =
+                add("acc" + std::to_string(set) + "," + std::to_string(i), OpLabel::ADD);
         }
     }
 
     // Rule 1: Edges from S1 inputs to S2 products
     for (int i = 0; i < m; ++i) {
         for (int j = 0; j < n; ++j) {
-            std::string product_node = "p" + std::to_string(i) + "," + std::to_string(j);
             // Matrix element to product
-            graph.add_edge(mat[i][j], product_node, 0);
+            batch.add_edge(mat_nodes[i][j], product_nodes[i][j], 0);
             // Vector element to product
-            graph.add_edge(vec[j], product_node, 0);
+            batch.add_edge(vec_nodes[j], product_nodes[i][j], 0);
         }
     }
 
     // Rule 2: Edges from S2 products to S3 accumulation
     for (int i = 0; i < m; ++i) {
         for (int j = 0; j < n; ++j) {
-            std::string product_node = "p" + std::to_string(i) + "," + std::to_string(j);
-            std::string acc_node = "acc3," + std::to_string(i);
-            graph.add_edge(product_node, acc_node, 0);
+            batch.add_edge(product_nodes[i][j], acc_nodes[3][i], 0);
         }
     }
 
     // Rule 3: Edges between accumulation sets (S3 -> S4 -> ... -> S_{n+1})
     for (int set = 3; set < n + 1; ++set) {
         for (int i = 0; i < m; ++i) {
-            std::string from_node = "acc" + std::to_string(set) + "," + std::to_string(i);
-            std::string to_node = "acc" + std::to_string(set + 1) + "," + std::to_string(i);
-            graph.add_edge(from_node, to_node, 0);
+            batch.add_edge(acc_nodes[set][i], acc_nodes[set + 1][i], 0);
         }
     }
+    batch.commit();
 
     return graph;
 }
@@ -1,44 +1,170 @@
 #include <mcis/node.h>
 
 #include <algorithm>
+#include <functional>
 #include <iomanip>
+#include <utility>
 #include <vector>
 
-Node::Node(const std::string& id) : id(std::move(id)), num_parents(0), num_children(0) {};
+const char* op_label_name(OpLabel label) {
+    switch (label) {
+        case OpLabel::INPUT:
+            return "input";
+        case OpLabel::COEFF:
+            return "coeff";
+        case OpLabel::TWIDDLE:
+            return "twiddle";
+        case OpLabel::MUL:
+            return "mul";
+        case OpLabel::ADD:
+            return "add";
+        case OpLabel::SUB:
+            return "sub";
+        default:
+            return "none";
+    }
+}
+
+uint32_t ChildList::lower_bound(const Node* child) const {
+    const value_type* entries = data();
+    uint32_t low = 0;
+    uint32_t high = count;
+    while (low < high) {
+        const uint32_t mid = (low + high) / 2;
+        if (std::less<const Node*>()(entries[mid].first, child)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+void ChildList::release() {
+    if (!is_inline()) {
+        delete[] heap;
+        capacity = NODE_INLINE_CHILDREN;
+    }
+}
+
+ChildList::ChildList(const ChildList& other) : heap(nullptr) { *this = other; }
+
+ChildList& ChildList::operator=(const ChildList& other) {
+    if (this != &other) {
+        count = 0;
+        reserve(other.count);
+        std::copy(other.begin(), other.end(), data());
+        count = other.count;
+    }
+    return *this;
+}
+
+ChildList::ChildList(ChildList&& other) noexcept : heap(nullptr) { *this = std::move(other); }
+
+ChildList& ChildList::operator=(ChildList&& other) noexcept {
+    if (this != &other) {
+        release();
+        count = other.count;
+        capacity = other.capacity;
+        if (other.is_inline()) {
+            std::copy(other.inline_entries, other.inline_entries + other.count, inline_entries);
+        } else {
+            heap = other.heap;
+            other.capacity = NODE_INLINE_CHILDREN;
+        }
+        other.count = 0;
+    }
+    return *this;
+}
+
+ChildList::~ChildList() { release(); }
+
+ChildList::const_iterator ChildList::find(const Node* child) const {
+    const uint32_t position = lower_bound(child);
+    return position < count && data()[position].first == child ? data() + position : end();
+}
+
+bool ChildList::insert(Node* child, int weight) {
+    const uint32_t position = lower_bound(child);
+    if (position < count && data()[position].first == child) {
+        return false;
+    }
+    if (count == capacity) {
+        reserve(static_cast<size_t>(capacity) * 2);
+    }
+    value_type* entries = data();
+    std::copy_backward(entries + position, entries + count, entries + count + 1);
+    entries[position] = {child, weight};
+    count++;
+    return true;
+}
+
+bool ChildList::erase(const Node* child) {
+    const uint32_t position = lower_bound(child);
+    value_type* entries = data();
+    if (position == count || entries[position].first != child) {
+        return false;
+    }
+    std::copy(entries + position + 1, entries + count, entries + position);
+    count--;
+    return true;
+}
+
+bool ChildList::assign(const Node* child, int weight) {
+    const uint32_t position = lower_bound(child);
+    if (position == count || data()[position].first != child) {
+        return false;
+    }
+    data()[position].second = weight;
+    return true;
+}
+
+void ChildList::reserve(size_t new_capacity) {
+    if (new_capacity <= capacity) {
+        return;
+    }
+    auto* entries = new value_type[new_capacity];
+    std::copy(begin(), end(), entries);
+    release();
+    heap = entries;
+    capacity = static_cast<uint32_t>(new_capacity);
+}
+
+void ChildList::clear() {
+    release();
+    count = 0;
+}
+
+Node::Node(const std::string& id, OpLabel label) : id(id), num_parents(0), label(label) {};
 
 Node::Node(const Node& other)
-    : id(other.id),
-      num_parents(other.num_parents),
-      num_children(other.num_children),
-      children(other.children) {};
+    : id(other.id), children(other.children), num_parents(other.num_parents), label(other.label) {};
 
 Node& Node::operator=(const Node& other) {
     if (this != &other) {
         id = other.id;
-        num_parents = other.num_parents;
-        num_children = other.num_children;
         children = other.children;
+        num_parents = other.num_parents;
+        label = other.label;
     }
     return *this;
 }
 
 Node::Node(Node&& other) noexcept
     : id(std::move(other.id)),
+      children(std::move(other.children)),
       num_parents(other.num_parents),
-      num_children(other.num_children),
-      children(std::move(other.children)) {
+      label(other.label) {
     other.num_parents = 0;
-    other.num_children = 0;
 }
 
 Node& Node::operator=(Node&& other) noexcept {
     if (this != &other) {
         id = std::move(other.id);
-        num_parents = other.num_parents;
-        num_children = other.num_children;
         children = std::move(other.children);
+        num_parents = other.num_parents;
+        label = other.label;
         other.num_parents = 0;
-        other.num_children = 0;
     }
     return *this;
 }
@@ -47,74 +173,81 @@ Node::~Node() { children.clear(); }
 
 std::string Node::get_id() const { return id; }
 
+OpLabel Node::get_label() const { return label; }
+
+void Node::set_label(OpLabel new_label) { label = new_label; }
+
 int Node::get_num_parents() const { return num_parents; }
 
-int Node::get_num_children() const { return num_children; }
+int Node::get_num_children() const { return static_cast<int>(children.size()); }
 
 bool Node::add_edge(Node* neighbor, int weight) {
-    if (children.find(neighbor) != children.end()) {
-        return (children[neighbor] == weight) ? true : false;
+    auto it = children.find(neighbor);
+    if (it != children.end()) {
+        return it->second == weight;
     }
     if (id == neighbor->id) {
         return false;
     }
-    children[neighbor] = weight;
-    num_children++;
+    children.insert(neighbor, weight);
     neighbor->num_parents++;
     return true;
 }
 
+void Node::reserve_children(size_t count) { children.reserve(count); }
+
 bool Node::remove_edge(Node* neighbor) {
-    if (children.find(neighbor) == children.end()) {
+    if (!children.erase(neighbor)) {
         return false;
     }
-    children.erase(neighbor);
-    num_children--;
     neighbor->num_parents--;
     return true;
 }
 
 bool Node::change_edge_weight(Node* neighbor, int new_weight) {
-    if (children.find(neighbor) == children.end()) {
-        return false;
-    }
-    children[neighbor] = new_weight;
-    return true;
+    return children.assign(neighbor, new_weight);
 }
 
-bool Node::contains_edge(Node* neighbor) const { return children.find(neighbor) != children.end(); }
+bool Node::contains_edge(Node* neighbor) const { return children.contains(neighbor); }
 
 bool Node::is_source() const { return num_parents == 0; }
 
-bool Node::is_sink() const { return num_children == 0; }
+bool Node::is_sink() const { return children.empty(); }
 
 bool Node::operator==(const Node& other) const {
-    bool same
-        = num_parents == other.num_parents && id == other.id && num_children == other.num_children;
+    if (num_parents != other.num_parents || id != other.id || label != other.label
+        || children.size() != other.children.size()) {
+        return false;
+    }
 
-    for (const auto& [child, weight] : children) {
-        auto it = other.children.find(child);
-        if (it == other.children.end() || it->second != weight) {
-            return false;
+    // Children are matched by ID, so nodes of different graphs (e.g. copies) compare equal
+    auto edges = [](const Node& node) {
+        std::vector<std::pair<std::string, int>> sorted;
+        sorted.reserve(node.children.size());
+        for (const auto& [child, weight] : node.children) {
+            sorted.emplace_back(child->id, weight);
         }
-    }
-    return same;
+        std::sort(sorted.begin(), sorted.end());
+        return sorted;
+    };
+    return edges(*this) == edges(other);
 }
 
 bool Node::same_id(const Node& other) const { return id == other.id; }
 
-const std::unordered_map<Node*, int>& Node::get_children() const { return children; }
+const ChildList& Node::get_children() const { return children; }
 
 std::ostream& operator<<(std::ostream& os, const Node& node) {
-    os << node.id << " -> { ";
-    std::vector<Node*> keys(node.children.size());
-    int idx = 0;
-    for (const auto& [key, _] : node.children) {
-        keys[idx++] = key;
+    os << node.id;
+    if (node.label != OpLabel::NONE) {
+        os << " [" << op_label_name(node.label) << "]";
     }
-    std::sort(keys.begin(), keys.end(), [](Node* a, Node* b) { return a->id < b->id; });
-    for (const auto key : keys) {
-        os << std::quoted(key->id) << "(" << node.children.at(key) << ") ";
+    os << " -> { ";
+    std::vector<ChildList::value_type> edges(node.children.begin(), node.children.end());
+    std::sort(edges.begin(), edges.end(),
+              [](const auto& a, const auto& b) { return a.first->id < b.first->id; });
+    for (const auto& [child, weight] : edges) {
+        os << std::quoted(child->id) << "(" << weight << ") ";
     }
     os << "}\n";
     return os;
@@ -122,16 +255,14 @@ std::ostream& operator<<(std::ostream& os, const Node& node) {
 
 void Node::print_full() const {
     std::cout << "Node ID: " << id << "\n";
+    std::cout << "Label: " << op_label_name(label) << "\n";
     std::cout << "Number of Parents: " << num_parents << "\n";
-    std::cout << "Number of Children: " << num_children << "\n";
+    std::cout << "Number of Children: " << children.size() << "\n";
     std::cout << "Children:\n";
-    std::vector<Node*> keys(children.size());
-    int idx = 0;
-    for (const auto& [key, _] : children) {
-        keys[idx++] = key;
-    }
-    std::sort(keys.begin(), keys.end(), [](Node* a, Node* b) { return a->get_id() < b->get_id(); });
-    for (const auto key : keys) {
-        std::cout << "  Child ID: " << key->get_id() << ", Weight: " << children.at(key) << "\n";
+    std::vector<ChildList::value_type> edges(children.begin(), children.end());
+    std::sort(edges.begin(), edges.end(),
+              [](const auto& a, const auto& b) { return a.first->id < b.first->id; });
+    for (const auto& [child, weight] : edges) {
+        std::cout << "  Child ID: " << child->id << ", Weight: " << weight << "\n";
     }
 }
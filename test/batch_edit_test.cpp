@@ -0,0 +1,124 @@
+#include <sstream>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+
+class BatchEditTest : public ::testing::Test {
+protected:
+    static std::string printed(const Graph& graph) {
+        std::ostringstream out;
+        out << graph;
+        return out.str();
+    }
+};
+
+// Test 1: A batch builds the same graph as individual calls, with a single version bump
+TEST_F(BatchEditTest, MatchesIndividualCalls) {
+    Graph expected;
+    expected.add_node_set({"a", "b", "c"}, OpLabel::INPUT);
+    expected.add_node("d", OpLabel::ADD);
+    expected.add_edge("a", "d", 0);
+    expected.add_edge("b", "d", 2);
+    expected.add_edge("c", "d", 0);
+    expected.add_edge("a", "b", 0);
+
+    Graph graph;
+    graph.add_node_set({"a", "b", "c"}, OpLabel::INPUT);
+    EXPECT_TRUE(graph.is_dag());
+    const int version = graph.get_version();
+    {
+        Graph::BatchEdit batch(graph);
+        batch.reserve(1, 4);
+        const int d = batch.add_node("d", OpLabel::ADD);
+        ASSERT_GE(d, 0);
+        EXPECT_TRUE(batch.add_edge(batch.node("a"), d, 0));
+        EXPECT_TRUE(batch.add_edge("b", "d", 2));
+        EXPECT_TRUE(batch.add_edge("c", "d", 0));
+        EXPECT_TRUE(batch.add_edge("a", "b", 0));
+
+        // Nothing is visible before the commit
+        EXPECT_EQ(graph.get_node("d"), nullptr);
+        EXPECT_EQ(graph.get_version(), version);
+    }
+    EXPECT_EQ(graph.get_version(), version + 1);
+    EXPECT_EQ(printed(graph), printed(expected));
+    EXPECT_EQ(graph.get_node("d")->get_num_parents(), 3);
+    EXPECT_TRUE(graph.is_dag());
+
+    // Generators build through batches
+    Graph fft = Graph::create_fft_graph(8);
+    EXPECT_EQ(fft.get_num_nodes(), 8 + 4 + 3 * 12);
+    EXPECT_TRUE(fft.is_dag());
+
+    // An empty commit changes nothing
+    Graph::BatchEdit idle(graph);
+    EXPECT_EQ(idle.commit(), 0);
+    EXPECT_EQ(graph.get_version(), version + 1);
+}
+
+// Test 2: Repeated operations on an edge have the same effect as applying them one by one
+TEST_F(BatchEditTest, NetEffect) {
+    Graph graph;
+    graph.add_node_set({"a", "b", "c", "d"});
+    graph.add_edge("a", "b", 1);
+    graph.add_edge("a", "c", 1);
+
+    Graph::BatchEdit batch(graph);
+    const int a = batch.node("a");
+    const int b = batch.node("b");
+    const int c = batch.node("c");
+    const int d = batch.node("d");
+    EXPECT_EQ(batch.node("missing"), -1);
+    EXPECT_EQ(batch.add_node("a"), -1);
+    EXPECT_FALSE(batch.add_edge(a, a, 0));
+    EXPECT_FALSE(batch.add_edge(a, 17, 0));
+    EXPECT_FALSE(batch.add_edge("a", "missing", 0));
+
+    batch.add_edge(a, b, 5);  // existing edge keeps weight 1
+    batch.remove_edge(a, c);  // removed, then re-added with weight 7
+    batch.add_edge(a, c, 7);
+    batch.add_edge(a, c, 9);
+    batch.add_edge(a, d, 3);  // added, then removed
+    batch.remove_edge(a, d);
+    batch.add_edge(b, d, 4);  // first addition wins
+    batch.add_edge(b, d, 6);
+    batch.remove_edge(c, d);  // missing edge: no effect
+    EXPECT_EQ(batch.commit(), 1);
+
+    Node* na = graph.get_node("a");
+    EXPECT_EQ(na->get_children().at(graph.get_node("b")), 1);
+    EXPECT_EQ(na->get_children().at(graph.get_node("c")), 7);
+    EXPECT_FALSE(na->contains_edge(graph.get_node("d")));
+    EXPECT_EQ(graph.get_node("b")->get_children().at(graph.get_node("d")), 4);
+    EXPECT_EQ(graph.get_node("d")->get_num_parents(), 1);
+    EXPECT_EQ(graph.get_node("c")->get_num_parents(), 1);
+}
+
+// Test 3: Node removals apply last and drop every edge touching the node
+TEST_F(BatchEditTest, NodeRemoval) {
+    Graph graph;
+    graph.add_node_set({"a", "b", "c"});
+    graph.add_edge("a", "b", 0);
+    graph.add_edge("b", "c", 0);
+
+    Graph::BatchEdit batch(graph);
+    const int e = batch.add_node("e");
+    batch.add_edge(batch.node("a"), e, 0);
+    batch.add_edge(e, batch.node("c"), 0);
+    EXPECT_TRUE(batch.remove_node(batch.node("b")));
+    EXPECT_TRUE(batch.remove_node(batch.node("b")));
+    batch.add_edge(batch.node("c"), batch.node("b"), 0);
+    EXPECT_FALSE(batch.remove_node(-1));
+    batch.commit();
+
+    EXPECT_EQ(graph.get_num_nodes(), 3);
+    EXPECT_EQ(graph.get_node("b"), nullptr);
+    EXPECT_EQ(graph.get_node("a")->get_num_children(), 1);
+    EXPECT_EQ(graph.get_node("c")->get_num_parents(), 1);
+    EXPECT_EQ(graph.get_node("c")->get_num_children(), 0);
+
+    // Bulk removal counts repeated IDs once
+    EXPECT_EQ(graph.remove_nodes_bulk({"a", "a", "missing"}), 1);
+    EXPECT_EQ(graph.get_node("e")->get_num_parents(), 0);
+}
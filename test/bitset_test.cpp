@@ -0,0 +1,129 @@
+#include "mcis/bitset.h"
+
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+class BitsetTest : public ::testing::Test {
+protected:
+    void SetUp() override { original_level = BitsetKernels::get_simd_level(); }
+
+    void TearDown() override { BitsetKernels::set_simd_level(original_level); }
+
+    /**
+     * @brief All SIMD levels supported by the running CPU.
+     */
+    static std::vector<SimdLevel> supported_levels() {
+        std::vector<SimdLevel> levels = {SimdLevel::SCALAR};
+        const SimdLevel best = BitsetKernels::detect_simd_level();
+        if (best == SimdLevel::AVX2 || best == SimdLevel::AVX512) {
+            levels.push_back(SimdLevel::AVX2);
+        }
+        if (best == SimdLevel::AVX512) {
+            levels.push_back(SimdLevel::AVX512);
+        }
+        return levels;
+    }
+
+    static Bitset random_bitset(size_t bits, std::mt19937_64& rng, double density) {
+        Bitset result(bits);
+        std::bernoulli_distribution coin(density);
+        for (size_t i = 0; i < bits; ++i) {
+            if (coin(rng)) {
+                result.set(i);
+            }
+        }
+        return result;
+    }
+
+    SimdLevel original_level = SimdLevel::SCALAR;
+};
+
+// Test 1: Basic single-bit operations and iteration
+TEST_F(BitsetTest, SetResetTestAndIterate) {
+    Bitset bits(130);
+    EXPECT_EQ(bits.num_words(), 3u);
+    EXPECT_FALSE(bits.any());
+    EXPECT_EQ(bits.find_first(), -1);
+
+    bits.set(0);
+    bits.set(64);
+    bits.set(129);
+    EXPECT_TRUE(bits.test(64));
+    EXPECT_EQ(bits.count(), 3u);
+    EXPECT_EQ(bits.find_first(), 0);
+    EXPECT_EQ(bits.find_next(0), 64);
+    EXPECT_EQ(bits.find_next(64), 129);
+    EXPECT_EQ(bits.find_next(129), -1);
+
+    std::vector<size_t> seen;
+    bits.for_each([&](size_t i) { seen.push_back(i); });
+    EXPECT_EQ(seen, (std::vector<size_t>{0, 64, 129}));
+
+    bits.reset(64);
+    EXPECT_FALSE(bits.test(64));
+    bits.set_all();
+    EXPECT_EQ(bits.count(), 130u);
+    bits.clear();
+    EXPECT_FALSE(bits.any());
+}
+
+// Test 2: Every SIMD level agrees with a bit-by-bit reference on all kernels
+TEST_F(BitsetTest, KernelsMatchReferenceAtEveryLevel) {
+    std::mt19937_64 rng(42);
+    for (size_t bits : {1u, 63u, 64u, 200u, 256u, 511u, 1000u, 4099u}) {
+        const Bitset a = random_bitset(bits, rng, 0.3);
+        const Bitset b = random_bitset(bits, rng, 0.6);
+
+        size_t and_ref = 0, andnot_ref = 0, count_ref = 0;
+        long first_and_ref = -1;
+        for (size_t i = 0; i < bits; ++i) {
+            count_ref += a.test(i);
+            and_ref += a.test(i) && b.test(i);
+            andnot_ref += a.test(i) && !b.test(i);
+            if (first_and_ref < 0 && a.test(i) && b.test(i)) {
+                first_and_ref = static_cast<long>(i);
+            }
+        }
+
+        for (SimdLevel level : supported_levels()) {
+            ASSERT_EQ(BitsetKernels::set_simd_level(level), level);
+            const size_t n = a.num_words();
+            EXPECT_EQ(a.count(), count_ref);
+            EXPECT_EQ(a.and_count(b), and_ref);
+            EXPECT_EQ(BitsetKernels::andnot_count(a.data(), b.data(), n), andnot_ref);
+            EXPECT_EQ(BitsetKernels::find_first_and(a.data(), b.data(), n), first_and_ref);
+            EXPECT_EQ(a.intersects(b), and_ref > 0);
+
+            Bitset fused(bits);
+            EXPECT_EQ(fused.assign_and_count(a, b), and_ref);
+            Bitset expected = a;
+            expected &= b;
+            EXPECT_TRUE(fused == expected);
+
+            Bitset difference = a;
+            difference.and_not(b);
+            EXPECT_EQ(difference.count(), andnot_ref);
+
+            Bitset combined = a;
+            combined |= b;
+            EXPECT_EQ(combined.count(), count_ref + b.count() - and_ref);
+        }
+    }
+}
+
+// Test 3: find_first skips long runs of empty words
+TEST_F(BitsetTest, FindFirstInSparseSet) {
+    for (SimdLevel level : supported_levels()) {
+        BitsetKernels::set_simd_level(level);
+        Bitset bits(5000);
+        EXPECT_EQ(bits.find_first(), -1);
+        bits.set(4097);
+        EXPECT_EQ(bits.find_first(), 4097);
+        EXPECT_EQ(bits.find_next(10), 4097);
+        Bitset other(5000);
+        other.set(4097);
+        EXPECT_TRUE(bits.intersects(other));
+    }
+}
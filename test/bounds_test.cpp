@@ -0,0 +1,88 @@
+#include "mcis/bounds.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/graph_summary.h"
+#include "mcis/mcis_algorithm.h"
+
+class BoundsTest : public ::testing::Test {
+protected:
+    static MCISOptions level_options(int offset) {
+        MCISOptions options;
+        options.level_constrained = true;
+        options.max_level_offset = offset;
+        return options;
+    }
+};
+
+// Test 1: The summary is cached and rebuilt after modifications
+TEST_F(BoundsTest, SummaryCache) {
+    Graph graph = Graph::create_mvm_graph_from_dimensions(2, 2);
+    const GraphSummary& summary = graph.get_summary();
+    EXPECT_EQ(&summary, &graph.get_summary());
+    EXPECT_EQ(summary.num_nodes, graph.get_num_nodes());
+    EXPECT_TRUE(summary.dag);
+    EXPECT_EQ(summary.label_counts[static_cast<int>(OpLabel::INPUT)], 6);
+    EXPECT_EQ(summary.label_counts[static_cast<int>(OpLabel::MUL)], 4);
+    EXPECT_EQ(summary.level_histograms[static_cast<int>(OpLabel::ADD)],
+              std::vector<int>({0, 0, 2}));
+
+    graph.add_node("extra", OpLabel::MUL);
+    EXPECT_EQ(graph.get_summary().label_counts[static_cast<int>(OpLabel::MUL)], 5);
+    EXPECT_EQ(graph.get_summary().num_nodes, graph.get_num_nodes());
+}
+
+// Test 2: Degrees and levels tighten the label bound
+TEST_F(BoundsTest, TighterThanLabels) {
+    // A 4-node tournament and 4 isolated nodes share only single nodes
+    Graph dense;
+    Graph sparse;
+    dense.add_node_set({"a", "b", "c", "d"});
+    sparse.add_node_set({"a", "b", "c", "d"});
+    dense.add_edge_set("a", {"b", "c", "d"});
+    dense.add_edge_set("b", {"c", "d"});
+    dense.add_edge("c", "d", 0);
+    const GraphSummary& s1 = dense.get_summary();
+    const GraphSummary& s2 = sparse.get_summary();
+    EXPECT_EQ(MCISBounds::label_bound(s1, s2), 4);
+    EXPECT_EQ(MCISBounds::degree_bound(s1, s2), 1);
+    EXPECT_FALSE(MCISBounds::can_improve(dense, sparse, 1));
+
+    // MVM accumulators sit one level deeper per extra column
+    Graph narrow = Graph::create_mvm_graph_from_dimensions(4, 2);
+    Graph wide = Graph::create_mvm_graph_from_dimensions(2, 3);
+    const MCISOptions options = level_options(0);
+    const int colouring = MCISBounds::colouring_bound(narrow.get_summary(), wide.get_summary(),
+                                                      options);
+    EXPECT_LT(colouring, MCISBounds::label_bound(narrow.get_summary(), wide.get_summary()));
+    EXPECT_LE(colouring, MCISBounds::level_histogram_bound(narrow.get_summary(),
+                                                           wide.get_summary(), options));
+    EXPECT_EQ(MCISBounds::colouring_bound(narrow.get_summary(), wide.get_summary(),
+                                          MCISOptions()),
+              MCISBounds::label_bound(narrow.get_summary(), wide.get_summary()));
+}
+
+// Test 3: Bounds are never below the exact MCIS size
+TEST_F(BoundsTest, BoundsExactSizes) {
+    std::vector<Graph> graphs;
+    graphs.push_back(Graph::create_fft_graph(4));
+    graphs.push_back(Graph::create_mvm_graph_from_dimensions(2, 2));
+    graphs.push_back(Graph::create_mvm_graph_from_dimensions(1, 3));
+    graphs.push_back(Graph::create_dwt_graph(4, 1));
+    for (const MCISOptions& options : {MCISOptions(), level_options(0), level_options(1)}) {
+        MCISAlgorithm algorithm;
+        algorithm.set_options(options);
+        for (const Graph& g1 : graphs) {
+            for (const Graph& g2 : graphs) {
+                auto results = algorithm.run(g1, g2, AlgorithmType::BRON_KERBOSCH_SERIAL);
+                ASSERT_EQ(results.size(), 1u);
+                const int bound = MCISBounds::upper_bound(g1, g2, options);
+                EXPECT_GE(bound, results[0]->get_num_nodes());
+                EXPECT_FALSE(MCISBounds::can_improve(g1, g2, bound, options));
+                delete results[0];
+            }
+        }
+    }
+}
@@ -0,0 +1,176 @@
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../src/algorithms/bron_kerbosch_serial.h"
+#include "../src/algorithms/checkpoint.h"
+#include "../src/algorithms/clique_search.h"
+#include "../src/algorithms/parallel_search.h"
+#include "gtest/gtest.h"
+#include "mcis/bitset.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+#include "mcis/vf3.h"
+#include "test_graphs.h"
+
+class CheckpointTest : public ::testing::Test {
+protected:
+    static std::string temp_path(const std::string& name) { return ::testing::TempDir() + name; }
+};
+
+// Test 1: Checkpoints survive a save/load round trip and malformed files are rejected
+TEST_F(CheckpointTest, RoundTrip) {
+    SearchCheckpoint checkpoint;
+    checkpoint.fingerprint = 0x0123456789abcdefULL;
+    checkpoint.num_vertices = 1000;
+    checkpoint.best_size = 3;
+    checkpoint.best = {7, 500, 999};
+    checkpoint.nodes_explored = 1LL << 40;
+    checkpoint.frontier = {{{7}, {8, 9, 300}}, {{}, {0, 1, 2, 3}}};
+    const std::string path = temp_path("round_trip.ckp");
+    ASSERT_TRUE(checkpoint.save(path));
+
+    SearchCheckpoint loaded;
+    ASSERT_TRUE(loaded.load(path));
+    EXPECT_EQ(loaded.fingerprint, checkpoint.fingerprint);
+    EXPECT_EQ(loaded.num_vertices, 1000);
+    EXPECT_EQ(loaded.best_size, 3);
+    EXPECT_EQ(loaded.best, checkpoint.best);
+    EXPECT_EQ(loaded.nodes_explored, checkpoint.nodes_explored);
+    ASSERT_EQ(loaded.frontier.size(), 2u);
+    EXPECT_EQ(loaded.frontier[0].clique, std::vector<int>({7}));
+    EXPECT_EQ(loaded.frontier[0].candidates, std::vector<int>({8, 9, 300}));
+    EXPECT_EQ(loaded.frontier[1].candidates, std::vector<int>({0, 1, 2, 3}));
+
+    // Truncated files and files with a wrong header leave the checkpoint untouched
+    std::ifstream in(path, std::ios::binary);
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << data.substr(0, data.size() - 1);
+    EXPECT_FALSE(loaded.load(path));
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << "X" << data.substr(1);
+    EXPECT_FALSE(loaded.load(path));
+    EXPECT_EQ(loaded.best, checkpoint.best);
+    EXPECT_FALSE(loaded.load(temp_path("missing.ckp")));
+    std::remove(path.c_str());
+}
+
+// Test 2: The frontier left by an interrupted search resumes to the same maximum clique
+TEST_F(CheckpointTest, InterruptedSearchResumes) {
+    const int n = 80;
+    auto adjacency = random_graph(n, 50, 3);
+    Bitset all(n);
+    all.set_all();
+    MaxCliqueSearch<Bitset> reference(adjacency.data(), Bitset(n));
+    const int expected = reference.run(all);
+
+    // Interrupt after a few hundred descents and collect the unexplored search nodes
+    MaxCliqueSearch<Bitset> search(adjacency.data(), Bitset(n));
+    std::atomic<bool> interrupt(false);
+    int descents = 0;
+    search.set_split([&](const std::vector<int>&, const Bitset&, size_t) {
+        if (++descents == 300) {
+            interrupt.store(true);
+        }
+        return false;
+    });
+    SearchCheckpoint checkpoint;
+    checkpoint.num_vertices = n;
+    search.set_interrupt(&interrupt, [&](const std::vector<int>& clique, const Bitset& next,
+                                         size_t) {
+        std::vector<int> candidates;
+        next.for_each([&](size_t v) { candidates.push_back(static_cast<int>(v)); });
+        checkpoint.frontier.push_back({clique, candidates});
+        return true;
+    });
+    checkpoint.best_size = search.run(all);
+    search.get_best().for_each([&](size_t v) { checkpoint.best.push_back(static_cast<int>(v)); });
+    ASSERT_FALSE(checkpoint.frontier.empty());
+    EXPECT_LE(checkpoint.best_size, expected);
+
+    const std::string path = temp_path("interrupted.ckp");
+    ASSERT_TRUE(checkpoint.save(path));
+    SearchCheckpoint loaded;
+    ASSERT_TRUE(loaded.load(path));
+    ParallelCliqueSearch<Bitset> resumed(adjacency.data(), Bitset(n), 2);
+    resumed.set_checkpoint("", 0.0, 0, n);
+    EXPECT_EQ(resumed.resume(loaded), expected);
+    EXPECT_EQ(static_cast<int>(resumed.get_best().count()), expected);
+
+    // Checkpoints of another instance are refused
+    resumed.set_checkpoint("", 0.0, 1, n);
+    EXPECT_EQ(resumed.resume(loaded), -1);
+
+    // Periodic checkpoints of a running search end with an empty frontier and the optimum
+    ParallelCliqueSearch<Bitset> periodic(adjacency.data(), Bitset(n), 2);
+    periodic.set_checkpoint(path, 0.0, 5, n);
+    EXPECT_EQ(periodic.run(all), expected);
+    EXPECT_GE(periodic.get_checkpoints_written(), 1);
+    ASSERT_TRUE(loaded.load(path));
+    EXPECT_EQ(loaded.fingerprint, 5u);
+    EXPECT_EQ(loaded.best_size, expected);
+    EXPECT_TRUE(loaded.frontier.empty());
+    std::remove(path.c_str());
+}
+
+// Test 3: MCISAlgorithm checkpoints exact searches and resumes them by path
+TEST_F(CheckpointTest, AlgorithmResume) {
+    Graph g1 = Graph::create_fft_graph(4);
+    Graph g2 = Graph::create_dwt_graph(4, 2);
+    BronKerboschSerial reference;
+    const int expected = reference.find_mapping(g1, g2).size();
+
+    const std::string path = temp_path("algorithm.ckp");
+    MCISOptions options;
+    options.checkpoint_path = path;
+    options.checkpoint_interval = 0.0;
+    MCISAlgorithm algorithm;
+    algorithm.set_options(options);
+    auto first = algorithm.run(g1, g2, AlgorithmType::BRON_KERBOSCH_SERIAL);
+    ASSERT_EQ(first.size(), 1u);
+    EXPECT_EQ(first[0]->get_num_nodes(), expected);
+
+    SearchCheckpoint checkpoint;
+    ASSERT_TRUE(checkpoint.load(path));
+    EXPECT_EQ(checkpoint.best_size, expected);
+    EXPECT_TRUE(checkpoint.frontier.empty());
+
+    // Resuming a finished search returns its result; other instances' checkpoints are ignored
+    MCISAlgorithm resumer;
+    auto resumed = resumer.run(g1, g2, AlgorithmType::BRON_KERBOSCH_PARALLEL, path);
+    ASSERT_EQ(resumed.size(), 1u);
+    EXPECT_EQ(resumed[0]->get_num_nodes(), expected);
+    EXPECT_TRUE(VF3Matcher::is_induced_subgraph(*resumed[0], g2));
+    auto fresh = resumer.run(g2, g1, AlgorithmType::BRON_KERBOSCH_PARALLEL, path);
+    ASSERT_EQ(fresh.size(), 1u);
+    EXPECT_EQ(fresh[0]->get_num_nodes(), expected);
+    for (Graph* graph : {first[0], resumed[0], fresh[0]}) {
+        delete graph;
+    }
+    std::remove(path.c_str());
+}
+
+// Test 4: Sub-instances solved side by side neither share nor resume the caller's checkpoint
+TEST_F(CheckpointTest, SubproblemsSkipCheckpoints) {
+    Graph g1 = Graph::create_fft_graph(4);
+    Graph g2 = Graph::create_dwt_graph(4, 2);
+    BronKerboschSerial reference;
+    const int expected = reference.find_mapping(g1, g2).size();
+
+    const std::string path = temp_path("multi.ckp");
+    std::remove(path.c_str());
+    MCISOptions options;
+    options.checkpoint_path = path;
+    options.checkpoint_interval = 0.0;
+    options.resume_path = path;
+    MCISAlgorithm algorithm;
+    algorithm.set_options(options);
+    auto results = algorithm.run_multi({&g1, &g2, &g2});
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0]->get_num_nodes(), expected);
+    EXPECT_FALSE(std::ifstream(path).good());
+    EXPECT_FALSE(std::ifstream(path + ".tmp").good());
+    delete results[0];
+}
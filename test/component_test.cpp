@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "../src/algorithms/assignment.h"
+#include "../src/algorithms/component_mcis.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+#include "mcis/vf3.h"
+
+class ComponentTest : public ::testing::Test {
+protected:
+    // Appends a labelled fan-in piece: inputs feeding a multiply, then an add chain of length k
+    static void add_piece(Graph& graph, const std::string& prefix, int k) {
+        graph.add_node_set({prefix + "x0", prefix + "x1"}, OpLabel::INPUT);
+        graph.add_node(prefix + "m", OpLabel::MUL);
+        graph.add_edge(prefix + "x0", prefix + "m", 0);
+        graph.add_edge(prefix + "x1", prefix + "m", 0);
+        std::string last = prefix + "m";
+        for (int i = 0; i < k; ++i) {
+            std::string add = prefix + "a" + std::to_string(i);
+            graph.add_node(add, OpLabel::ADD);
+            graph.add_edge(last, add, 0);
+            last = add;
+        }
+    }
+};
+
+// Test 1: Weakly connected components ignore edge direction and come out ordered
+TEST_F(ComponentTest, WeaklyConnectedComponents) {
+    Graph graph;
+    graph.add_node_set({"a", "b", "c", "d", "e", "f"});
+    graph.add_edge("b", "a", 0);
+    graph.add_edge("b", "c", 0);
+    graph.add_edge("f", "d", 0);
+
+    auto components = graph.get_weakly_connected_components();
+    ASSERT_EQ(components.size(), 3u);
+    EXPECT_EQ(components[0], std::vector<std::string>({"a", "b", "c"}));
+    EXPECT_EQ(components[1], std::vector<std::string>({"d", "f"}));
+    EXPECT_EQ(components[2], std::vector<std::string>({"e"}));
+
+    EXPECT_TRUE(Graph().get_weakly_connected_components().empty());
+}
+
+// Test 2: The Hungarian assignment matches brute force on square and rectangular matrices
+TEST_F(ComponentTest, HungarianAssignmentMatchesBruteForce) {
+    std::vector<std::vector<std::vector<long long>>> cases = {
+        {{4, 1, 3}, {2, 0, 5}, {3, 2, 2}},
+        {{7, 3}, {2, 9}, {5, 8}},
+        {{1, 6, 2, 8}, {4, 3, 7, 1}},
+        {{0, 0}, {0, 0}},
+    };
+    for (const auto& weights : cases) {
+        std::vector<int> assignment = HungarianAssignment::solve(weights);
+        ASSERT_EQ(assignment.size(), weights.size());
+
+        long long total = 0;
+        std::vector<bool> used(weights[0].size(), false);
+        for (size_t i = 0; i < weights.size(); ++i) {
+            if (assignment[i] >= 0) {
+                EXPECT_FALSE(used[assignment[i]]);
+                used[assignment[i]] = true;
+                total += weights[i][assignment[i]];
+            }
+        }
+
+        // Brute force over column permutations (rows beyond the columns stay unassigned)
+        std::vector<int> columns(std::max(weights.size(), weights[0].size()));
+        std::iota(columns.begin(), columns.end(), 0);
+        long long best = 0;
+        do {
+            long long sum = 0;
+            for (size_t i = 0; i < weights.size(); ++i) {
+                if (columns[i] < static_cast<int>(weights[0].size())) {
+                    sum += weights[i][columns[i]];
+                }
+            }
+            best = std::max(best, sum);
+        } while (std::next_permutation(columns.begin(), columns.end()));
+        EXPECT_EQ(total, best);
+    }
+}
+
+// Test 3: Component pairs are solved independently and combined without reusing a component
+TEST_F(ComponentTest, ComponentDecompositionCombinesPieces) {
+    Graph g1;
+    add_piece(g1, "p", 3);
+    add_piece(g1, "q", 3);
+    add_piece(g1, "r", 1);
+
+    Graph g2;
+    add_piece(g2, "s", 1);
+    add_piece(g2, "t", 3);
+    add_piece(g2, "u", 2);
+
+    ComponentMCIS solver;
+    MCISResult result = solver.find_mapping(g1, g2);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, result.mapping));
+
+    // p/q match t fully (6) and u up to its length (5), r matches s fully (4): all of g2
+    EXPECT_EQ(result.size(), 6 + 5 + 4);
+    EXPECT_TRUE(result.optimal);
+
+    // Identical piece sets are matched completely through the isomorphism classes
+    Graph g3;
+    add_piece(g3, "a", 3);
+    add_piece(g3, "b", 1);
+    add_piece(g3, "c", 3);
+    result = solver.find_mapping(g1, g3);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g3, result.mapping));
+    EXPECT_EQ(result.size(), g1.get_num_nodes());
+
+    // Two pieces of g1 cannot share g2's single piece, so this is only a lower bound
+    Graph g4;
+    add_piece(g4, "z", 4);
+    result = solver.find_mapping(g1, g4);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g4, result.mapping));
+    EXPECT_EQ(result.size(), 6);
+    EXPECT_FALSE(result.optimal);
+}
+
+// Test 4: MCISAlgorithm runs the component driver on disconnected inputs
+TEST_F(ComponentTest, RunComponentDecomposition) {
+    Graph g1;
+    add_piece(g1, "p", 4);
+    add_piece(g1, "q", 2);
+    Graph g2;
+    add_piece(g2, "s", 3);
+    add_piece(g2, "t", 3);
+    g2.add_node("lonely", OpLabel::ADD);
+
+    MCISAlgorithm algorithm;
+    auto results = algorithm.run(g1, g2, AlgorithmType::COMPONENT_DECOMPOSITION);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_TRUE(VF3Matcher::is_common_induced_subgraph(*results[0], g1, g2));
+    EXPECT_EQ(results[0]->get_num_nodes(), 6 + 5);
+    delete results[0];
+}
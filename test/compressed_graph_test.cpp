@@ -0,0 +1,108 @@
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/compressed_graph.h"
+#include "mcis/graph.h"
+#include "mcis/indexed_graph.h"
+
+class CompressedGraphTest : public ::testing::Test {
+protected:
+    // Checks that a compressed graph has the nodes, labels and weighted edges of an indexed one
+    static bool matches(const CompressedGraph& compressed, const IndexedGraph& indexed) {
+        if (compressed.get_num_nodes() != indexed.get_num_nodes()
+            || compressed.get_num_edges() != indexed.get_num_edges()) {
+            return false;
+        }
+        for (int v = 0; v < indexed.get_num_nodes(); ++v) {
+            if (compressed.get_id(v) != indexed.get_id(v)
+                || compressed.get_index(indexed.get_id(v)) != v
+                || compressed.get_label(v) != indexed.get_label(v)
+                || compressed.get_out_degree(v) != indexed.get_out_degree(v)) {
+                return false;
+            }
+            std::vector<std::pair<int, int>> children;
+            std::vector<std::pair<int, int>> expected;
+            compressed.for_each_child(v, [&](int child, int weight) {
+                children.emplace_back(child, weight);
+            });
+            indexed.for_each_child(v, [&](int child, int weight) {
+                expected.emplace_back(child, weight);
+            });
+            if (children != expected) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Test 1: Compression round-trips nodes, labels, IDs and weighted edges
+TEST_F(CompressedGraphTest, RoundTrip) {
+    const Graph fft = Graph::create_fft_graph(64);
+    const CompressedGraph compressed(fft);
+    EXPECT_FALSE(compressed.is_weighted());
+    EXPECT_TRUE(matches(compressed, IndexedGraph(fft)));
+    EXPECT_TRUE(compressed.to_graph() == fft);
+
+    Graph weighted = Graph::create_mvm_graph_from_dimensions(3, 4);
+    weighted.change_edge_weight("m0,0", "p0,0", -7);
+    weighted.change_edge_weight("v1", "p2,1", 300);
+    const CompressedGraph compressed_weighted(weighted);
+    EXPECT_TRUE(compressed_weighted.is_weighted());
+    EXPECT_TRUE(matches(compressed_weighted, IndexedGraph(weighted)));
+    EXPECT_TRUE(compressed_weighted.to_graph() == weighted);
+
+    EXPECT_EQ(compressed.get_index("missing"), -1);
+    EXPECT_EQ(compressed.get_index(""), -1);
+    EXPECT_EQ(compressed.get_index("zzz"), -1);
+    const CompressedGraph empty{Graph()};
+    EXPECT_EQ(empty.get_num_nodes(), 0);
+    EXPECT_EQ(empty.get_index("a"), -1);
+    EXPECT_EQ(empty.to_graph().get_num_nodes(), 0);
+}
+
+// Test 2: Levels and in-degrees decoded from the children match the indexed graph
+TEST_F(CompressedGraphTest, Levels) {
+    for (const Graph& graph : {Graph::create_fft_graph(128), Graph::create_dwt_graph(64, 3),
+                               Graph::create_mvm_graph_from_dimensions(5, 7)}) {
+        const IndexedGraph indexed(graph);
+        const CompressedGraph compressed(graph);
+        std::vector<int> levels;
+        ASSERT_TRUE(compressed.compute_levels(levels));
+        const std::vector<int> in_degrees = compressed.get_in_degrees();
+        for (int v = 0; v < indexed.get_num_nodes(); ++v) {
+            EXPECT_EQ(levels[v], indexed.get_level(v));
+            EXPECT_EQ(in_degrees[v], indexed.get_in_degree(v));
+        }
+    }
+
+    Graph cycle;
+    cycle.add_node_set({"a", "b", "c"});
+    cycle.add_edge("a", "b", 0);
+    cycle.add_edge("b", "c", 0);
+    cycle.add_edge("c", "a", 0);
+    std::vector<int> levels;
+    EXPECT_FALSE(CompressedGraph(cycle).compute_levels(levels));
+    EXPECT_TRUE(levels.empty());
+}
+
+// Test 3: Adjacency of generated CDAGs takes under four bytes per edge
+TEST_F(CompressedGraphTest, Size) {
+    for (const Graph& graph : {Graph::create_fft_graph(1024), Graph::create_dwt_graph(1024, 5),
+                               Graph::create_mvm_graph_from_dimensions(32, 32)}) {
+        const CompressedGraph compressed(graph);
+        const size_t num_edges = compressed.get_num_edges();
+        EXPECT_LT(compressed.get_adjacency_bytes(), 4 * num_edges);
+        EXPECT_LT(compressed.get_memory_bytes(), 24 * num_edges);
+    }
+
+    // Weights are only stored when some edge has one
+    Graph graph = Graph::create_fft_graph(256);
+    const CompressedGraph unweighted(graph);
+    graph.change_edge_weight("x0", graph.get_node("x0")->get_children().begin()->first->get_id(),
+                             1);
+    EXPECT_GE(CompressedGraph(graph).get_adjacency_bytes(),
+              unweighted.get_adjacency_bytes() + unweighted.get_num_edges());
+}
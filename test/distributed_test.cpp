@@ -0,0 +1,116 @@
+#include <sstream>
+#include <string>
+
+#include "../src/algorithms/bron_kerbosch_serial.h"
+#include "../src/algorithms/distributed_mcis.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+#include "mcis/vf3.h"
+
+class DistributedTest : public ::testing::Test {};
+
+// Test 1: Graphs survive the binary format, several per stream, and malformed input is rejected
+TEST_F(DistributedTest, BinaryRoundTrip) {
+    Graph fft = Graph::create_fft_graph(8);
+    Graph dwt = Graph::create_dwt_graph(8, 2);
+    for (const auto& [id, node] : dwt.get_nodes()) {
+        if (node->get_num_children() > 0) {
+            dwt.change_edge_weight(id, node->get_children().begin()->first->get_id(), 3);
+            break;
+        }
+    }
+    std::stringstream stream;
+    ASSERT_TRUE(fft.write_binary(stream));
+    ASSERT_TRUE(dwt.write_binary(stream));
+    const std::string data = stream.str();
+
+    Graph first;
+    Graph second;
+    ASSERT_TRUE(first.read_binary(stream));
+    ASSERT_TRUE(second.read_binary(stream));
+    EXPECT_TRUE(first == fft);
+    EXPECT_TRUE(second == dwt);
+
+    std::stringstream truncated(data.substr(0, data.size() / 4));
+    EXPECT_FALSE(first.read_binary(truncated));
+    EXPECT_EQ(first.get_num_nodes(), 0);
+    std::stringstream corrupted("MCISGRPH" + data.substr(8));
+    EXPECT_FALSE(second.read_binary(corrupted));
+}
+
+// Test 2: Worker processes on a Unix-domain socket find the serial optimum
+TEST_F(DistributedTest, MatchesSerial) {
+    Graph g1 = Graph::create_fft_graph(4);
+    Graph g2 = Graph::create_dwt_graph(4, 2);
+    for (bool level_constrained : {false, true}) {
+        MCISOptions options;
+        options.level_constrained = level_constrained;
+        options.max_level_offset = 1;
+        BronKerboschSerial serial;
+        DistributedMCIS distributed(3);
+        serial.set_options(options);
+        distributed.set_options(options);
+
+        MCISResult expected = serial.find_mapping(g1, g2);
+        MCISResult result = distributed.find_mapping(g1, g2);
+        EXPECT_EQ(result.size(), expected.size());
+        EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, result.mapping));
+
+        // An optimal incumbent is returned unchanged
+        MCISResult improved = distributed.improve_mapping(g1, g2, expected);
+        EXPECT_EQ(improved.mapping, expected.mapping);
+    }
+}
+
+// Test 3: TCP transport, dispatch through MCISAlgorithm, and workers that cannot start
+TEST_F(DistributedTest, TransportsAndFailures) {
+    Graph g1 = Graph::create_mvm_graph_from_dimensions(2, 3);
+    Graph g2 = Graph::create_fft_graph(4);
+    BronKerboschSerial serial;
+    const int expected = serial.find_mapping(g1, g2).size();
+
+    DistributedMCIS tcp(2, SocketTransport::TCP);
+    MCISResult result = tcp.find_mapping(g1, g2);
+    EXPECT_EQ(result.size(), expected);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, result.mapping));
+
+    MCISAlgorithm algorithm;
+    auto distributed = algorithm.run(g1, g2, AlgorithmType::DISTRIBUTED);
+    ASSERT_EQ(distributed.size(), 1u);
+    EXPECT_EQ(distributed[0]->get_num_nodes(), expected);
+    delete distributed[0];
+
+    // Without a worker executable the subproblems are searched in-process
+    DistributedMCIS missing(2);
+    missing.set_worker_path("/nonexistent/mcis_worker");
+    EXPECT_EQ(missing.find_mapping(g1, g2).size(), expected);
+
+    EXPECT_FALSE(DistributedMCIS::run_worker("unix:/nonexistent/socket", "/nonexistent/graphs"));
+    EXPECT_FALSE(DistributedMCIS::run_worker("tcp:1", "/nonexistent/graphs"));
+}
+
+// Test 4: Pairwise solves of run_multi run in parallel and search their subproblems in-process
+TEST_F(DistributedTest, MultiGraphRun) {
+    Graph fft = Graph::create_fft_graph(4);
+    Graph dwt = Graph::create_dwt_graph(4, 2);
+    Graph mvm = Graph::create_mvm_graph_from_dimensions(2, 3);
+
+    MCISAlgorithm algorithm;
+    bool serial_optimal = false;
+    auto serial = algorithm.run_multi({&fft, &dwt, &mvm}, AlgorithmType::BRON_KERBOSCH_SERIAL,
+                                      nullptr, &serial_optimal);
+    bool optimal = false;
+    auto distributed =
+        algorithm.run_multi({&fft, &dwt, &mvm}, AlgorithmType::DISTRIBUTED, nullptr, &optimal);
+    ASSERT_EQ(serial.size(), 1u);
+    ASSERT_EQ(distributed.size(), 1u);
+    EXPECT_TRUE(serial_optimal);
+    EXPECT_TRUE(optimal);
+    EXPECT_EQ(distributed[0]->get_num_nodes(), serial[0]->get_num_nodes());
+    for (const Graph* input : {&fft, &dwt, &mvm}) {
+        EXPECT_TRUE(VF3Matcher::is_induced_subgraph(*distributed[0], *input));
+    }
+    delete serial[0];
+    delete distributed[0];
+}
@@ -0,0 +1,48 @@
+#include <cstdlib>
+#include <iostream>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+
+class DWTTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        generate_diagrams = std::getenv("GENERATE_DIAGRAMS") != nullptr
+                            && std::string(std::getenv("GENERATE_DIAGRAMS")) == "1";
+    }
+
+    void TearDown() override {}
+
+    bool generate_diagrams = false;
+};
+
+// Test 1: Create DWT(8, 2) graph and check its filter bank structure
+TEST_F(DWTTest, DWT8x2GraphCreation) {
+    Graph dwt_graph = Graph::create_dwt_graph(8, 2);
+
+    std::cout << "DWT(8,2) created with " << dwt_graph.get_num_nodes() << " nodes\n";
+
+    // 8 inputs, 4 taps, 4 output pairs on level 1 and 2 on level 2, each with 4 products, 2 sums
+    EXPECT_EQ(dwt_graph.get_num_nodes(), 8 + 4 + (4 + 2) * 6);
+    EXPECT_TRUE(dwt_graph.is_dag());
+    EXPECT_EQ(dwt_graph.get_node("h0")->get_label(), OpLabel::COEFF);
+    EXPECT_EQ(dwt_graph.get_node("x0")->get_label(), OpLabel::INPUT);
+    EXPECT_EQ(dwt_graph.get_node("l2,a1")->get_label(), OpLabel::ADD);
+    EXPECT_EQ(dwt_graph.get_node("l2,a1")->get_num_parents(), 2);
+
+    // Level 2 consumes the level 1 approximation, not the detail
+    EXPECT_TRUE(dwt_graph.get_node("l1,a0")->contains_edge(dwt_graph.get_node("l2,amul0,0")));
+    EXPECT_EQ(dwt_graph.get_node("l1,d0")->get_num_children(), 0);
+
+    if (generate_diagrams) {
+        dwt_graph.generate_diagram_file("dwt_8x2");
+        std::cout << "Generated dwt_8x2.gv and dwt_8x2.png\n";
+    }
+}
+
+// Test 2: Invalid arguments produce empty graphs
+TEST_F(DWTTest, DWTInvalidArguments) {
+    EXPECT_EQ(Graph::create_dwt_graph(0, 1).get_num_nodes(), 0);
+    EXPECT_EQ(Graph::create_dwt_graph(8, 0).get_num_nodes(), 0);
+    EXPECT_EQ(Graph::create_dwt_graph(6, 2).get_num_nodes(), 0);
+}
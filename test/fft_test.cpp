@@ -0,0 +1,61 @@
+#include <cstdlib>
+#include <iostream>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+
+class FFTTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        generate_diagrams = std::getenv("GENERATE_DIAGRAMS") != nullptr
+                            && std::string(std::getenv("GENERATE_DIAGRAMS")) == "1";
+    }
+
+    void TearDown() override {}
+
+    static int count_label(const Graph& graph, OpLabel label) {
+        int count = 0;
+        for (const auto& [_, node] : graph.get_nodes()) {
+            count += node->get_label() == label ? 1 : 0;
+        }
+        return count;
+    }
+
+    bool generate_diagrams = false;
+};
+
+// Test 1: Create FFT(4) graph and check its butterfly structure
+TEST_F(FFTTest, FFT4GraphCreation) {
+    Graph fft_graph = Graph::create_fft_graph(4);
+
+    std::cout << "FFT(4) created with " << fft_graph.get_num_nodes() << " nodes\n";
+
+    // 4 inputs, 2 twiddles, 2 stages of 2 butterflies with 3 operations each
+    EXPECT_EQ(fft_graph.get_num_nodes(), 4 + 2 + 2 * 2 * 3);
+    EXPECT_EQ(count_label(fft_graph, OpLabel::INPUT), 4);
+    EXPECT_EQ(count_label(fft_graph, OpLabel::TWIDDLE), 2);
+    EXPECT_EQ(count_label(fft_graph, OpLabel::MUL), 4);
+    EXPECT_EQ(count_label(fft_graph, OpLabel::ADD), 4);
+    EXPECT_EQ(count_label(fft_graph, OpLabel::SUB), 4);
+    EXPECT_TRUE(fft_graph.is_dag());
+
+    for (const auto& [_, node] : fft_graph.get_nodes()) {
+        if (node->get_label() == OpLabel::MUL || node->get_label() == OpLabel::ADD
+            || node->get_label() == OpLabel::SUB) {
+            EXPECT_EQ(node->get_num_parents(), 2);
+        }
+    }
+
+    if (generate_diagrams) {
+        fft_graph.generate_diagram_file("fft_4");
+        std::cout << "Generated fft_4.gv and fft_4.png\n";
+    }
+}
+
+// Test 2: Invalid sizes produce empty graphs
+TEST_F(FFTTest, FFTInvalidSizes) {
+    EXPECT_EQ(Graph::create_fft_graph(0).get_num_nodes(), 0);
+    EXPECT_EQ(Graph::create_fft_graph(1).get_num_nodes(), 0);
+    EXPECT_EQ(Graph::create_fft_graph(6).get_num_nodes(), 0);
+    EXPECT_EQ(Graph::create_fft_graph(16).get_num_nodes(), 16 + 8 + 4 * 8 * 3);
+}
@@ -0,0 +1,114 @@
+#include <omp.h>
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/indexed_graph.h"
+
+class FilterTest : public ::testing::Test {
+protected:
+    // IDs of the nodes matching a predicate, for the hash-set based reference implementations
+    template <typename Predicate>
+    static std::vector<std::string> select(const Graph& graph, Predicate predicate) {
+        std::vector<std::string> ids;
+        for (const auto& [id, node] : graph.get_nodes()) {
+            if (predicate(*node)) {
+                ids.push_back(id);
+            }
+        }
+        return ids;
+    }
+
+    // Checks that every node's parent count matches the edges pointing at it
+    static bool consistent(const Graph& graph) {
+        const IndexedGraph indexed(graph);
+        for (int v = 0; v < indexed.get_num_nodes(); ++v) {
+            if (graph.get_node(indexed.get_id(v))->get_num_parents() != indexed.get_in_degree(v)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Test 1: Filtering keeps exactly the subgraph induced by the matching nodes
+TEST_F(FilterTest, FilterNodes) {
+    Graph graph = Graph::create_mvm_graph_from_dimensions(4, 5);
+    graph.change_edge_weight("m0,0", "p0,0", 3);
+    auto keep = [](const Node& node) { return node.get_label() != OpLabel::ADD; };
+
+    const Graph filtered = graph.filter_nodes(keep);
+    EXPECT_TRUE(filtered == graph.induced_subgraph(select(graph, keep)));
+    EXPECT_TRUE(consistent(filtered));
+    EXPECT_EQ(graph.get_num_nodes(), 4 * 5 * 3 + 5 - 4);
+
+    // Edge weights are carried over with the edges
+    EXPECT_EQ(filtered.get_node("m0,0")->get_children().at(filtered.get_node("p0,0")), 3);
+    const Graph without_weight =
+        graph.filter_nodes([](const Node& node) { return node.get_id() != "m0,0"; });
+    EXPECT_EQ(without_weight.get_num_nodes(), graph.get_num_nodes() - 1);
+    EXPECT_FALSE(IndexedGraph(without_weight).is_weighted());
+
+    EXPECT_EQ(graph.filter_nodes([](const Node&) { return false; }).get_num_nodes(), 0);
+    EXPECT_TRUE(graph.filter_nodes([](const Node&) { return true; }) == graph);
+}
+
+// Test 2: In-place removal matches remove_nodes_bulk and logs every removed node
+TEST_F(FilterTest, RemoveNodesIf) {
+    Graph graph = Graph::create_fft_graph(32);
+    Graph reference = graph;
+    auto remove = [](const Node& node) { return node.get_label() == OpLabel::TWIDDLE; };
+    const std::vector<std::string> ids = select(graph, remove);
+    const int version = graph.get_version();
+
+    // The cached snapshot selects the bit-vector pass; the reference takes the hash-set path
+    ASSERT_NE(graph.get_indexed(), nullptr);
+    EXPECT_EQ(graph.remove_nodes_if(remove), static_cast<int>(ids.size()));
+    EXPECT_EQ(reference.remove_nodes_bulk(ids), static_cast<int>(ids.size()));
+    EXPECT_TRUE(graph == reference);
+    EXPECT_TRUE(consistent(graph));
+    EXPECT_TRUE(graph.is_dag());
+
+    std::vector<GraphEdit> edits;
+    ASSERT_TRUE(graph.get_edits_since(version, edits));
+    EXPECT_EQ(edits.size(), ids.size());
+    for (const GraphEdit& edit : edits) {
+        EXPECT_EQ(edit.kind, GraphEditKind::REMOVE_NODE);
+        EXPECT_EQ(graph.get_node(edit.from), nullptr);
+    }
+
+    EXPECT_EQ(graph.remove_nodes_if(remove), 0);
+    EXPECT_EQ(graph.remove_nodes_bulk({"missing"}), 0);
+    ASSERT_NE(graph.get_indexed(), nullptr);
+    EXPECT_EQ(graph.remove_nodes_bulk({"missing"}), 0);
+    EXPECT_EQ(graph.get_version(), edits.back().version + 1);
+}
+
+// Test 3: Large graphs are filtered by several threads with the same result
+TEST_F(FilterTest, Parallel) {
+    const Graph graph = Graph::create_fft_graph(1024);
+    ASSERT_GE(graph.get_num_nodes(), FILTER_PARALLEL_THRESHOLD);
+    auto keep = [](const Node& node) {
+        return node.get_label() != OpLabel::MUL && node.get_id().back() != '7';
+    };
+    const Graph reference = graph.induced_subgraph(select(graph, keep));
+
+    const int threads = omp_get_max_threads();
+    omp_set_num_threads(4);
+    const Graph filtered = graph.filter_nodes(keep);
+    Graph pruned = graph;
+    ASSERT_NE(pruned.get_indexed(), nullptr);
+    const int removed = pruned.remove_nodes_if([&](const Node& node) { return !keep(node); });
+    omp_set_num_threads(threads);
+    Graph fallback = graph;
+    fallback.remove_nodes_if([&](const Node& node) { return !keep(node); });
+
+    EXPECT_TRUE(filtered == reference);
+    EXPECT_TRUE(pruned == reference);
+    EXPECT_TRUE(fallback == reference);
+    EXPECT_EQ(removed, graph.get_num_nodes() - reference.get_num_nodes());
+    EXPECT_TRUE(consistent(filtered));
+    EXPECT_TRUE(consistent(pruned));
+}
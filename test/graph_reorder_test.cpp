@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/graph_reorder.h"
+#include "mcis/indexed_graph.h"
+#include "mcis/vf3.h"
+
+class GraphReorderTest : public ::testing::Test {
+protected:
+    static constexpr VertexOrdering layouts[] = {
+        VertexOrdering::NATURAL, VertexOrdering::DEGREE, VertexOrdering::DEGENERACY,
+        VertexOrdering::LEVEL, VertexOrdering::LABEL_RARITY, VertexOrdering::RCM};
+
+    // Largest index distance between the endpoints of an edge
+    static int bandwidth(const IndexedGraph& graph) {
+        int result = 0;
+        for (int v = 0; v < graph.get_num_nodes(); ++v) {
+            for (int child : graph.get_children(v)) {
+                result = std::max(result, std::abs(child - v));
+            }
+        }
+        return result;
+    }
+};
+
+// Test 1: Every layout is a permutation, and renumbering keeps IDs, labels, edges and levels
+TEST_F(GraphReorderTest, Layouts) {
+    Graph graph = Graph::create_dwt_graph(32, 3);
+    graph.add_node("isolated", OpLabel::ADD);
+    const IndexedGraph indexed(graph);
+    for (VertexOrdering layout : layouts) {
+        const std::vector<int> order = GraphReorder::node_order(indexed, layout);
+        std::vector<int> sorted = order;
+        std::sort(sorted.begin(), sorted.end());
+        for (int v = 0; v < indexed.get_num_nodes(); ++v) {
+            ASSERT_EQ(sorted[v], v);
+        }
+
+        const IndexedGraph reordered = indexed.reordered(order);
+        ASSERT_EQ(reordered.get_num_edges(), indexed.get_num_edges());
+        EXPECT_EQ(reordered.get_num_levels(), indexed.get_num_levels());
+        for (int i = 0; i < reordered.get_num_nodes(); ++i) {
+            const int v = order[i];
+            EXPECT_EQ(reordered.get_id(i), indexed.get_id(v));
+            EXPECT_EQ(reordered.get_index(indexed.get_id(v)), i);
+            EXPECT_EQ(reordered.get_label(i), indexed.get_label(v));
+            EXPECT_EQ(reordered.get_level(i), indexed.get_level(v));
+            for (int child : indexed.get_children(v)) {
+                EXPECT_EQ(reordered.get_edge_weight(i, reordered.get_index(indexed.get_id(child))),
+                          indexed.get_edge_weight(v, child));
+            }
+        }
+
+        for (int i = 1; i < reordered.get_num_nodes(); ++i) {
+            if (layout == VertexOrdering::LEVEL) {
+                EXPECT_LE(reordered.get_level(i - 1), reordered.get_level(i));
+            } else if (layout == VertexOrdering::DEGREE) {
+                EXPECT_GE(reordered.get_in_degree(i - 1) + reordered.get_out_degree(i - 1),
+                          reordered.get_in_degree(i) + reordered.get_out_degree(i));
+            } else if (layout == VertexOrdering::LABEL_RARITY) {
+                // Each label forms one contiguous run
+                if (reordered.get_label(i - 1) != reordered.get_label(i)) {
+                    for (int j = 0; j < i; ++j) {
+                        EXPECT_NE(reordered.get_label(j), reordered.get_label(i));
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Test 2: Reverse Cuthill-McKee keeps the endpoints of edges close together
+TEST_F(GraphReorderTest, Bandwidth) {
+    for (const Graph& graph : {Graph::create_fft_graph(256), Graph::create_dwt_graph(256, 4),
+                               Graph::create_mvm_graph_from_dimensions(16, 16)}) {
+        const IndexedGraph indexed(graph);
+        const IndexedGraph rcm =
+            indexed.reordered(GraphReorder::node_order(indexed, VertexOrdering::RCM));
+        EXPECT_LT(bandwidth(rcm), bandwidth(indexed) / 2);
+    }
+}
+
+// Test 3: Index mappings carry over to the renumbered graphs
+TEST_F(GraphReorderTest, Mappings) {
+    const IndexedGraph pattern(Graph::create_dwt_graph(8, 2));
+    const IndexedGraph target(Graph::create_dwt_graph(16, 2));
+    VF3Matcher matcher(pattern, target);
+    std::vector<int> mapping;
+    ASSERT_TRUE(matcher.find_first(mapping));
+
+    const std::vector<int> order1 = GraphReorder::node_order(pattern, VertexOrdering::RCM);
+    const std::vector<int> order2 = GraphReorder::node_order(target, VertexOrdering::LABEL_RARITY);
+    const std::vector<int> rank1 = GraphReorder::invert(order1);
+    const std::vector<int> rank2 = GraphReorder::invert(order2);
+    const IndexedGraph pattern_rcm = pattern.reordered(order1);
+    const IndexedGraph target_label = target.reordered(order2);
+    const std::vector<int> remapped = GraphReorder::remap(mapping, rank1, rank2);
+
+    std::vector<std::pair<int, int>> pairs;
+    for (int u = 0; u < pattern.get_num_nodes(); ++u) {
+        pairs.emplace_back(u, mapping[u]);
+    }
+    GraphReorder::remap(pairs, rank1, rank2);
+    for (const auto& [u, v] : pairs) {
+        EXPECT_EQ(remapped[u], v);
+        EXPECT_EQ(pattern_rcm.get_id(u), pattern.get_id(order1[u]));
+        EXPECT_EQ(target_label.get_id(v), target.get_id(mapping[order1[u]]));
+        EXPECT_EQ(pattern_rcm.get_label(u), target_label.get_label(v));
+    }
+    for (int u = 0; u < pattern_rcm.get_num_nodes(); ++u) {
+        for (int w = 0; w < pattern_rcm.get_num_nodes(); ++w) {
+            EXPECT_EQ(pattern_rcm.has_edge(u, w), target_label.has_edge(remapped[u], remapped[w]));
+        }
+    }
+}
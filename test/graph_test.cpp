@@ -373,3 +373,24 @@ TEST_F(GraphTest, ComplexGraphOperationsAndStressTesting) {
         }
     }
 }
+
+// Test 21: Tests operation labels through node creation, relabelling and induced subgraphs
+TEST_F(GraphTest, OperationLabels) {
+    EXPECT_TRUE(graph->add_node("x", OpLabel::INPUT));
+    EXPECT_TRUE(graph->add_node_set({"p", "q"}, OpLabel::MUL));
+    EXPECT_TRUE(graph->add_node("s"));
+    EXPECT_TRUE(graph->add_edge("x", "p", 0));
+    EXPECT_TRUE(graph->add_edge("p", "s", 0));
+
+    EXPECT_EQ(graph->get_node("x")->get_label(), OpLabel::INPUT);
+    EXPECT_EQ(graph->get_node("q")->get_label(), OpLabel::MUL);
+    EXPECT_EQ(graph->get_node("s")->get_label(), OpLabel::NONE);
+
+    EXPECT_TRUE(graph->set_node_label("s", OpLabel::ADD));
+    EXPECT_FALSE(graph->set_node_label("missing", OpLabel::ADD));
+    EXPECT_EQ(graph->get_node("s")->get_label(), OpLabel::ADD);
+
+    Graph sub = graph->induced_subgraph({"p", "s"});
+    EXPECT_EQ(sub.get_node("p")->get_label(), OpLabel::MUL);
+    EXPECT_EQ(sub.get_node("s")->get_label(), OpLabel::ADD);
+}
@@ -0,0 +1,124 @@
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/bounds.h"
+#include "mcis/graph.h"
+#include "mcis/graph_summary.h"
+#include "mcis/graph_view.h"
+#include "mcis/indexed_graph.h"
+#include "mcis/vf3.h"
+
+class GraphViewTest : public ::testing::Test {
+protected:
+    // Checks that a view has the IDs, labels, levels and edges of a generated graph
+    template <typename View>
+    static bool matches(const View& view, const Graph& graph) {
+        const IndexedGraph indexed(graph);
+        if (view.get_num_nodes() != indexed.get_num_nodes()
+            || view.get_num_edges() != indexed.get_num_edges()
+            || view.get_num_levels() != indexed.get_num_levels()) {
+            return false;
+        }
+        std::set<std::string> ids;
+        for (int v = 0; v < view.get_num_nodes(); ++v) {
+            const int u = indexed.get_index(view.get_id(v));
+            if (u < 0 || !ids.insert(view.get_id(v)).second
+                || view.get_label(v) != indexed.get_label(u)
+                || view.get_level(v) != indexed.get_level(u)) {
+                return false;
+            }
+            std::multiset<std::string> children;
+            std::multiset<std::string> parents;
+            view.for_each_child(v, [&](int child, int weight) {
+                children.insert(view.get_id(child) + ":" + std::to_string(weight));
+            });
+            view.for_each_parent(v, [&](int parent) { parents.insert(view.get_id(parent)); });
+            std::multiset<std::string> expected_children;
+            std::multiset<std::string> expected_parents;
+            indexed.for_each_child(u, [&](int child, int weight) {
+                expected_children.insert(indexed.get_id(child) + ":" + std::to_string(weight));
+            });
+            indexed.for_each_parent(u, [&](int parent) {
+                expected_parents.insert(indexed.get_id(parent));
+            });
+            if (children != expected_children || parents != expected_parents
+                || view.get_out_degree(v) != static_cast<int>(children.size())
+                || view.get_in_degree(v) != static_cast<int>(parents.size())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool same_summary(const GraphSummary& a, const GraphSummary& b) {
+        return a.num_nodes == b.num_nodes && a.num_edges == b.num_edges && a.dag == b.dag
+               && a.label_counts == b.label_counts && a.degree_histograms == b.degree_histograms
+               && a.level_histograms == b.level_histograms;
+    }
+};
+
+// Test 1: Procedural views describe exactly the graphs built by the generators
+TEST_F(GraphViewTest, MatchesGenerators) {
+    for (int m = 1; m <= 3; ++m) {
+        for (int n = 1; n <= 4; ++n) {
+            EXPECT_TRUE(matches(MVMView(m, n), Graph::create_mvm_graph_from_dimensions(m, n)))
+                << "mvm " << m << "x" << n;
+        }
+    }
+    for (int n = 2; n <= 32; n *= 2) {
+        EXPECT_TRUE(matches(FFTView(n), Graph::create_fft_graph(n))) << "fft " << n;
+    }
+    for (int levels = 1; levels <= 3; ++levels) {
+        EXPECT_TRUE(matches(DWTView(16, levels), Graph::create_dwt_graph(16, levels)))
+            << "dwt " << levels;
+    }
+
+    // Invalid or oversized parameters give empty views
+    EXPECT_EQ(FFTView(12).get_num_nodes(), 0);
+    EXPECT_EQ(FFTView(1 << 30).get_num_nodes(), 0);
+    EXPECT_EQ(DWTView(12, 3).get_num_nodes(), 0);
+    EXPECT_EQ(MVMView(0, 4).get_num_nodes(), 0);
+    EXPECT_EQ(MVMView(100000, 100000).get_num_nodes(), 0);
+}
+
+// Test 2: Summaries and bounds are computed from views without materializing them
+TEST_F(GraphViewTest, Summaries) {
+    const Graph mvm = Graph::create_mvm_graph_from_dimensions(3, 5);
+    EXPECT_TRUE(same_summary(GraphSummary(MVMView(3, 5)), mvm.get_summary()));
+    EXPECT_TRUE(same_summary(GraphSummary(FFTView(16)), Graph::create_fft_graph(16).get_summary()));
+    const Graph dwt = Graph::create_dwt_graph(32, 3);
+    EXPECT_TRUE(same_summary(GraphSummary(DWTView(32, 3)), dwt.get_summary()));
+
+    // A view of almost a million nodes is just two integers
+    const FFTView large(1 << 15);
+    EXPECT_LE(sizeof(large), 2 * sizeof(int));
+    const GraphSummary summary(large);
+    EXPECT_EQ(summary.num_nodes, (1 << 15) / 2 * 3 + 3 * 15 * (1 << 14));
+    EXPECT_EQ(summary.level_histograms[static_cast<int>(OpLabel::SUB)].back(), 1 << 14);
+    const int bound = MCISBounds::upper_bound(summary, GraphSummary(DWTView(1 << 15, 4)));
+    EXPECT_GT(bound, 0);
+    EXPECT_LE(bound, summary.num_nodes);
+}
+
+// Test 3: Materialized views keep their numbering and can be handed to the indexed solvers
+TEST_F(GraphViewTest, Materialized) {
+    const FFTView view(16);
+    const IndexedGraph indexed(view);
+    ASSERT_EQ(indexed.get_num_nodes(), view.get_num_nodes());
+    for (int v = 0; v < view.get_num_nodes(); ++v) {
+        EXPECT_EQ(indexed.get_index(view.get_id(v)), v);
+    }
+    EXPECT_TRUE(indexed.is_dag());
+
+    const IndexedGraph generated(Graph::create_fft_graph(16));
+    VF3Matcher matcher(indexed, generated);
+    std::vector<int> mapping;
+    EXPECT_TRUE(matcher.find_first(mapping));
+
+    const IndexedGraph smaller(DWTView(8, 2));
+    const IndexedGraph larger(DWTView(16, 2));
+    VF3Matcher embedding(smaller, larger);
+    EXPECT_TRUE(embedding.find_first(mapping));
+}
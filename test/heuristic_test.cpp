@@ -0,0 +1,94 @@
+#include <random>
+#include <string>
+
+#include "../src/algorithms/bron_kerbosch_serial.h"
+#include "../src/algorithms/heuristic_mcis.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+#include "mcis/vf3.h"
+
+class HeuristicTest : public ::testing::Test {
+protected:
+    static HeuristicMCIS make_solver(double time_limit) {
+        HeuristicMCIS solver;
+        MCISOptions options;
+        options.time_limit = time_limit;
+        options.seed = 17;
+        solver.set_options(options);
+        return solver;
+    }
+
+    static Graph random_dag(int n, double density, std::mt19937& rng, const std::string& prefix) {
+        Graph graph;
+        std::bernoulli_distribution coin(density);
+        for (int i = 0; i < n; ++i) {
+            graph.add_node(prefix + std::to_string(i));
+        }
+        for (int i = 0; i < n; ++i) {
+            for (int j = i + 1; j < n; ++j) {
+                if (coin(rng)) {
+                    graph.add_edge(prefix + std::to_string(i), prefix + std::to_string(j), 0);
+                }
+            }
+        }
+        return graph;
+    }
+};
+
+// Test 1: Identical graphs reach the label upper bound and stop before the time limit
+TEST_F(HeuristicTest, ReachesUpperBound) {
+    Graph g1 = Graph::create_fft_graph(4);
+    Graph g2 = Graph::create_fft_graph(4);
+
+    HeuristicMCIS solver = make_solver(30.0);
+    MCISResult result = solver.find_mapping(g1, g2);
+    EXPECT_EQ(result.upper_bound, g1.get_num_nodes());
+    EXPECT_EQ(result.size(), result.upper_bound);
+    EXPECT_TRUE(result.optimal);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, result.mapping));
+}
+
+// Test 2: Mappings on mismatched kernels are valid and bounded by the label histogram
+TEST_F(HeuristicTest, ValidMappingWithinBudget) {
+    Graph fft = Graph::create_fft_graph(16);
+    Graph mvm = Graph::create_mvm_graph_from_dimensions(4, 4);
+
+    HeuristicMCIS solver = make_solver(0.3);
+    MCISResult result = solver.find_mapping(fft, mvm);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(fft, mvm, result.mapping));
+    EXPECT_EQ(result.upper_bound, HeuristicMCIS::label_bound(IndexedGraph(fft), IndexedGraph(mvm)));
+    EXPECT_GT(result.size(), 0);
+    EXPECT_LE(result.size(), result.upper_bound);
+    EXPECT_GT(result.nodes_explored, 0);
+
+    MCISAlgorithm algorithm;
+    MCISOptions options;
+    options.time_limit = 0.3;
+    algorithm.set_options(options);
+    auto results = algorithm.run(fft, mvm, AlgorithmType::HEURISTIC);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_GT(results[0]->get_num_nodes(), 0);
+    EXPECT_LE(results[0]->get_num_nodes(), result.upper_bound);
+    delete results[0];
+}
+
+// Test 3: Heuristic mappings never beat the exact solver and never lose an incumbent
+TEST_F(HeuristicTest, BoundedByExactSolver) {
+    std::mt19937 rng(23);
+    BronKerboschSerial exact;
+    HeuristicMCIS solver = make_solver(0.05);
+    for (int trial = 0; trial < 4; ++trial) {
+        Graph g1 = random_dag(10, 0.3, rng, "a");
+        Graph g2 = random_dag(11, 0.3, rng, "b");
+
+        MCISResult best = exact.find_mapping(g1, g2);
+        MCISResult result = solver.find_mapping(g1, g2);
+        EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, result.mapping));
+        EXPECT_LE(result.size(), best.size());
+
+        MCISResult improved = solver.improve_mapping(g1, g2, best);
+        EXPECT_EQ(improved.size(), best.size());
+        EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, improved.mapping));
+    }
+}
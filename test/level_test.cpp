@@ -0,0 +1,113 @@
+#include <cstdlib>
+#include <random>
+#include <string>
+
+#include "../src/algorithms/association_graph.h"
+#include "../src/algorithms/bron_kerbosch_serial.h"
+#include "../src/algorithms/clique_search.h"
+#include "../src/algorithms/level_bound.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/indexed_graph.h"
+#include "mcis/mcis_algorithm.h"
+#include "mcis/vf3.h"
+
+class LevelTest : public ::testing::Test {
+protected:
+    static MCISOptions level_options(int offset) {
+        MCISOptions options;
+        options.level_constrained = true;
+        options.max_level_offset = offset;
+        return options;
+    }
+
+    static bool respects_levels(const Graph& g1, const Graph& g2, const NodeMapping& mapping,
+                                int offset) {
+        IndexedGraph i1(g1);
+        IndexedGraph i2(g2);
+        for (const auto& [id1, id2] : mapping) {
+            if (std::abs(i1.get_level(i1.get_index(id1)) - i2.get_level(i2.get_index(id2)))
+                > offset) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Test 1: Topological levels are longest-path depths and cycles are detected
+TEST_F(LevelTest, TopologicalLevels) {
+    IndexedGraph fft(Graph::create_fft_graph(4));
+    ASSERT_TRUE(fft.is_dag());
+    EXPECT_EQ(fft.get_level(fft.get_index("x0")), 0);
+    EXPECT_EQ(fft.get_level(fft.get_index("w1")), 0);
+    EXPECT_EQ(fft.get_level(fft.get_index("s0,mul1")), 1);
+    EXPECT_EQ(fft.get_level(fft.get_index("s0,add0")), 2);
+    EXPECT_EQ(fft.get_level(fft.get_index("s1,sub3")), 4);
+    EXPECT_EQ(fft.get_num_levels(), 5);
+
+    Graph cycle;
+    cycle.add_node_set({"a", "b"});
+    cycle.add_edge("a", "b", 0);
+    cycle.add_edge("b", "a", 0);
+    IndexedGraph cyclic(cycle);
+    EXPECT_FALSE(cyclic.is_dag());
+    EXPECT_EQ(cyclic.get_num_levels(), 0);
+}
+
+// Test 2: Level-constrained runs only match nodes within the allowed offset
+TEST_F(LevelTest, LevelConstrainedMatching) {
+    Graph g1 = Graph::create_dwt_graph(4, 1);
+    Graph g2 = Graph::create_dwt_graph(4, 2);
+
+    BronKerboschSerial solver;
+    const int unconstrained = solver.find_mapping(g1, g2).size();
+    for (int offset : {0, 1}) {
+        solver.set_options(level_options(offset));
+        MCISResult result = solver.find_mapping(g1, g2);
+        EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, result.mapping));
+        EXPECT_TRUE(respects_levels(g1, g2, result.mapping, offset));
+        EXPECT_LE(result.size(), unconstrained);
+    }
+
+    // A large offset is the same as no constraint
+    solver.set_options(level_options(100));
+    EXPECT_EQ(solver.find_mapping(g1, g2).size(), unconstrained);
+
+    MCISAlgorithm algorithm;
+    algorithm.set_options(level_options(0));
+    auto results = algorithm.run(g1, g2, AlgorithmType::BRON_KERBOSCH_SERIAL);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_TRUE(VF3Matcher::is_common_induced_subgraph(*results[0], g1, g2));
+    delete results[0];
+}
+
+// Test 3: The level-histogram bound never cuts off the optimum and prunes the search
+TEST_F(LevelTest, LevelHistogramBound) {
+    IndexedGraph i1(Graph::create_fft_graph(4));
+    IndexedGraph i2(Graph::create_dwt_graph(4, 2));
+    AssociationGraph association(i1, i2, level_options(1));
+    const int n = association.get_num_vertices();
+
+    std::mt19937 rng(5);
+    std::bernoulli_distribution coin(0.6);
+    LevelHistogramBound bound(association, i1, i2);
+    for (int trial = 0; trial < 20; ++trial) {
+        Bitset candidates(n);
+        for (int p = 0; p < n; ++p) {
+            if (coin(rng)) {
+                candidates.set(p);
+            }
+        }
+        MaxCliqueSearch<Bitset> exact(association.get_adjacency().data(), Bitset(n));
+        EXPECT_GE(bound(candidates), exact.run(candidates));
+    }
+
+    Bitset all(n);
+    all.set_all();
+    MaxCliqueSearch<Bitset> plain(association.get_adjacency().data(), Bitset(n));
+    MaxCliqueSearch<Bitset> bounded(association.get_adjacency().data(), Bitset(n));
+    bounded.set_bound(LevelHistogramBound(association, i1, i2));
+    EXPECT_EQ(bounded.run(all), plain.run(all));
+    EXPECT_LE(bounded.get_nodes_explored(), plain.get_nodes_explored());
+}
@@ -0,0 +1,179 @@
+#include "mcis/mcis_algorithm.h"
+
+#include <random>
+#include <string>
+
+#include "../src/algorithms/bron_kerbosch_serial.h"
+#include "../src/algorithms/small_graph_solver.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/vf3.h"
+
+class AlgorithmTest : public ::testing::Test {
+protected:
+    static Graph random_dag(int n, double density, std::mt19937& rng,
+                            const std::string& prefix = "n") {
+        Graph graph;
+        std::bernoulli_distribution coin(density);
+        for (int i = 0; i < n; ++i) {
+            graph.add_node(prefix + std::to_string(i));
+        }
+        for (int i = 0; i < n; ++i) {
+            for (int j = i + 1; j < n; ++j) {
+                if (coin(rng)) {
+                    graph.add_edge(prefix + std::to_string(i), prefix + std::to_string(j), 0);
+                }
+            }
+        }
+        return graph;
+    }
+
+    static void delete_all(std::vector<Graph*>& graphs) {
+        for (Graph* graph : graphs) {
+            delete graph;
+        }
+        graphs.clear();
+    }
+};
+
+// Test 1: The generic solver finds the MCIS of small hand-checked instances
+TEST_F(AlgorithmTest, BronKerboschKnownInstances) {
+    Graph triangle;
+    triangle.add_node_set({"a", "b", "c"});
+    triangle.add_edge("a", "b", 0);
+    triangle.add_edge("b", "c", 0);
+    triangle.add_edge("a", "c", 0);
+
+    Graph path;
+    path.add_node_set({"x", "y", "z"});
+    path.add_edge("x", "y", 0);
+    path.add_edge("y", "z", 0);
+
+    BronKerboschSerial solver;
+    MCISResult result = solver.find_mapping(triangle, path);
+    EXPECT_EQ(result.size(), 2);
+    EXPECT_TRUE(result.optimal);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(triangle, path, result.mapping));
+
+    Graph mvm_small = Graph::create_mvm_graph_from_dimensions(1, 2);
+    Graph mvm_large = Graph::create_mvm_graph_from_dimensions(2, 1);
+    result = solver.find_mapping(mvm_small, mvm_large);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(mvm_small, mvm_large, result.mapping));
+    EXPECT_EQ(result.size(), 4);
+}
+
+// Test 2: Fixed-width solvers agree with the generic solver for every word count
+TEST_F(AlgorithmTest, SmallSolversMatchGenericSolver) {
+    std::mt19937 rng(7);
+    BronKerboschSerial generic;
+    for (auto [n1, n2] : {std::pair{4, 5}, std::pair{8, 8}, std::pair{10, 12}, std::pair{16, 16}}) {
+        for (int trial = 0; trial < 3; ++trial) {
+            Graph g1 = random_dag(n1, 0.35, rng, "a");
+            Graph g2 = random_dag(n2, 0.35, rng, "b");
+            IndexedGraph i1(g1);
+            IndexedGraph i2(g2);
+
+            MCISResult expected = generic.find_mapping(g1, g2);
+            MCISResult small = n1 * n2 <= 64    ? SmallGraphSolver<1>::solve(i1, i2)
+                               : n1 * n2 <= 128 ? SmallGraphSolver<2>::solve(i1, i2)
+                                                : SmallGraphSolver<4>::solve(i1, i2);
+            EXPECT_EQ(small.size(), expected.size());
+            EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, small.mapping));
+            EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, expected.mapping));
+        }
+    }
+}
+
+// Test 3: MCISAlgorithm::run dispatches tiny instances and returns a common induced subgraph
+TEST_F(AlgorithmTest, RunDispatchesSmallInstances) {
+    std::mt19937 rng(11);
+    Graph g1 = random_dag(12, 0.3, rng, "a");
+    Graph g2 = random_dag(14, 0.3, rng, "b");
+
+    MCISAlgorithm algorithm;
+    auto results = algorithm.run(g1, g2, AlgorithmType::BRON_KERBOSCH_SERIAL);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_TRUE(VF3Matcher::is_common_induced_subgraph(*results[0], g1, g2));
+
+    BronKerboschSerial generic;
+    EXPECT_EQ(results[0]->get_num_nodes(), generic.find_mapping(g1, g2).size());
+    delete_all(results);
+}
+
+// Test 4: Instances above the small-graph threshold run the selected algorithm
+TEST_F(AlgorithmTest, RunLargerInstance) {
+    std::mt19937 rng(3);
+    Graph g1 = random_dag(17, 0.5, rng, "a");
+    Graph g2 = random_dag(16, 0.5, rng, "b");
+    ASSERT_GT(g1.get_num_nodes() * g2.get_num_nodes(), SMALL_GRAPH_MAX_PAIRS);
+
+    MCISAlgorithm algorithm;
+    auto results = algorithm.run(g1, g2, AlgorithmType::BRON_KERBOSCH_SERIAL);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_TRUE(VF3Matcher::is_common_induced_subgraph(*results[0], g1, g2));
+    EXPECT_GE(results[0]->get_num_nodes(), 1);
+    delete_all(results);
+}
+
+// Test 5: A full embedding is returned as a subgraph of g1 whichever graph is the smaller one
+TEST_F(AlgorithmTest, EmbeddingKeepsFirstGraphIds) {
+    std::mt19937 rng(5);
+    Graph large = random_dag(20, 0.3, rng, "a");
+    Graph small;
+    for (int i = 0; i < 14; ++i) {
+        small.add_node("b" + std::to_string(i));
+        for (int j = 0; j < i; ++j) {
+            if (large.get_nodes().at("a" + std::to_string(j))->contains_edge(
+                    large.get_nodes().at("a" + std::to_string(i)))) {
+                small.add_edge("b" + std::to_string(j), "b" + std::to_string(i), 0);
+            }
+        }
+    }
+    ASSERT_GT(large.get_num_nodes() * small.get_num_nodes(), SMALL_GRAPH_MAX_PAIRS);
+
+    MCISAlgorithm algorithm;
+    for (const auto& [g1, g2] : {std::pair(&large, &small), std::pair(&small, &large)}) {
+        auto results = algorithm.run(*g1, *g2, AlgorithmType::BRON_KERBOSCH_SERIAL);
+        ASSERT_EQ(results.size(), 1u);
+        EXPECT_EQ(results[0]->get_num_nodes(), small.get_num_nodes());
+        for (const auto& [id, _] : results[0]->get_nodes()) {
+            EXPECT_TRUE(g1->get_nodes().count(id)) << id;
+        }
+        EXPECT_TRUE(VF3Matcher::is_common_induced_subgraph(*results[0], *g1, *g2));
+        delete_all(results);
+    }
+}
+
+// Test 6: Nodes are only matched to nodes carrying the same operation label
+TEST_F(AlgorithmTest, LabelsRestrictMatching) {
+    auto binary_op = [](OpLabel op) {
+        Graph graph;
+        graph.add_node_set({"a", "b"}, OpLabel::INPUT);
+        graph.add_node("m", op);
+        graph.add_edge("a", "m", 0);
+        graph.add_edge("b", "m", 0);
+        return graph;
+    };
+    Graph multiply = binary_op(OpLabel::MUL);
+    Graph add = binary_op(OpLabel::ADD);
+
+    BronKerboschSerial solver;
+    MCISResult result = solver.find_mapping(multiply, add);
+    EXPECT_EQ(result.size(), 2);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(multiply, add, result.mapping));
+    EXPECT_FALSE(VF3Matcher::is_isomorphic(multiply, add));
+
+    IndexedGraph i1(multiply);
+    IndexedGraph i2(add);
+    EXPECT_EQ(SmallGraphSolver<1>::solve(i1, i2).size(), 2);
+
+    // The FFT butterfly's multiply feeds an add and a subtract, so an MVM's add chain only shares
+    // label-consistent pieces with it
+    Graph fft = Graph::create_fft_graph(2);
+    Graph mvm = Graph::create_mvm_graph_from_dimensions(1, 2);
+    result = solver.find_mapping(fft, mvm);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(fft, mvm, result.mapping));
+    for (const auto& [id1, id2] : result.mapping) {
+        EXPECT_EQ(fft.get_node(id1)->get_label(), mvm.get_node(id2)->get_label());
+    }
+}
@@ -0,0 +1,137 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+#include "mcis/vf3.h"
+
+class MultiTest : public ::testing::Test {
+protected:
+    static void delete_all(std::vector<Graph*>& graphs) {
+        for (Graph* graph : graphs) {
+            delete graph;
+        }
+        graphs.clear();
+    }
+
+    static Graph random_dag(int n, int percent, unsigned int seed) {
+        std::mt19937 rng(seed);
+        Graph graph;
+        for (int u = 0; u < n; ++u) {
+            graph.add_node(std::to_string(u), rng() % 2 ? OpLabel::ADD : OpLabel::MUL);
+        }
+        for (int u = 0; u < n; ++u) {
+            for (int v = u + 1; v < n; ++v) {
+                if (static_cast<int>(rng() % 100) < percent) {
+                    graph.add_edge(std::to_string(u), std::to_string(v), 0);
+                }
+            }
+        }
+        return graph;
+    }
+
+    // Largest induced subgraph of the first input that embeds in every input
+    static int brute_force(const std::vector<const Graph*>& graphs) {
+        const Graph& base = *graphs[0];
+        std::vector<std::string> ids;
+        for (const auto& [id, _] : base.get_nodes()) {
+            ids.push_back(id);
+        }
+        int best = 0;
+        for (unsigned int mask = 1; mask < (1u << ids.size()); ++mask) {
+            std::vector<std::string> subset;
+            for (size_t i = 0; i < ids.size(); ++i) {
+                if (mask & (1u << i)) {
+                    subset.push_back(ids[i]);
+                }
+            }
+            if (static_cast<int>(subset.size()) <= best) {
+                continue;
+            }
+            Graph candidate = base.induced_subgraph(subset);
+            bool common = true;
+            for (const Graph* graph : graphs) {
+                common = common && VF3Matcher::is_induced_subgraph(candidate, *graph);
+            }
+            if (common) {
+                best = static_cast<int>(subset.size());
+            }
+        }
+        return best;
+    }
+};
+
+// Test 1: Degenerate inputs
+TEST_F(MultiTest, EmptyAndSingleInput) {
+    MCISAlgorithm algorithm;
+    EXPECT_TRUE(algorithm.run_multi({}).empty());
+
+    Graph mvm = Graph::create_mvm_graph_from_dimensions(2, 2);
+    auto results = algorithm.run_multi({&mvm});
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_TRUE(VF3Matcher::is_isomorphic(*results[0], mvm));
+    delete_all(results);
+}
+
+// Test 2: A graph embedded in every other input is the common subgraph
+TEST_F(MultiTest, NestedInputs) {
+    Graph small = Graph::create_mvm_graph_from_dimensions(1, 2);
+    Graph medium = Graph::create_mvm_graph_from_dimensions(2, 2);
+    Graph large = Graph::create_mvm_graph_from_dimensions(2, 3);
+
+    MCISAlgorithm algorithm;
+    int upper_bound = -1;
+    auto results = algorithm.run_multi({&large, &small, &medium},
+                                       AlgorithmType::BRON_KERBOSCH_SERIAL, &upper_bound);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0]->get_num_nodes(), small.get_num_nodes());
+    EXPECT_EQ(upper_bound, small.get_num_nodes());
+    delete_all(results);
+}
+
+// Test 3: Mixed kernels share a common induced subgraph within the pairwise bound
+TEST_F(MultiTest, MixedKernels) {
+    Graph fft = Graph::create_fft_graph(4);
+    Graph mvm = Graph::create_mvm_graph_from_dimensions(2, 2);
+    Graph dwt = Graph::create_dwt_graph(4, 1);
+
+    MCISAlgorithm algorithm;
+    int upper_bound = -1;
+    auto results =
+        algorithm.run_multi({&fft, &mvm, &dwt}, AlgorithmType::BRON_KERBOSCH_SERIAL, &upper_bound);
+    ASSERT_EQ(results.size(), 1u);
+    const Graph& common = *results[0];
+    EXPECT_GT(common.get_num_nodes(), 0);
+    EXPECT_LE(common.get_num_nodes(), upper_bound);
+    for (const Graph* input : {&fft, &mvm, &dwt}) {
+        EXPECT_TRUE(VF3Matcher::is_induced_subgraph(common, *input));
+    }
+    delete_all(results);
+}
+
+// Test 4: The fold search finds the k-way optimum even when the first pairwise optimum does not
+// extend to the third input
+TEST_F(MultiTest, MatchesBruteForce) {
+    MCISAlgorithm algorithm;
+    for (unsigned int seed = 0; seed < 6; ++seed) {
+        Graph g1 = random_dag(7, 40, 3 * seed);
+        Graph g2 = random_dag(8, 40, 3 * seed + 1);
+        Graph g3 = random_dag(8, 40, 3 * seed + 2);
+
+        int upper_bound = -1;
+        bool optimal = false;
+        auto results = algorithm.run_multi({&g1, &g2, &g3}, AlgorithmType::BRON_KERBOSCH_SERIAL,
+                                           &upper_bound, &optimal);
+        ASSERT_EQ(results.size(), 1u);
+        const Graph& common = *results[0];
+        EXPECT_TRUE(optimal);
+        EXPECT_EQ(common.get_num_nodes(), brute_force({&g1, &g2, &g3}));
+        EXPECT_EQ(upper_bound, common.get_num_nodes());
+        for (const Graph* input : {&g1, &g2, &g3}) {
+            EXPECT_TRUE(VF3Matcher::is_induced_subgraph(common, *input));
+        }
+        delete_all(results);
+    }
+}
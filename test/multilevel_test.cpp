@@ -0,0 +1,80 @@
+#include <algorithm>
+#include <vector>
+
+#include "../src/algorithms/heuristic_mcis.h"
+#include "../src/algorithms/multilevel_mcis.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/vf3.h"
+
+class MultilevelTest : public ::testing::Test {
+protected:
+    static MultilevelMCIS::Level input_level(const Graph& graph) {
+        MultilevelMCIS::Level level;
+        level.graph = IndexedGraph(graph);
+        level.colours = HeuristicMCIS::label_colours(level.graph);
+        return level;
+    }
+};
+
+// Test 1: Coarsening partitions the nodes and colours equal structures alike in both graphs
+TEST_F(MultilevelTest, CoarsenPartitionsNodes) {
+    Graph g1 = Graph::create_mvm_graph_from_dimensions(3, 3);
+    Graph g2 = Graph::create_mvm_graph_from_dimensions(3, 3);
+    MultilevelMCIS::Level fine1 = input_level(g1);
+    MultilevelMCIS::Level fine2 = input_level(g2);
+
+    MultilevelMCIS::SignatureTable table;
+    MultilevelMCIS::Level coarse1 = MultilevelMCIS::coarsen(fine1, table);
+    MultilevelMCIS::Level coarse2 = MultilevelMCIS::coarsen(fine2, table);
+    EXPECT_LT(coarse1.graph.get_num_nodes(), fine1.graph.get_num_nodes());
+    EXPECT_EQ(coarse1.colours, coarse2.colours);
+
+    std::vector<int> seen;
+    for (int c = 0; c < coarse1.graph.get_num_nodes(); ++c) {
+        // Member lists of equal colours line up label by label
+        ASSERT_EQ(coarse1.members[c].size(), coarse2.members[c].size());
+        for (size_t i = 0; i < coarse1.members[c].size(); ++i) {
+            EXPECT_EQ(fine1.graph.get_label(coarse1.members[c][i]),
+                      fine2.graph.get_label(coarse2.members[c][i]));
+        }
+        seen.insert(seen.end(), coarse1.members[c].begin(), coarse1.members[c].end());
+    }
+    std::sort(seen.begin(), seen.end());
+    ASSERT_EQ(static_cast<int>(seen.size()), fine1.graph.get_num_nodes());
+    for (int v = 0; v < fine1.graph.get_num_nodes(); ++v) {
+        EXPECT_EQ(seen[v], v);
+    }
+}
+
+// Test 2: Graphs above the coarsening threshold get a valid mapping close to the label bound
+TEST_F(MultilevelTest, LargeInstance) {
+    Graph g1 = Graph::create_mvm_graph_from_dimensions(40, 40);
+    Graph g2 = Graph::create_mvm_graph_from_dimensions(40, 30);
+    ASSERT_GT(g1.get_num_nodes(), MULTILEVEL_COARSEST_SIZE);
+
+    MultilevelMCIS solver;
+    MCISOptions options;
+    options.time_limit = 0.5;
+    solver.set_options(options);
+    MCISResult result = solver.find_mapping(g1, g2);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, result.mapping));
+    EXPECT_EQ(result.upper_bound, HeuristicMCIS::label_bound(IndexedGraph(g1), IndexedGraph(g2)));
+    EXPECT_LE(result.size(), result.upper_bound);
+    EXPECT_GT(2 * result.size(), result.upper_bound);
+}
+
+// Test 3: Small inputs are solved on the input level alone
+TEST_F(MultilevelTest, SmallInstanceWithoutCoarsening) {
+    Graph g1 = Graph::create_fft_graph(4);
+    Graph g2 = Graph::create_fft_graph(4);
+
+    MultilevelMCIS solver;
+    MCISOptions options;
+    options.time_limit = 30.0;
+    solver.set_options(options);
+    MCISResult result = solver.find_mapping(g1, g2);
+    EXPECT_EQ(result.size(), g1.get_num_nodes());
+    EXPECT_TRUE(result.optimal);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, result.mapping));
+}
@@ -1,8 +1,12 @@
 #include "mcis/node.h"
 
+#include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -375,3 +379,69 @@ TEST_F(NodeTest, ComprehensiveEqualityAndComparisonEdgeCases) {
     EXPECT_TRUE(empty1.same_id(empty2));
     EXPECT_FALSE(empty1 == empty2);
 }
+
+// Test 19: Tests operation labels in construction, equality and printing
+TEST_F(NodeTest, OperationLabels) {
+    EXPECT_EQ(node_a->get_label(), OpLabel::NONE);
+
+    Node mul("M", OpLabel::MUL);
+    Node add("M", OpLabel::ADD);
+    EXPECT_EQ(mul.get_label(), OpLabel::MUL);
+    EXPECT_TRUE(mul.same_id(add));
+    EXPECT_FALSE(mul == add);
+
+    add.set_label(OpLabel::MUL);
+    EXPECT_TRUE(mul == add);
+
+    Node copy(mul);
+    EXPECT_EQ(copy.get_label(), OpLabel::MUL);
+
+    std::ostringstream labelled;
+    labelled << mul;
+    EXPECT_NE(labelled.str().find("[mul]"), std::string::npos);
+
+    std::ostringstream unlabelled;
+    unlabelled << *node_a;
+    EXPECT_EQ(unlabelled.str().find('['), std::string::npos);
+}
+
+// Test 20: Tests children spilling from inline storage to the heap and back through copies
+TEST_F(NodeTest, InlineAndHeapChildren) {
+    std::vector<std::unique_ptr<Node>> targets;
+    for (int i = 0; i < 40; ++i) {
+        targets.push_back(std::make_unique<Node>("T" + std::to_string(i)));
+    }
+    for (int i = 0; i < 40; ++i) {
+        // Insert in a scrambled order; lookups must still find every child
+        Node* target = targets[(i * 17) % 40].get();
+        EXPECT_TRUE(node_a->add_edge(target, i));
+        EXPECT_EQ(node_a->get_num_children(), i + 1);
+        EXPECT_TRUE(node_a->contains_edge(target));
+        EXPECT_EQ(node_a->get_children().at(target), i);
+    }
+    EXPECT_FALSE(node_a->contains_edge(node_b.get()));
+
+    const ChildList& children = node_a->get_children();
+    EXPECT_EQ(children.size(), 40u);
+    EXPECT_TRUE(std::is_sorted(children.begin(), children.end(), [](const auto& a, const auto& b) {
+        return std::less<const Node*>()(a.first, b.first);
+    }));
+
+    Node copy(*node_a);
+    Node moved(std::move(copy));
+    EXPECT_TRUE(moved == *node_a);
+    EXPECT_EQ(copy.get_num_children(), 0);
+    for (int i = 0; i < 38; ++i) {
+        EXPECT_TRUE(moved.remove_edge(targets[i].get()));
+    }
+    EXPECT_EQ(moved.get_num_children(), 2);
+    EXPECT_TRUE(moved.contains_edge(targets[39].get()));
+    EXPECT_FALSE(moved.contains_edge(targets[0].get()));
+
+    // Back to inline storage: a copy assigned from the two remaining children
+    Node small("S");
+    small = moved;
+    EXPECT_TRUE(small.change_edge_weight(targets[38].get(), -5));
+    EXPECT_EQ(small.get_children().at(targets[38].get()), -5);
+    EXPECT_EQ(moved.get_children().at(targets[38].get()), (38 * 33) % 40);
+}
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../src/algorithms/bron_kerbosch_serial.h"
+#include "../src/algorithms/small_graph_solver.h"
+#include "gtest/gtest.h"
+#include "mcis/bitset.h"
+#include "mcis/graph.h"
+#include "mcis/graph_reorder.h"
+#include "mcis/indexed_graph.h"
+#include "mcis/vf3.h"
+
+class OrderingTest : public ::testing::Test {
+protected:
+    static constexpr VertexOrdering ORDERINGS[] = {
+        VertexOrdering::NATURAL, VertexOrdering::DEGREE, VertexOrdering::DEGENERACY,
+        VertexOrdering::LEVEL, VertexOrdering::LABEL_RARITY, VertexOrdering::RCM};
+
+    static int index_of(const IndexedGraph& graph, const std::vector<int>& order,
+                        const std::string& id) {
+        const int v = graph.get_index(id);
+        return static_cast<int>(std::find(order.begin(), order.end(), v) - order.begin());
+    }
+};
+
+// Test 1: Every ordering is a permutation that puts the expected nodes first
+TEST_F(OrderingTest, NodeOrders) {
+    // A triangle a-b-c with a pendant path c -> d -> e
+    Graph graph;
+    graph.add_node_set({"a", "b", "c", "d", "e"});
+    graph.set_node_label("e", OpLabel::MUL);
+    graph.add_edge("a", "b", 0);
+    graph.add_edge("b", "c", 0);
+    graph.add_edge("a", "c", 0);
+    graph.add_edge("c", "d", 0);
+    graph.add_edge("d", "e", 0);
+    IndexedGraph indexed(graph);
+
+    for (VertexOrdering ordering : ORDERINGS) {
+        std::vector<int> order = GraphReorder::node_order(indexed, indexed, ordering);
+        std::sort(order.begin(), order.end());
+        EXPECT_EQ(order, std::vector<int>({0, 1, 2, 3, 4}));
+    }
+
+    auto degree = GraphReorder::node_order(indexed, indexed, VertexOrdering::DEGREE);
+    EXPECT_EQ(degree[0], indexed.get_index("c"));
+
+    // The triangle is the 2-core and comes before the path
+    auto degeneracy = GraphReorder::node_order(indexed, indexed, VertexOrdering::DEGENERACY);
+    for (const char* core : {"a", "b", "c"}) {
+        EXPECT_LT(index_of(indexed, degeneracy, core), index_of(indexed, degeneracy, "d"));
+        EXPECT_LT(index_of(indexed, degeneracy, core), index_of(indexed, degeneracy, "e"));
+    }
+
+    auto level = GraphReorder::node_order(indexed, indexed, VertexOrdering::LEVEL);
+    EXPECT_EQ(level, std::vector<int>({0, 1, 2, 3, 4}));
+
+    auto rarity = GraphReorder::node_order(indexed, indexed, VertexOrdering::LABEL_RARITY);
+    EXPECT_EQ(rarity[0], indexed.get_index("e"));
+}
+
+// Test 2: Orderings and branching policies change the search, not the optimum
+TEST_F(OrderingTest, ExactFindersAgree) {
+    Graph g1 = Graph::create_fft_graph(4);
+    Graph g2 = Graph::create_dwt_graph(4, 2);
+    BronKerboschSerial reference;
+    const int expected = reference.find_mapping(g1, g2).size();
+
+    IndexedGraph i1(Graph::create_mvm_graph_from_dimensions(1, 2));
+    IndexedGraph i2(Graph::create_mvm_graph_from_dimensions(2, 1));
+    const int small_expected = SmallGraphSolver<1>::solve(i1, i2).size();
+
+    for (VertexOrdering ordering : ORDERINGS) {
+        for (BranchingPolicy branching :
+             {BranchingPolicy::STATIC, BranchingPolicy::SMALLEST_DOMAIN}) {
+            MCISOptions options;
+            options.ordering = ordering;
+            options.branching = branching;
+
+            BronKerboschSerial solver;
+            solver.set_options(options);
+            MCISResult result = solver.find_mapping(g1, g2);
+            EXPECT_EQ(result.size(), expected);
+            EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, result.mapping));
+
+            MCISResult small = SmallGraphSolver<1>::solve(i1, i2, options);
+            EXPECT_EQ(small.size(), small_expected);
+        }
+    }
+}
+
+// Test 3: Smallest-domain-first branches on the most constrained g1 node
+TEST_F(OrderingTest, SmallestDomainBranching) {
+    // Node 0 has three partners left, node 1 only one
+    const std::vector<std::pair<int, int>> pairs = {{0, 0}, {0, 1}, {0, 2}, {1, 2}};
+    auto branch = VertexOrder::smallest_domain(pairs, 2, 3, Bitset(4));
+    Bitset candidates(4);
+    candidates.set_all();
+    EXPECT_EQ(branch(candidates, candidates), 3);
+
+    // Ties on the g1 node go to the g2 node with fewer partners, then to the lowest index
+    candidates.reset(3);
+    EXPECT_EQ(branch(candidates, candidates), 0);
+    Bitset tail(4);
+    tail.set(1);
+    tail.set(2);
+    candidates.set(3);
+    EXPECT_EQ(branch(tail, candidates), 1);
+}
@@ -0,0 +1,77 @@
+#include <vector>
+
+#include "../src/algorithms/bron_kerbosch_parallel.h"
+#include "../src/algorithms/bron_kerbosch_serial.h"
+#include "../src/algorithms/clique_search.h"
+#include "../src/algorithms/parallel_search.h"
+#include "gtest/gtest.h"
+#include "mcis/bitset.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+#include "mcis/vf3.h"
+#include "test_graphs.h"
+
+class ParallelTest : public ::testing::Test {};
+
+// Test 1: Work-stealing workers find a maximum clique on unbalanced random graphs
+TEST_F(ParallelTest, MatchesSerialCliqueSearch) {
+    for (unsigned int seed = 0; seed < 4; ++seed) {
+        const int n = 90;
+        auto adjacency = random_graph(n, 30 + 10 * static_cast<int>(seed), seed);
+        Bitset all(n);
+        all.set_all();
+
+        MaxCliqueSearch<Bitset> serial(adjacency.data(), Bitset(n));
+        const int expected = serial.run(all);
+
+        ParallelCliqueSearch<Bitset> parallel(adjacency.data(), Bitset(n), 4);
+        EXPECT_EQ(parallel.run(all), expected);
+        const Bitset& best = parallel.get_best();
+        EXPECT_EQ(static_cast<int>(best.count()), expected);
+        best.for_each([&](size_t u) {
+            best.for_each([&](size_t v) { EXPECT_TRUE(u == v || adjacency[u].test(v)); });
+        });
+
+        // An incumbent as large as the optimum leaves nothing to record
+        EXPECT_EQ(parallel.run(all, expected), expected);
+        EXPECT_FALSE(parallel.get_best().any());
+    }
+}
+
+// Test 2: The parallel finder agrees with the serial one, with and without level constraints
+TEST_F(ParallelTest, FinderMatchesSerial) {
+    Graph g1 = Graph::create_fft_graph(4);
+    Graph g2 = Graph::create_dwt_graph(4, 2);
+    for (bool level_constrained : {false, true}) {
+        MCISOptions options;
+        options.level_constrained = level_constrained;
+        options.max_level_offset = 1;
+        BronKerboschSerial serial;
+        BronKerboschParallel parallel;
+        serial.set_options(options);
+        parallel.set_options(options);
+
+        MCISResult expected = serial.find_mapping(g1, g2);
+        MCISResult result = parallel.find_mapping(g1, g2);
+        EXPECT_EQ(result.size(), expected.size());
+        EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, result.mapping));
+
+        // An optimal incumbent is returned unchanged
+        MCISResult improved = parallel.improve_mapping(g1, g2, expected);
+        EXPECT_EQ(improved.mapping, expected.mapping);
+    }
+}
+
+// Test 3: The parallel finder is reachable through MCISAlgorithm
+TEST_F(ParallelTest, AlgorithmDispatch) {
+    Graph g1 = Graph::create_mvm_graph_from_dimensions(2, 3);
+    Graph g2 = Graph::create_fft_graph(4);
+    MCISAlgorithm algorithm;
+    auto serial = algorithm.run(g1, g2, AlgorithmType::BRON_KERBOSCH_SERIAL);
+    auto parallel = algorithm.run(g1, g2, AlgorithmType::BRON_KERBOSCH_PARALLEL);
+    ASSERT_EQ(parallel.size(), 1u);
+    EXPECT_EQ(parallel[0]->get_num_nodes(), serial[0]->get_num_nodes());
+    EXPECT_TRUE(VF3Matcher::is_induced_subgraph(*parallel[0], g2));
+    delete serial[0];
+    delete parallel[0];
+}
@@ -0,0 +1,125 @@
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/graph_summary.h"
+#include "mcis/indexed_graph.h"
+
+class SnapshotTest : public ::testing::Test {
+protected:
+    static std::string printed(const Graph& graph) {
+        std::ostringstream out;
+        out << graph;
+        return out.str();
+    }
+
+    // Checks that parent counts agree with the children of every node
+    static bool consistent(const Graph& graph) {
+        std::unordered_map<const Node*, int> parents;
+        for (const auto& [_, node] : graph.get_nodes()) {
+            for (const auto& [child, weight] : node->get_children()) {
+                if (graph.get_node(child->get_id()) != child) {
+                    return false;
+                }
+                parents[child]++;
+            }
+        }
+        for (const auto& [_, node] : graph.get_nodes()) {
+            if (node->get_num_parents() != parents[node]) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Test 1: Copies and snapshots are independent of later edits, and snapshots are shared per version
+TEST_F(SnapshotTest, Isolation) {
+    auto original = std::make_unique<Graph>(Graph::create_dwt_graph(8, 2));
+    const std::string before = printed(*original);
+    Graph copy(*original);
+    std::shared_ptr<const Graph> first = original->snapshot();
+    EXPECT_EQ(original->snapshot(), first);
+
+    original->remove_node("x0");
+    std::shared_ptr<const Graph> second = original->snapshot();
+    EXPECT_NE(second, first);
+    EXPECT_EQ(second->get_num_nodes(), first->get_num_nodes() - 1);
+    original.reset();
+
+    // Copies point at their own nodes, so they outlive the original
+    EXPECT_EQ(printed(copy), before);
+    EXPECT_EQ(printed(*first), before);
+    EXPECT_TRUE(consistent(copy));
+    EXPECT_TRUE(consistent(*first));
+    EXPECT_TRUE(consistent(*second));
+}
+
+// Test 2: Concurrent readers of one graph share a single computation of each derived value
+TEST_F(SnapshotTest, ConcurrentReaders) {
+    const Graph graph = Graph::create_fft_graph(16);
+    const int threads = 8;
+    std::vector<const IndexedGraph*> indexed(threads);
+    std::vector<const GraphSummary*> summaries(threads);
+    std::vector<int> dags(threads);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < threads; ++t) {
+        readers.emplace_back([&, t]() {
+            dags[t] = graph.is_dag() ? 1 : 0;
+            indexed[t] = graph.get_indexed().get();
+            summaries[t] = &graph.get_summary();
+        });
+    }
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    for (int t = 0; t < threads; ++t) {
+        EXPECT_EQ(dags[t], 1);
+        EXPECT_EQ(indexed[t], indexed[0]);
+        EXPECT_EQ(summaries[t], summaries[0]);
+    }
+    EXPECT_EQ(indexed[0]->get_num_nodes(), graph.get_num_nodes());
+    EXPECT_EQ(summaries[0]->num_nodes, graph.get_num_nodes());
+}
+
+// Test 3: Readers keep consistent snapshots while a writer keeps editing and publishing
+TEST_F(SnapshotTest, WriterPublishesSnapshots) {
+    Graph graph;
+    graph.add_node("n0", OpLabel::INPUT);
+    std::atomic<std::shared_ptr<const Graph>> published(graph.snapshot());
+    std::atomic<bool> done(false);
+    std::atomic<int> failures(0);
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([&]() {
+            while (!done.load()) {
+                std::shared_ptr<const Graph> view = published.load();
+                if (!consistent(*view) || !view->is_dag()) {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (int i = 1; i < 200; ++i) {
+        const std::string id = "n" + std::to_string(i);
+        graph.add_node(id, OpLabel::ADD);
+        graph.add_edge("n" + std::to_string(i - 1), id, 0);
+        graph.add_edge("n" + std::to_string(i / 2), id, 0);
+        if (i % 10 == 0) {
+            graph.remove_node("n" + std::to_string(i - 5));
+        }
+        published.store(graph.snapshot());
+    }
+    done.store(true);
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_EQ(published.load()->get_num_nodes(), graph.get_num_nodes());
+}
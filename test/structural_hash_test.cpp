@@ -0,0 +1,102 @@
+#include "mcis/structural_hash.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/indexed_graph.h"
+
+class StructuralHashTest : public ::testing::Test {};
+
+// Test 1: MVM rows compute the same expressions, position by position
+TEST_F(StructuralHashTest, MVMRows) {
+    Graph mvm = Graph::create_mvm_graph_from_dimensions(3, 3);
+    IndexedGraph indexed(mvm);
+    StructuralHash hash(indexed);
+
+    // Inputs, products, then one class per accumulator position
+    EXPECT_EQ(hash.get_num_classes(), 4);
+    for (const std::string row : {"1", "2"}) {
+        for (const auto& [first, other] : {std::pair{"p0,1", "p" + row + ",1"},
+                                           std::pair{"acc3,0", "acc3," + row},
+                                           std::pair{"acc4,0", "acc4," + row}}) {
+            const int u = indexed.get_index(first);
+            const int v = indexed.get_index(other);
+            ASSERT_GE(u, 0);
+            ASSERT_GE(v, 0);
+            EXPECT_EQ(hash.get_class(v), hash.get_class(u));
+            EXPECT_EQ(hash.get_hash(v), hash.get_hash(u));
+        }
+    }
+    EXPECT_NE(hash.get_class(indexed.get_index("acc3,0")),
+              hash.get_class(indexed.get_index("acc4,0")));
+
+    auto groups = StructuralHash::find_repeated_subdags(mvm);
+    ASSERT_EQ(groups.size(), 4u);
+    for (const auto& group : groups) {
+        EXPECT_GE(group.size(), 3u);
+    }
+}
+
+// Test 2: Labels, weights, and cycles keep nodes apart
+TEST_F(StructuralHashTest, DistinguishesStructure) {
+    Graph graph;
+    graph.add_node_set({"a", "b", "c", "d", "x", "y", "z"});
+    graph.set_node_label("c", OpLabel::ADD);
+    graph.set_node_label("d", OpLabel::ADD);
+    graph.set_node_label("x", OpLabel::ADD);
+    graph.add_edge("a", "c", 0);
+    graph.add_edge("b", "c", 0);
+    graph.add_edge("a", "d", 0);
+    graph.add_edge("b", "d", 0);
+    graph.add_edge("a", "x", 1);
+    graph.add_edge("b", "x", 0);
+    graph.set_node_label("y", OpLabel::MUL);
+    graph.set_node_label("z", OpLabel::MUL);
+    graph.add_edge("c", "y", 0);
+    graph.add_edge("d", "z", 0);
+    auto groups = StructuralHash::find_repeated_subdags(graph);
+    ASSERT_EQ(groups.size(), 3u);
+    EXPECT_EQ(groups[0], std::vector<std::string>({"a", "b"}));
+    EXPECT_EQ(groups[1], std::vector<std::string>({"c", "d"}));
+    EXPECT_EQ(groups[2], std::vector<std::string>({"y", "z"}));
+
+    Graph cycle;
+    cycle.add_node_set({"a", "b", "c"});
+    cycle.add_edge("a", "b", 0);
+    cycle.add_edge("b", "c", 0);
+    cycle.add_edge("c", "a", 0);
+    IndexedGraph indexed(cycle);
+    StructuralHash hash(indexed);
+    EXPECT_EQ(hash.get_num_classes(), 3);
+    EXPECT_TRUE(hash.get_repeated().empty());
+}
+
+// Test 3: Hashes depend only on the expression, so they match across FFT and DWT sizes
+TEST_F(StructuralHashTest, HashesCompareAcrossGraphs) {
+    Graph fft = Graph::create_fft_graph(8);
+    IndexedGraph fft_indexed(fft);
+    StructuralHash fft_hash(fft_indexed);
+    EXPECT_LT(fft_hash.get_num_classes(), fft_indexed.get_num_nodes());
+    for (const auto& group : fft_hash.get_repeated()) {
+        for (int v : group) {
+            EXPECT_EQ(fft_indexed.get_label(v), fft_indexed.get_label(group[0]));
+            EXPECT_EQ(fft_indexed.get_level(v), fft_indexed.get_level(group[0]));
+        }
+    }
+
+    Graph shallow = Graph::create_dwt_graph(8, 1);
+    Graph deep = Graph::create_dwt_graph(8, 2);
+    IndexedGraph shallow_indexed(shallow);
+    IndexedGraph deep_indexed(deep);
+    StructuralHash shallow_hash(shallow_indexed);
+    StructuralHash deep_hash(deep_indexed);
+    EXPECT_FALSE(shallow_hash.get_repeated().empty());
+    for (int v = 0; v < shallow_indexed.get_num_nodes(); ++v) {
+        const int w = deep_indexed.get_index(shallow_indexed.get_id(v));
+        ASSERT_GE(w, 0);
+        EXPECT_EQ(shallow_hash.get_hash(v), deep_hash.get_hash(w));
+    }
+}
@@ -0,0 +1,165 @@
+#include "mcis/symmetry.h"
+
+#include <string>
+#include <vector>
+
+#include "../src/algorithms/association_graph.h"
+#include "../src/algorithms/bron_kerbosch_serial.h"
+#include "../src/algorithms/clique_search.h"
+#include "../src/algorithms/orbital_branching.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/indexed_graph.h"
+#include "mcis/vf3.h"
+
+class SymmetryTest : public ::testing::Test {
+protected:
+    static bool is_automorphism(const IndexedGraph& graph, const std::vector<int>& permutation) {
+        for (int u = 0; u < graph.get_num_nodes(); ++u) {
+            if (graph.get_label(u) != graph.get_label(permutation[u])) {
+                return false;
+            }
+            for (int v = 0; v < graph.get_num_nodes(); ++v) {
+                if (graph.has_edge(u, v) != graph.has_edge(permutation[u], permutation[v])
+                    || graph.get_edge_weight(u, v)
+                           != graph.get_edge_weight(permutation[u], permutation[v])) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+// Test 1: Orbits of small hand-checked graphs
+TEST_F(SymmetryTest, SmallGraphOrbits) {
+    Graph star;
+    star.add_node_set({"c", "l0", "l1", "l2"});
+    star.add_edge_set("c", {"l0", "l1", "l2"});
+    auto orbits = AutomorphismGroup::find_orbits(star);
+    ASSERT_EQ(orbits.size(), 2u);
+    EXPECT_EQ(orbits[0], std::vector<std::string>({"c"}));
+    EXPECT_EQ(orbits[1], std::vector<std::string>({"l0", "l1", "l2"}));
+
+    // Labels and weights both break symmetry
+    star.set_node_label("l1", OpLabel::ADD);
+    EXPECT_EQ(AutomorphismGroup::find_orbits(star).size(), 3u);
+    star.change_edge_weight("c", "l0", 5);
+    EXPECT_EQ(AutomorphismGroup::find_orbits(star).size(), 4u);
+
+    Graph path;
+    path.add_node_set({"a", "b", "c"});
+    path.add_edge("a", "b", 0);
+    path.add_edge("b", "c", 0);
+    EXPECT_EQ(AutomorphismGroup::find_orbits(path).size(), 3u);
+}
+
+// Test 2: Regular graphs that refinement cannot split need individualization
+TEST_F(SymmetryTest, CyclesNeedIndividualization) {
+    // Two directed 3-cycles and one directed 6-cycle are indistinguishable by refinement
+    Graph two_cycles;
+    Graph one_cycle;
+    for (int i = 0; i < 6; ++i) {
+        two_cycles.add_node("n" + std::to_string(i));
+        one_cycle.add_node("n" + std::to_string(i));
+    }
+    for (int i = 0; i < 6; ++i) {
+        two_cycles.add_edge("n" + std::to_string(i), "n" + std::to_string(i / 3 * 3 + (i + 1) % 3),
+                            0);
+        one_cycle.add_edge("n" + std::to_string(i), "n" + std::to_string((i + 1) % 6), 0);
+    }
+
+    for (Graph* graph : {&two_cycles, &one_cycle}) {
+        IndexedGraph indexed(*graph);
+        AutomorphismGroup group(indexed);
+        EXPECT_EQ(group.get_num_orbits(), 1);
+        EXPECT_TRUE(group.is_complete());
+        for (const auto& generator : group.get_generators()) {
+            EXPECT_TRUE(is_automorphism(indexed, generator));
+        }
+    }
+}
+
+// Test 3: MVM rows, and columns feeding the same accumulator, are interchangeable
+TEST_F(SymmetryTest, MVMRowSymmetry) {
+    Graph mvm = Graph::create_mvm_graph_from_dimensions(4, 3);
+    IndexedGraph indexed(mvm);
+    AutomorphismGroup group(indexed);
+    EXPECT_FALSE(group.is_trivial());
+    EXPECT_TRUE(group.is_complete());
+    for (const auto& generator : group.get_generators()) {
+        EXPECT_TRUE(is_automorphism(indexed, generator));
+    }
+
+    // Products all feed the first accumulator of their row; accumulators form a chain
+    auto orbit_of = [&](const std::string& id) { return group.get_orbit(indexed.get_index(id)); };
+    EXPECT_EQ(orbit_of("p0,1"), orbit_of("p3,2"));
+    EXPECT_EQ(orbit_of("acc4,0"), orbit_of("acc4,3"));
+    EXPECT_NE(orbit_of("acc3,0"), orbit_of("acc4,0"));
+}
+
+// Test 4: Root symmetry breaking keeps the optimum and prunes equivalent branches
+TEST_F(SymmetryTest, SymmetryBreakingPreservesOptimum) {
+    Graph g1 = Graph::create_mvm_graph_from_dimensions(2, 2);
+    Graph g2 = Graph::create_mvm_graph_from_dimensions(2, 3);
+    IndexedGraph i1(g1);
+    IndexedGraph i2(g2);
+    AssociationGraph association(i1, i2);
+    const int n = association.get_num_vertices();
+    Bitset all(n);
+    all.set_all();
+
+    MaxCliqueSearch<Bitset> plain(association.get_adjacency().data(), Bitset(n));
+    const int expected = plain.run(all);
+
+    // Root-level orbits of the full product group
+    MaxCliqueSearch<Bitset> pruned(association.get_adjacency().data(), Bitset(n));
+    pruned.set_symmetry(
+        [&](const std::vector<int>&, std::vector<int>& orbit) {
+            association.get_pair_orbits(AutomorphismGroup(i1), AutomorphismGroup(i2), orbit);
+            return true;
+        },
+        1);
+    EXPECT_EQ(pruned.run(all), expected);
+    EXPECT_LT(pruned.get_nodes_explored(), plain.get_nodes_explored());
+
+    BronKerboschSerial solver;
+    MCISResult result = solver.find_mapping(g1, g2);
+    EXPECT_EQ(result.size(), expected);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, result.mapping));
+}
+
+// Test 5: Incrementally derived stabilizers cut the MVM search and stay within the work budget
+TEST_F(SymmetryTest, OrbitalBranchingReducesSearch) {
+    IndexedGraph i1(Graph::create_mvm_graph_from_dimensions(2, 2));
+    IndexedGraph i2(Graph::create_mvm_graph_from_dimensions(2, 3));
+    AssociationGraph association(i1, i2);
+    const int n = association.get_num_vertices();
+    Bitset all(n);
+    all.set_all();
+
+    MaxCliqueSearch<Bitset> plain(association.get_adjacency().data(), Bitset(n));
+    const int expected = plain.run(all);
+
+    OrbitalBranching orbits(association, i1, i2);
+    ASSERT_TRUE(orbits.applies());
+    MaxCliqueSearch<Bitset> pruned(association.get_adjacency().data(), Bitset(n));
+    pruned.set_symmetry(
+        [&](const std::vector<int>& clique, std::vector<int>& orbit) {
+            return orbits.get_orbits(clique, orbit, pruned.get_orbit_saved());
+        },
+        SYMMETRY_BREAKING_DEPTH);
+    EXPECT_EQ(pruned.run(all), expected);
+    EXPECT_LT(pruned.get_nodes_explored() * 10, plain.get_nodes_explored());
+    EXPECT_GT(pruned.get_orbit_saved(), 0);
+    EXPECT_LE(orbits.get_work(), SYMMETRY_WORK_BUDGET + pruned.get_orbit_saved());
+
+    // Asymmetric inputs skip symmetry breaking without computing any stabilizer
+    Graph path;
+    path.add_node_set({"a", "b", "c"});
+    path.add_edge("a", "b", 0);
+    path.add_edge("b", "c", 0);
+    IndexedGraph i3(path);
+    AssociationGraph chain(i3, i3);
+    EXPECT_FALSE(OrbitalBranching(chain, i3, i3).applies());
+}
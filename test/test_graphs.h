@@ -0,0 +1,24 @@
+#ifndef TEST_GRAPHS_H
+#define TEST_GRAPHS_H
+
+#include <random>
+#include <vector>
+
+#include "mcis/bitset.h"
+
+// Adjacency of an undirected G(n, percent / 100) random graph
+inline std::vector<Bitset> random_graph(int n, int percent, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::vector<Bitset> adjacency(n, Bitset(n));
+    for (int u = 0; u < n; ++u) {
+        for (int v = u + 1; v < n; ++v) {
+            if (static_cast<int>(rng() % 100) < percent) {
+                adjacency[u].set(v);
+                adjacency[v].set(u);
+            }
+        }
+    }
+    return adjacency;
+}
+
+#endif  // TEST_GRAPHS_H
@@ -0,0 +1,145 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../src/algorithms/bron_kerbosch_serial.h"
+#include "../src/algorithms/tree_mcis.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+#include "mcis/vf3.h"
+
+class TreeTest : public ::testing::Test {
+protected:
+    // Random forest: node i attaches to a random earlier node in its tree, in a random direction,
+    // with every components-th node starting a new tree
+    static Graph random_forest(int n, int components, std::mt19937& rng, const std::string& prefix,
+                               int num_labels = 1) {
+        Graph graph;
+        const OpLabel labels[] = {OpLabel::ADD, OpLabel::MUL, OpLabel::SUB};
+        std::uniform_int_distribution<int> label(0, num_labels - 1);
+        std::bernoulli_distribution coin(0.5);
+        for (int i = 0; i < n; ++i) {
+            graph.add_node(prefix + std::to_string(i), labels[label(rng)]);
+        }
+        for (int i = components; i < n; ++i) {
+            std::uniform_int_distribution<int> earlier(0, i / components - 1);
+            const int j = earlier(rng) * components + i % components;
+            const std::string a = prefix + std::to_string(i);
+            const std::string b = prefix + std::to_string(j);
+            if (coin(rng)) {
+                graph.add_edge(a, b, 0);
+            } else {
+                graph.add_edge(b, a, 0);
+            }
+        }
+        return graph;
+    }
+
+    // Largest connected induced subgraph of g1 that embeds in g2, by enumerating subsets
+    static int brute_force_connected(const Graph& g1, const Graph& g2) {
+        std::vector<std::string> ids;
+        for (const auto& [id, _] : g1.get_nodes()) {
+            ids.push_back(id);
+        }
+        int best = 0;
+        for (int mask = 1; mask < (1 << ids.size()); ++mask) {
+            std::vector<std::string> subset;
+            for (size_t i = 0; i < ids.size(); ++i) {
+                if (mask & (1 << i)) {
+                    subset.push_back(ids[i]);
+                }
+            }
+            if (static_cast<int>(subset.size()) <= best) {
+                continue;
+            }
+            Graph sub = g1.induced_subgraph(subset);
+            if (sub.get_weakly_connected_components().size() == 1
+                && VF3Matcher::is_induced_subgraph(sub, g2)) {
+                best = static_cast<int>(subset.size());
+            }
+        }
+        return best;
+    }
+};
+
+// Test 1: Forests are detected regardless of edge direction
+TEST_F(TreeTest, IsForest) {
+    Graph forest;
+    forest.add_node_set({"a", "b", "c", "d", "e"});
+    forest.add_edge("a", "b", 0);
+    forest.add_edge("c", "b", 0);
+    forest.add_edge("d", "e", 0);
+    EXPECT_TRUE(forest.is_forest());
+
+    Graph diamond;
+    diamond.add_node_set({"a", "b", "c", "d"});
+    diamond.add_edge("a", "b", 0);
+    diamond.add_edge("a", "c", 0);
+    diamond.add_edge("b", "d", 0);
+    diamond.add_edge("c", "d", 0);
+    EXPECT_FALSE(diamond.is_forest());
+
+    Graph two_cycle;
+    two_cycle.add_node_set({"a", "b"});
+    two_cycle.add_edge("a", "b", 0);
+    two_cycle.add_edge("b", "a", 0);
+    EXPECT_FALSE(two_cycle.is_forest());
+
+    EXPECT_TRUE(Graph().is_forest());
+    EXPECT_FALSE(Graph::create_mvm_graph_from_dimensions(2, 2).is_forest());
+}
+
+// Test 2: The arc DP finds the largest common connected induced subgraph of labelled trees
+TEST_F(TreeTest, ConnectedMatchesBruteForce) {
+    std::mt19937 rng(5);
+    TreeMCIS solver;
+    for (int trial = 0; trial < 12; ++trial) {
+        Graph g1 = random_forest(8, 1, rng, "a", 2);
+        Graph g2 = random_forest(10, 1, rng, "b", 2);
+        ASSERT_TRUE(TreeMCIS::applies(g1, g2));
+
+        MCISResult result = solver.find_connected(g1, g2);
+        EXPECT_TRUE(result.optimal);
+        EXPECT_EQ(result.size(), brute_force_connected(g1, g2));
+        EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, result.mapping));
+    }
+}
+
+// Test 3: Forest inputs are seeded by the tree solver and still solved to the exact MCIS
+TEST_F(TreeTest, RunSeedsForests) {
+    std::mt19937 rng(9);
+    TreeMCIS tree;
+    BronKerboschSerial generic;
+    MCISAlgorithm algorithm;
+    for (int trial = 0; trial < 2; ++trial) {
+        Graph g1 = random_forest(18, 2, rng, "a", 3);
+        Graph g2 = random_forest(17, 3, rng, "b", 3);
+
+        MCISResult seed = tree.find_mapping(g1, g2);
+        EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, seed.mapping));
+        MCISResult exact = generic.find_mapping(g1, g2);
+        EXPECT_LE(seed.size(), exact.size());
+
+        auto results = algorithm.run(g1, g2, AlgorithmType::BRON_KERBOSCH_SERIAL);
+        ASSERT_EQ(results.size(), 1u);
+        EXPECT_TRUE(VF3Matcher::is_common_induced_subgraph(*results[0], g1, g2));
+        EXPECT_EQ(results[0]->get_num_nodes(), exact.size());
+        delete results[0];
+    }
+
+    // Both small MVMs are trees, but their MCIS is two disconnected multiply pieces, so the
+    // component assignment only gives a lower bound
+    Graph mvm1 = Graph::create_mvm_graph_from_dimensions(1, 2);
+    Graph mvm2 = Graph::create_mvm_graph_from_dimensions(2, 1);
+    ASSERT_TRUE(TreeMCIS::applies(mvm1, mvm2));
+    MCISResult bound = tree.find_mapping(mvm1, mvm2);
+    EXPECT_EQ(bound.size(), 3);
+    EXPECT_FALSE(bound.optimal);
+    EXPECT_EQ(generic.find_mapping(mvm1, mvm2).size(), 4);
+
+    // A non-forest falls back to the general solver
+    Graph mvm3 = Graph::create_mvm_graph_from_dimensions(2, 2);
+    EXPECT_FALSE(TreeMCIS::applies(mvm3, mvm1));
+    EXPECT_EQ(tree.find_mapping(mvm3, mvm1).size(), generic.find_mapping(mvm3, mvm1).size());
+}
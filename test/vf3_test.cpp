@@ -0,0 +1,119 @@
+#include "mcis/vf3.h"
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/mcis_algorithm.h"
+
+class VF3Test : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // path: a -> b -> c
+        path.add_node_set({"a", "b", "c"});
+        path.add_edge("a", "b", 0);
+        path.add_edge("b", "c", 0);
+
+        // diamond with a chord: x -> y -> z, x -> z, z -> w
+        chorded.add_node_set({"x", "y", "z", "w"});
+        chorded.add_edge("x", "y", 0);
+        chorded.add_edge("y", "z", 0);
+        chorded.add_edge("x", "z", 0);
+        chorded.add_edge("z", "w", 0);
+    }
+
+    Graph path;
+    Graph chorded;
+};
+
+// Test 1: A path embeds as an induced subgraph only where no chord connects its ends
+TEST_F(VF3Test, InducedPathEmbedding) {
+    VF3Matcher matcher(path, chorded);
+    auto mapping = matcher.find();
+    ASSERT_TRUE(mapping.has_value());
+    EXPECT_TRUE(VF3Matcher::verify_mapping(path, chorded, *mapping));
+
+    // The only induced 3-paths are x->z->w and y->z->w
+    IndexedGraph p(path);
+    IndexedGraph t(chorded);
+    VF3Matcher indexed_matcher(p, t);
+    EXPECT_EQ(indexed_matcher.find_all().size(), 2u);
+}
+
+// Test 2: Inducedness rejects a pattern whose image would gain an extra edge
+TEST_F(VF3Test, RejectsNonInducedEmbedding) {
+    Graph triangle_path;
+    triangle_path.add_node_set({"a", "b", "c"});
+    triangle_path.add_edge("a", "b", 0);
+    triangle_path.add_edge("b", "c", 0);
+
+    Graph triangle;
+    triangle.add_node_set({"a", "b", "c"});
+    triangle.add_edge("a", "b", 0);
+    triangle.add_edge("b", "c", 0);
+    triangle.add_edge("a", "c", 0);
+
+    EXPECT_FALSE(VF3Matcher::is_induced_subgraph(triangle_path, triangle));
+    EXPECT_TRUE(VF3Matcher::is_induced_subgraph(triangle, chorded));
+}
+
+// Test 3: Edge direction and weights are respected
+TEST_F(VF3Test, DirectionAndWeights) {
+    Graph reversed;
+    reversed.add_node_set({"a", "b"});
+    reversed.add_edge("b", "a", 0);
+    Graph forward;
+    forward.add_node_set({"a", "b"});
+    forward.add_edge("a", "b", 0);
+    EXPECT_TRUE(VF3Matcher::is_isomorphic(reversed, forward));
+
+    Graph weighted;
+    weighted.add_node_set({"a", "b"});
+    weighted.add_edge("a", "b", 5);
+    EXPECT_FALSE(VF3Matcher::is_isomorphic(forward, weighted));
+    EXPECT_FALSE(VF3Matcher::is_induced_subgraph(weighted, path));
+}
+
+// Test 4: Generated MVM CDAGs embed into larger ones and are isomorphic under renaming
+TEST_F(VF3Test, MVMEmbeddingAndIsomorphism) {
+    Graph small = Graph::create_mvm_graph_from_dimensions(2, 2);
+    Graph large = Graph::create_mvm_graph_from_dimensions(2, 3);
+    EXPECT_TRUE(VF3Matcher::is_induced_subgraph(small, large));
+    EXPECT_FALSE(VF3Matcher::is_induced_subgraph(large, small));
+
+    Graph renamed = Graph::create_mvm_graph_from_mat_vec({{"A", "B"}, {"C", "D"}}, {"X", "Y"});
+    EXPECT_TRUE(VF3Matcher::is_isomorphic(small, renamed));
+    EXPECT_TRUE(VF3Matcher::is_common_induced_subgraph(small, renamed, large));
+}
+
+// Test 5: Mapping verification catches non-injective and inconsistent mappings
+TEST_F(VF3Test, VerifyMapping) {
+    EXPECT_TRUE(VF3Matcher::verify_mapping(path, chorded, {{"a", "x"}, {"b", "z"}, {"c", "w"}}));
+    EXPECT_TRUE(VF3Matcher::verify_mapping(path, chorded, {{"a", "y"}, {"c", "w"}}));
+    EXPECT_FALSE(VF3Matcher::verify_mapping(path, chorded, {{"a", "x"}, {"b", "y"}, {"c", "z"}}));
+    EXPECT_FALSE(VF3Matcher::verify_mapping(path, chorded, {{"a", "x"}, {"b", "x"}}));
+    EXPECT_FALSE(VF3Matcher::verify_mapping(path, chorded, {{"a", "missing"}}));
+}
+
+// Test 6: The state limit stops the search and reports an inconclusive answer
+TEST_F(VF3Test, StateLimit) {
+    Graph large = Graph::create_mvm_graph_from_dimensions(3, 3);
+    VF3Matcher matcher(large, large);
+    matcher.set_state_limit(2);
+    std::vector<int> mapping;
+    EXPECT_FALSE(matcher.find_first(mapping));
+    EXPECT_TRUE(matcher.limit_reached());
+    EXPECT_EQ(matcher.get_states_explored(), 2);
+}
+
+// Test 7: MCISAlgorithm skips the solver when one input is embedded in the other
+TEST_F(VF3Test, AlgorithmShortCircuitsOnEmbedding) {
+    MCISAlgorithm algorithm;
+    auto results = algorithm.run(chorded, path, AlgorithmType::BRON_KERBOSCH_SERIAL);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0]->get_num_nodes(), 3);
+    EXPECT_TRUE(VF3Matcher::is_isomorphic(*results[0], path));
+    for (Graph* result : results) {
+        delete result;
+    }
+}
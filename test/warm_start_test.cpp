@@ -0,0 +1,157 @@
+#include <string>
+#include <vector>
+
+#include "../src/algorithms/bron_kerbosch_serial.h"
+#include "../src/algorithms/warm_start.h"
+#include "gtest/gtest.h"
+#include "mcis/graph.h"
+#include "mcis/indexed_graph.h"
+#include "mcis/vf3.h"
+
+class WarmStartTest : public ::testing::Test {
+protected:
+    static NodeMapping identity(const Graph& graph) {
+        NodeMapping mapping;
+        for (const auto& [id, _] : graph.get_nodes()) {
+            mapping.emplace_back(id, id);
+        }
+        return mapping;
+    }
+
+    static bool contains(const NodeMapping& mapping, const std::string& id1,
+                         const std::string& id2) {
+        for (const auto& pair : mapping) {
+            if (pair.first == id1 && pair.second == id2) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// Test 1: Graphs log their edits per version, and report when the log no longer reaches back
+TEST_F(WarmStartTest, EditLog) {
+    Graph graph;
+    graph.add_node_set({"a", "b", "c"});
+    const int version = graph.get_version();
+    graph.add_edge("a", "b", 0);
+    graph.add_edge("a", "b", 0);  // no change, not logged
+    graph.change_edge_weight("a", "b", 2);
+    graph.set_node_label("c", OpLabel::ADD);
+    graph.remove_node("c");
+    {
+        Graph::BatchEdit batch(graph);
+        batch.add_node("d");
+        batch.add_edge("b", "d", 0);
+    }
+
+    std::vector<GraphEdit> edits;
+    ASSERT_TRUE(graph.get_edits_since(version, edits));
+    std::vector<GraphEditKind> kinds;
+    for (const GraphEdit& edit : edits) {
+        kinds.push_back(edit.kind);
+    }
+    EXPECT_EQ(kinds, std::vector<GraphEditKind>({GraphEditKind::ADD_EDGE,
+                                                 GraphEditKind::CHANGE_WEIGHT,
+                                                 GraphEditKind::SET_LABEL,
+                                                 GraphEditKind::REMOVE_NODE,
+                                                 GraphEditKind::ADD_NODE,
+                                                 GraphEditKind::ADD_EDGE}));
+    EXPECT_EQ(edits[1].from, "a");
+    EXPECT_EQ(edits[1].to, "b");
+    EXPECT_EQ(edits[4].version, edits[5].version);
+    EXPECT_EQ(graph.get_version(), edits[5].version + 1);
+    ASSERT_TRUE(graph.get_edits_since(graph.get_version(), edits));
+    EXPECT_TRUE(edits.empty());
+
+    // Old versions fall out of a full log; large batches and copies start a fresh one
+    const int recent = graph.get_version();
+    for (size_t i = 0; i <= GRAPH_EDIT_LOG_LIMIT; ++i) {
+        graph.add_node("n" + std::to_string(i));
+    }
+    EXPECT_FALSE(graph.get_edits_since(version, edits));
+    EXPECT_FALSE(graph.get_edits_since(recent, edits));
+    ASSERT_TRUE(graph.get_edits_since(graph.get_version() - 10, edits));
+    EXPECT_EQ(edits.size(), 10u);
+
+    Graph fft = Graph::create_fft_graph(256);
+    EXPECT_FALSE(fft.get_edits_since(0, edits));
+    Graph copy(graph);
+    EXPECT_TRUE(copy.get_edits_since(copy.get_version(), edits));
+    EXPECT_FALSE(copy.get_edits_since(copy.get_version() - 1, edits));
+}
+
+// Test 2: A mapping is repaired around edited nodes and extended to new ones
+TEST_F(WarmStartTest, RepairMapping) {
+    Graph g1 = Graph::create_fft_graph(8);
+    Graph g2 = Graph::create_fft_graph(8);
+    const NodeMapping previous = identity(g1);
+    const int n = g1.get_num_nodes();
+    const int v1 = g1.get_version();
+    const int v2 = g2.get_version();
+
+    const std::string child = g1.get_node("x0")->get_children().begin()->first->get_id();
+    g1.remove_edge("x0", child);
+    for (Graph* graph : {&g1, &g2}) {
+        graph->add_node("extra", OpLabel::ADD);
+        graph->add_edge("w0", "extra", 0);
+    }
+
+    std::vector<GraphEdit> edits1;
+    std::vector<GraphEdit> edits2;
+    ASSERT_TRUE(g1.get_edits_since(v1, edits1));
+    ASSERT_TRUE(g2.get_edits_since(v2, edits2));
+    MCISOptions options;
+    NodeMapping repaired = WarmStart::repair_mapping(*g1.get_indexed(), *g2.get_indexed(),
+                                                     previous, &edits1, &edits2, options);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, repaired));
+    EXPECT_EQ(static_cast<int>(repaired.size()), n);
+    EXPECT_TRUE(contains(repaired, "extra", "extra"));
+    EXPECT_FALSE(contains(repaired, "x0", "x0") && contains(repaired, child, child));
+
+    // Without the edits every pair is re-checked
+    NodeMapping rechecked = WarmStart::repair_mapping(*g1.get_indexed(), *g2.get_indexed(),
+                                                      previous, nullptr, nullptr, options);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, rechecked));
+    EXPECT_EQ(static_cast<int>(rechecked.size()), n - 1);
+}
+
+// Test 3: Re-solving after an edit finds the optimum with less search than starting over
+TEST_F(WarmStartTest, UpdateMapping) {
+    Graph g1 = Graph::create_mvm_graph_from_dimensions(2, 3);
+    Graph g2 = Graph::create_fft_graph(4);
+    const int v1 = g1.get_version();
+    const int v2 = g2.get_version();
+    BronKerboschSerial serial;
+    MCISResult previous = serial.find_mapping(g1, g2);
+    ASSERT_GT(previous.size(), 0);
+
+    g1.remove_node(previous.mapping.front().first);
+    MCISResult scratch = serial.find_mapping(g1, g2);
+    MCISResult updated = serial.update_mapping(g1, g2, previous, v1, v2);
+    EXPECT_EQ(updated.size(), scratch.size());
+    EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, updated.mapping));
+    EXPECT_LE(updated.nodes_explored, scratch.nodes_explored);
+
+    // Stale versions fall back to re-checking every pair
+    MCISResult stale = serial.update_mapping(g1, g2, previous, -1, -1);
+    EXPECT_EQ(stale.size(), scratch.size());
+    EXPECT_TRUE(VF3Matcher::verify_mapping(g1, g2, stale.mapping));
+
+    // A repaired mapping reaching the edit bound needs no search at all
+    Graph h1 = Graph::create_fft_graph(4);
+    Graph h2 = Graph::create_fft_graph(4);
+    const int w1 = h1.get_version();
+    const int w2 = h2.get_version();
+    MCISResult full = serial.find_mapping(h1, h2);
+    ASSERT_EQ(full.size(), h1.get_num_nodes());
+    for (Graph* graph : {&h1, &h2}) {
+        graph->add_node("extra", OpLabel::SUB);
+        graph->add_edge("x0", "extra", 0);
+    }
+    MCISResult extended = serial.update_mapping(h1, h2, full, w1, w2);
+    EXPECT_EQ(extended.size(), h1.get_num_nodes());
+    EXPECT_EQ(extended.upper_bound, extended.size());
+    EXPECT_EQ(extended.nodes_explored, 0);
+    EXPECT_TRUE(VF3Matcher::verify_mapping(h1, h2, extended.mapping));
+}
@@ -0,0 +1,19 @@
+/**
+ * @file
+ * @author Bryan SebaRaj <bryan.sebaraj@yale.edu>
+ * @version 1.0
+ * @section DESCRIPTION
+ */
+
+#include <cstdio>
+
+#include "../src/algorithms/distributed_mcis.h"
+
+// Worker process of DistributedMCIS: mcis_worker <coordinator address> <graph file>
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: %s <address> <graph file>\n", argv[0]);
+        return 2;
+    }
+    return DistributedMCIS::run_worker(argv[1], argv[2]) ? 0 : 1;
+}